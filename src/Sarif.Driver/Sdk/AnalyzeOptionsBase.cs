@@ -117,6 +117,12 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
             HelpText = "A SARIF file to be used as baseline.")]
         public string BaselineFilePath { get; set; }
 
+        [Option(
+            "analysis-cache-directory",
+            HelpText = "A directory in which to persist analysis results across runs. Targets whose contents are unchanged since a previous " +
+                       "run with the same rules and configuration are not analyzed again; their cached results are reported instead.")]
+        public string AnalysisCacheDirectory { get; set; }
+
 
         [Option(
             "etw",
@@ -133,6 +139,16 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
             HelpText = "The maximum file size (in kilobytes) that will be analyzed.")]
         public long? MaxFileSizeInKilobytes { get; set; }
 
+        [Option(
+            "rule-parallelism-threshold-in-kb",
+            HelpText = "The file size (in kilobytes) at or above which a scan target's rules are run concurrently rather than one at a time.")]
+        public long? RuleParallelismThresholdInKilobytes { get; set; }
+
+        [Option(
+            "cache-results-by-hash",
+            HelpText = "Analyze each distinct file (by SHA-256 hash) once, replaying its results for every other scan target with identical contents.")]
+        public bool? CacheResultsByHash { get; set; }
+
         [Option(
             "timeout-in-seconds",
             HelpText = "A timeout value expressed in seconds.")]
@@ -0,0 +1,155 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+
+using Microsoft.CodeAnalysis.Sarif.Writers;
+
+using Newtonsoft.Json;
+
+namespace Microsoft.CodeAnalysis.Sarif.Driver
+{
+    /// <summary>
+    ///  CachedTargetAnalysis is the serializable form of everything the analysis of a single
+    ///  target produced: the results and notifications captured by its CachingLogger, and the
+    ///  runtime conditions it raised. Rules are referred to by id, and resolved again when the
+    ///  analysis is replayed into another logger.
+    /// </summary>
+    internal sealed class CachedTargetAnalysis
+    {
+        private static readonly Encoding s_encoding = new UTF8Encoding(encoderShouldEmitUTF8Identifier: false);
+        private static readonly JsonSerializer s_serializer = new JsonSerializer();
+
+        [JsonProperty("runtimeConditions")]
+        public RuntimeConditions RuntimeConditions { get; set; }
+
+        [JsonProperty("results")]
+        public List<CachedResult> Results { get; set; } = new List<CachedResult>();
+
+        [JsonProperty("toolNotifications")]
+        public List<CachedNotification> ToolNotifications { get; set; } = new List<CachedNotification>();
+
+        [JsonProperty("configurationNotifications")]
+        public List<Notification> ConfigurationNotifications { get; set; } = new List<Notification>();
+
+        /// <summary>
+        ///  Captures the data logged for a target. This must be called before the data is
+        ///  replayed to any other logger, as loggers are free to modify what they log.
+        /// </summary>
+        /// <param name="logger">The logger that captured the target's analysis.</param>
+        /// <param name="runtimeConditions">The runtime conditions raised analyzing the target.</param>
+        public static CachedTargetAnalysis Capture(CachingLogger logger, RuntimeConditions runtimeConditions)
+        {
+            if (logger == null) { throw new ArgumentNullException(nameof(logger)); }
+
+            var analysis = new CachedTargetAnalysis { RuntimeConditions = runtimeConditions };
+
+            if (logger.Results != null)
+            {
+                foreach (KeyValuePair<ReportingDescriptor, IList<Tuple<Result, int?>>> kv in logger.Results)
+                {
+                    foreach (Tuple<Result, int?> tuple in kv.Value)
+                    {
+                        analysis.Results.Add(new CachedResult { RuleId = kv.Key.Id, ExtensionIndex = tuple.Item2, Result = tuple.Item1 });
+                    }
+                }
+            }
+
+            if (logger.ToolNotifications != null)
+            {
+                foreach (Tuple<Notification, ReportingDescriptor> tuple in logger.ToolNotifications)
+                {
+                    analysis.ToolNotifications.Add(new CachedNotification { RuleId = tuple.Item2?.Id, Notification = tuple.Item1 });
+                }
+            }
+
+            if (logger.ConfigurationNotifications != null)
+            {
+                analysis.ConfigurationNotifications.AddRange(logger.ConfigurationNotifications);
+            }
+
+            return analysis;
+        }
+
+        public static CachedTargetAnalysis Read(Stream stream)
+        {
+            using (var reader = new JsonTextReader(new StreamReader(stream, s_encoding, detectEncodingFromByteOrderMarks: false, bufferSize: 4096, leaveOpen: true)))
+            {
+                return s_serializer.Deserialize<CachedTargetAnalysis>(reader);
+            }
+        }
+
+        public void Write(Stream stream)
+        {
+            using (var writer = new JsonTextWriter(new StreamWriter(stream, s_encoding, bufferSize: 4096, leaveOpen: true)))
+            {
+                s_serializer.Serialize(writer, this);
+            }
+        }
+
+        /// <summary>
+        ///  Populates an (empty) logger with the cached data.
+        /// </summary>
+        /// <param name="logger">The logger to populate.</param>
+        /// <param name="getRule">Returns the rule with the specified id, or null if there is none.</param>
+        /// <returns>False, leaving the logger untouched, if a rule couldn't be resolved; otherwise true.</returns>
+        public bool TryPopulate(CachingLogger logger, Func<string, ReportingDescriptor> getRule)
+        {
+            if (logger == null) { throw new ArgumentNullException(nameof(logger)); }
+            if (getRule == null) { throw new ArgumentNullException(nameof(getRule)); }
+
+            var results = new Dictionary<ReportingDescriptor, IList<Tuple<Result, int?>>>();
+            foreach (CachedResult cached in Results)
+            {
+                ReportingDescriptor rule = getRule(cached.RuleId);
+                if (rule == null) { return false; }
+
+                if (!results.TryGetValue(rule, out IList<Tuple<Result, int?>> ruleResults))
+                {
+                    ruleResults = results[rule] = new List<Tuple<Result, int?>>();
+                }
+
+                ruleResults.Add(new Tuple<Result, int?>(cached.Result, cached.ExtensionIndex));
+            }
+
+            var toolNotifications = new List<Tuple<Notification, ReportingDescriptor>>();
+            foreach (CachedNotification cached in ToolNotifications)
+            {
+                ReportingDescriptor rule = null;
+                if (cached.RuleId != null && (rule = getRule(cached.RuleId)) == null) { return false; }
+
+                toolNotifications.Add(new Tuple<Notification, ReportingDescriptor>(cached.Notification, rule));
+            }
+
+            if (results.Count > 0) { logger.Results = results; }
+            if (toolNotifications.Count > 0) { logger.ToolNotifications = toolNotifications; }
+            if (ConfigurationNotifications.Count > 0) { logger.ConfigurationNotifications = ConfigurationNotifications; }
+
+            return true;
+        }
+
+        internal sealed class CachedResult
+        {
+            [JsonProperty("ruleId")]
+            public string RuleId { get; set; }
+
+            [JsonProperty("extensionIndex", NullValueHandling = NullValueHandling.Ignore)]
+            public int? ExtensionIndex { get; set; }
+
+            [JsonProperty("result")]
+            public Result Result { get; set; }
+        }
+
+        internal sealed class CachedNotification
+        {
+            [JsonProperty("ruleId", NullValueHandling = NullValueHandling.Ignore)]
+            public string RuleId { get; set; }
+
+            [JsonProperty("notification")]
+            public Notification Notification { get; set; }
+        }
+    }
+}
@@ -6,6 +6,8 @@ using System.Collections.Generic;
 using System.Globalization;
 using System.IO;
 
+using Microsoft.CodeAnalysis.Sarif.Readers;
+
 using Newtonsoft.Json;
 using Newtonsoft.Json.Serialization;
 
@@ -49,13 +51,25 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
             return valid;
         }
 
+        /// <summary>
+        ///  Read a SARIF file. A SarifLog may also be read from a binary log written by SarifLog.SaveBinary
+        ///  (as WriteSarifFile does for a '.sarifb' output), so that pipeline stages can skip JSON in between.
+        /// </summary>
         public static T ReadSarifFile<T>(IFileSystem fileSystem, string filePath, IContractResolver contractResolver = null)
         {
             var serializer = new JsonSerializer() { ContractResolver = contractResolver };
 
-            using (var reader = new JsonTextReader(new StreamReader(fileSystem.FileOpenRead(filePath))))
+            using (Stream stream = fileSystem.FileOpenRead(filePath))
             {
-                return serializer.Deserialize<T>(reader);
+                if (typeof(T) == typeof(SarifLog) && SarifBinaryReader.IsBinaryLog(stream))
+                {
+                    return (T)(object)SarifLog.LoadBinary(stream);
+                }
+
+                using (var reader = new JsonTextReader(new StreamReader(stream)))
+                {
+                    return serializer.Deserialize<T>(reader);
+                }
             }
         }
 
@@ -68,12 +82,27 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
             WriteSarifFile(fileSystem, sarifFile, outputName, minify ? 0 : Formatting.Indented, contractResolver);
         }
 
+        /// <summary>
+        ///  Write a SARIF file. A SarifLog written to a '.sarifb' file is written with SarifLog.SaveBinary,
+        ///  for a following pipeline stage to read with ReadSarifFile; it is not SARIF, so it's not for publishing.
+        /// </summary>
         public static void WriteSarifFile<T>(IFileSystem fileSystem,
                                              T sarifFile,
                                              string outputName,
                                              Formatting formatting = Formatting.None,
                                              IContractResolver contractResolver = null)
         {
+            if (sarifFile is SarifLog log &&
+                SarifBinaryFormat.FileExtension.Equals(Path.GetExtension(outputName), StringComparison.OrdinalIgnoreCase))
+            {
+                using (Stream stream = fileSystem.FileCreate(outputName))
+                {
+                    log.SaveBinary(stream);
+                }
+
+                return;
+            }
+
             var serializer = new JsonSerializer()
             {
                 ContractResolver = contractResolver,
@@ -0,0 +1,136 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections.Generic;
+using System.IO;
+
+using Microsoft.CodeAnalysis.Sarif.Writers;
+
+namespace Microsoft.CodeAnalysis.Sarif.Driver
+{
+    /// <summary>
+    ///  ContentHashResultsCache keeps the results and notifications produced by analyzing a
+    ///  target, keyed by the hash of the target's contents, so that they can be replayed for
+    ///  other targets with identical contents rather than analyzing them again. The cached
+    ///  data is written to a temporary file as each target is analyzed; only the file offset
+    ///  of each entry (and one instance of each rule) is held in memory.
+    /// </summary>
+    internal sealed class ContentHashResultsCache : IDisposable
+    {
+        private readonly TempFile _file;
+        private readonly FileStream _stream;
+        private readonly Dictionary<string, (long Offset, int Length)> _entries;
+        private readonly Dictionary<string, ReportingDescriptor> _rules;
+
+        public ContentHashResultsCache()
+        {
+            _file = new TempFile(".json");
+            _stream = new FileStream(_file.Name, FileMode.Create, FileAccess.ReadWrite, FileShare.None);
+            _entries = new Dictionary<string, (long Offset, int Length)>(StringComparer.Ordinal);
+            _rules = new Dictionary<string, ReportingDescriptor>(StringComparer.Ordinal);
+        }
+
+        /// <summary>
+        ///  Returns the number of distinct targets cached.
+        /// </summary>
+        public int Count
+        {
+            get
+            {
+                lock (_stream)
+                {
+                    return _entries.Count;
+                }
+            }
+        }
+
+        /// <summary>
+        ///  Caches the data logged for a target. This must be called before the data is
+        ///  replayed to any other logger, as loggers are free to modify what they log.
+        /// </summary>
+        /// <param name="hash">The hash of the target's contents.</param>
+        /// <param name="logger">The logger that captured the target's analysis.</param>
+        /// <param name="runtimeConditions">The runtime conditions raised analyzing the target.</param>
+        public void Add(string hash, CachingLogger logger, RuntimeConditions runtimeConditions)
+        {
+            if (hash == null) { throw new ArgumentNullException(nameof(hash)); }
+
+            var analysis = CachedTargetAnalysis.Capture(logger, runtimeConditions);
+
+            lock (_stream)
+            {
+                if (_entries.ContainsKey(hash)) { return; }
+
+                RetainRules(logger);
+
+                long offset = _stream.Seek(0, SeekOrigin.End);
+                analysis.Write(_stream);
+
+                _entries[hash] = (offset, (int)(_stream.Position - offset));
+            }
+        }
+
+        /// <summary>
+        ///  Populates a logger with a fresh copy of the data cached for a target.
+        /// </summary>
+        /// <param name="hash">The hash of the target's contents.</param>
+        /// <param name="logger">The (empty) logger to populate.</param>
+        /// <param name="runtimeConditions">The runtime conditions raised analyzing the cached target.</param>
+        /// <returns>True if data was cached for the hash; otherwise false.</returns>
+        public bool TryReplay(string hash, CachingLogger logger, out RuntimeConditions runtimeConditions)
+        {
+            if (hash == null) { throw new ArgumentNullException(nameof(hash)); }
+
+            runtimeConditions = RuntimeConditions.None;
+
+            lock (_stream)
+            {
+                if (!_entries.TryGetValue(hash, out (long Offset, int Length) location)) { return false; }
+
+                byte[] buffer = new byte[location.Length];
+                _stream.Seek(location.Offset, SeekOrigin.Begin);
+
+                int read = 0;
+                while (read < buffer.Length)
+                {
+                    int count = _stream.Read(buffer, read, buffer.Length - read);
+                    if (count == 0) { throw new EndOfStreamException(); }
+                    read += count;
+                }
+
+                CachedTargetAnalysis analysis = CachedTargetAnalysis.Read(new MemoryStream(buffer));
+                runtimeConditions = analysis.RuntimeConditions;
+
+                return analysis.TryPopulate(logger, ruleId => _rules.TryGetValue(ruleId, out ReportingDescriptor rule) ? rule : null);
+            }
+        }
+
+        public void Dispose()
+        {
+            _stream.Dispose();
+            _file.Dispose();
+        }
+
+        private void RetainRules(CachingLogger logger)
+        {
+            // Rules are the same for every target, so each is held once rather than per entry.
+            if (logger.Results != null)
+            {
+                foreach (ReportingDescriptor rule in logger.Results.Keys)
+                {
+                    if (!_rules.ContainsKey(rule.Id)) { _rules[rule.Id] = rule; }
+                }
+            }
+
+            if (logger.ToolNotifications != null)
+            {
+                foreach (Tuple<Notification, ReportingDescriptor> tuple in logger.ToolNotifications)
+                {
+                    ReportingDescriptor rule = tuple.Item2;
+                    if (rule != null && !_rules.ContainsKey(rule.Id)) { _rules[rule.Id] = rule; }
+                }
+            }
+        }
+    }
+}
@@ -14,6 +14,7 @@ using System.Net;
 using System.Net.Http;
 using System.Reflection;
 using System.Runtime.InteropServices;
+using System.Text;
 using System.Threading;
 using System.Threading.Channels;
 using System.Threading.Tasks;
@@ -22,6 +23,9 @@ using Microsoft.CodeAnalysis.Sarif.Driver.Sdk;
 using Microsoft.CodeAnalysis.Sarif.Writers;
 using Microsoft.Diagnostics.Tracing.Session;
 
+using Newtonsoft.Json;
+using Newtonsoft.Json.Linq;
+
 namespace Microsoft.CodeAnalysis.Sarif.Driver
 {
     public abstract class MultithreadedAnalyzeCommandBase<TContext, TOptions> : PluginDriverCommand<TOptions>
@@ -44,6 +48,26 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
         private Channel<uint> _readyToScanChannel;
         private ConcurrentDictionary<uint, TContext> _fileContexts;
 
+        // Limits the number of targets enumerated but not yet logged (null for no limit).
+        // Results are logged in enumeration order, so without it every target completed
+        // behind a single slow one would be held in memory, with its results, until the
+        // slow target finishes.
+        private SemaphoreSlim _bufferedTargets;
+
+        // When results are cached by content hash, each target on disk is hashed as it is
+        // enumerated. The first target with a given hash is analyzed and its results cached;
+        // every later one is skipped by the scan workers and replayed from the cache when it
+        // is logged (which is always after the first, as logging is in enumeration order).
+        private ContentHashResultsCache _resultsCache;
+        private HashSet<string> _enumeratedHashes;
+        private ConcurrentDictionary<uint, string> _targetHashes;
+        private ConcurrentDictionary<uint, string> _replayedTargetHashes;
+
+        // When results are persisted across runs, a hashed target whose analysis was cached by
+        // a previous run (with the same tool, rules and configuration) isn't analyzed at all.
+        private PersistentAnalysisCache _analysisCache;
+        private int _initialDisabledSkimmersCount;
+
         public static bool RaiseUnhandledExceptionInDriverCode { get; set; }
 
         public virtual Tool Tool { get; set; }
@@ -417,11 +441,14 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
                 context.Threads = options.Threads > 0 ? options.Threads : context.Threads;
                 context.OutputFilePath = options.OutputFilePath ?? context.OutputFilePath;
                 context.BaselineFilePath = options.BaselineFilePath ?? context.BaselineFilePath;
+                context.AnalysisCacheDirectory = options.AnalysisCacheDirectory ?? context.AnalysisCacheDirectory;
                 context.Recurse = options.Recurse != null ? options.Recurse.Value : context.Recurse;
+                context.CacheResultsByHash = options.CacheResultsByHash != null ? options.CacheResultsByHash.Value : context.CacheResultsByHash;
                 context.GlobalFilePathDenyRegex = options.GlobalFilePathDenyRegex ?? context.GlobalFilePathDenyRegex;
                 context.AutomationGuid = options.AutomationGuid != default ? options.AutomationGuid : context.AutomationGuid;
                 context.OutputConfigurationFilePath = options.OutputConfigurationFilePath ?? context.OutputConfigurationFilePath;
                 context.MaxFileSizeInKilobytes = options.MaxFileSizeInKilobytes != null ? options.MaxFileSizeInKilobytes.Value : context.MaxFileSizeInKilobytes;
+                context.RuleParallelismThresholdInKilobytes = options.RuleParallelismThresholdInKilobytes != null ? options.RuleParallelismThresholdInKilobytes.Value : context.RuleParallelismThresholdInKilobytes;
                 context.PluginFilePaths = options.PluginFilePaths?.Any() == true ? options.PluginFilePaths?.ToImmutableHashSet() : context.PluginFilePaths;
                 context.TimeoutInMilliseconds = options.TimeoutInSeconds != null ? Math.Max(options.TimeoutInSeconds.Value * 1000, 0) : context.TimeoutInMilliseconds;
                 context.InsertProperties = options.InsertProperties?.Any() == true ? InitializeStringSet(options.InsertProperties) : context.InsertProperties;
@@ -580,6 +607,31 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
             };
             _resultsWritingChannel = Channel.CreateBounded<uint>(channelOptions);
 
+            _bufferedTargets = globalContext.MaxBufferedTargets > 0
+                ? new SemaphoreSlim(globalContext.MaxBufferedTargets)
+                : null;
+
+            if (globalContext.CacheResultsByHash)
+            {
+                _resultsCache = new ContentHashResultsCache();
+                _enumeratedHashes = new HashSet<string>(StringComparer.Ordinal);
+                _replayedTargetHashes = new ConcurrentDictionary<uint, string>();
+            }
+
+            if (!string.IsNullOrEmpty(globalContext.AnalysisCacheDirectory))
+            {
+                IEnumerable<Skimmer<TContext>> enabledSkimmers = skimmers.Where(skimmer => !disabledSkimmers.Contains(skimmer.Id));
+                string analysisIdentity = ComputeAnalysisIdentity(globalContext, enabledSkimmers);
+
+                _analysisCache = new PersistentAnalysisCache(globalContext.AnalysisCacheDirectory, analysisIdentity, skimmers, FileSystem);
+                _initialDisabledSkimmersCount = disabledSkimmers.Count;
+            }
+
+            if (_resultsCache != null || _analysisCache != null)
+            {
+                _targetHashes = new ConcurrentDictionary<uint, string>();
+            }
+
             var sw = Stopwatch.StartNew();
 
             if (!globalContext.Quiet)
@@ -614,6 +666,16 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
             await enumerateTargets.ConfigureAwait(false);
             await logResults.ConfigureAwait(false);
 
+            _bufferedTargets?.Dispose();
+            _bufferedTargets = null;
+
+            _resultsCache?.Dispose();
+            _resultsCache = null;
+            _enumeratedHashes = null;
+            _targetHashes = null;
+            _replayedTargetHashes = null;
+            _analysisCache = null;
+
             if (_filesMatchingGlobalFileDenyRegex > 0)
             {
                 string reason = "file path(s) matched the global file deny regex";
@@ -673,7 +735,15 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
                         {
                             DriverEventSource.Log.LogResultsStart();
                             globalContext.CurrentTarget = context.CurrentTarget;
-                            LogCachingLogger(globalContext, (CachingLogger)context.Logger, clone: false);
+
+                            var cachingLogger = (CachingLogger)context.Logger;
+                            RuntimeConditions replayedConditions = RuntimeConditions.None;
+                            bool replayed = _replayedTargetHashes != null &&
+                                            _replayedTargetHashes.TryRemove(currentIndex, out string hash) &&
+                                            _resultsCache.TryReplay(hash, cachingLogger, out replayedConditions);
+
+                            LogCachingLogger(globalContext, cachingLogger, replayed);
+                            context.RuntimeErrors |= replayedConditions;
                             DriverEventSource.Log.LogResultsStop();
 
                             globalContext.RuntimeErrors |= context.RuntimeErrors;
@@ -690,29 +760,35 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
                         }
 
                         _fileContexts.TryRemove(currentIndex, out _);
+                        _bufferedTargets?.Release();
+
                         _fileContexts.TryGetValue(++currentIndex, out context);
                     }
                 }
             }
         }
 
-        private static void LogCachingLogger(TContext globalContext, CachingLogger cachingLogger, bool clone = false)
+        private static void LogCachingLogger(TContext globalContext, CachingLogger cachingLogger, bool replayed = false)
         {
-            // Today, the signal to generate hash data in log files is synonymous with a decision
-            // to perform target file results-caching (where we only analyze a copy of a file, by
-            // hash, a single time). We need to separate configuring this mechanism. Some scan 
-            // scenarios, such as binary analysis + crawl of PDB, greatly benefit from this mechanism,
-            // other scan scenarios, such as lightweight linting of large #'s of source files, 
-            // experience significant memory pressure from it. Disabling caching altogether for now.
-            // 
+            // Results-caching by target hash (where we only analyze a copy of a file a single
+            // time) is configured separately from the generation of hash data in log files, as
+            // some scan scenarios, such as binary analysis + crawl of PDB, greatly benefit from
+            // it while others, such as lightweight linting of large #'s of source files, don't.
+            // Cached data is held on disk rather than in a logger per hash, to bound memory.
+            //
             // https://github.com/microsoft/sarif-sdk/issues/2620
             //
-            // As a result of this gap, `clone` will always be false, because we have a per-file
-            // (and not per-file-by-hash) logger instance.
+            // When `replayed` is true, the logger holds a fresh copy of the data cached for
+            // another target with the same contents, which must be updated to refer to the
+            // current target.
 
             IDictionary<ReportingDescriptor, IList<Tuple<Result, int?>>> results = cachingLogger.Results;
             globalContext.CancellationToken.ThrowIfCancellationRequested();
-            IEnumeratedArtifact artifact = globalContext.CurrentTarget;
+
+            if (replayed)
+            {
+                UpdateCachingLoggerWithCurrentUri(cachingLogger, globalContext.CurrentTarget.Uri);
+            }
 
             if (results?.Count > 0)
             {
@@ -721,18 +797,8 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
                     globalContext.CancellationToken.ThrowIfCancellationRequested();
                     foreach (Tuple<Result, int?> tuple in kv.Value)
                     {
-                        Result result = tuple.Item1;
-                        Result currentResult = result;
-                        if (clone)
-                        {
-                            Result clonedResult = result.DeepClone();
-
-                            UpdateLocationsAndMessageWithCurrentUri(clonedResult.Locations, clonedResult.Message, artifact.Uri);
-
-                            currentResult = clonedResult;
-                        }
                         globalContext.Logger.FileRegionsCache = cachingLogger.FileRegionsCache;
-                        globalContext.Logger.Log(kv.Key, currentResult, tuple.Item2);
+                        globalContext.Logger.Log(kv.Key, tuple.Item1, tuple.Item2);
                     }
                 }
             }
@@ -749,16 +815,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
             {
                 foreach (Notification notification in cachingLogger.ConfigurationNotifications)
                 {
-                    Notification currentNotification = notification;
-                    if (clone)
-                    {
-                        Notification clonedNotification = notification.DeepClone();
-                        UpdateLocationsAndMessageWithCurrentUri(clonedNotification.Locations, notification.Message, artifact.Uri);
-
-                        currentNotification = clonedNotification;
-                    }
-
-                    globalContext.Logger.LogConfigurationNotification(currentNotification);
+                    globalContext.Logger.LogConfigurationNotification(notification);
                 }
             }
 
@@ -887,6 +944,13 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
                 return true;
             }
 
+            if (_bufferedTargets != null)
+            {
+                // Apply backpressure to enumeration (and so to the scan channel) rather than
+                // letting completed targets pile up behind one that is still being analyzed.
+                await _bufferedTargets.WaitAsync(globalContext.CancellationToken);
+            }
+
             TContext fileContext = CreateScanTargetContext(globalContext);
 
             fileContext.Logger = new CachingLogger(globalContext.FailureLevels,
@@ -910,6 +974,19 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
             bool added = _fileContexts.TryAdd(_fileContextsCount, fileContext);
             Debug.Assert(added);
 
+            string hash = _targetHashes != null ? ComputeTargetHash(artifact) : null;
+            if (hash != null)
+            {
+                if (_enumeratedHashes == null || _enumeratedHashes.Add(hash))
+                {
+                    _targetHashes[_fileContextsCount] = hash;
+                }
+                else
+                {
+                    _replayedTargetHashes[_fileContextsCount] = hash;
+                }
+            }
+
             if (_fileContextsCount == 0)
             {
                 DriverEventSource.Log.FirstArtifactQueued(fileContext.CurrentTarget.Uri.GetFilePath());
@@ -920,6 +997,28 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
             return true;
         }
 
+        private string ComputeTargetHash(IEnumeratedArtifact artifact)
+        {
+            // Only targets read from disk are hashed (and so cached), as hashing them doesn't
+            // fault in their contents while they wait to be scanned. Targets with contents or a
+            // stream supplied by the caller, or that live in an archive, are always analyzed.
+            if (!(artifact is EnumeratedArtifact enumeratedArtifact) ||
+                enumeratedArtifact.Stream != null ||
+                enumeratedArtifact.contents != null ||
+                enumeratedArtifact.bytes != null)
+            {
+                return null;
+            }
+
+            Uri uri = artifact.Uri;
+            if (uri == null || !uri.IsAbsoluteUri || !uri.IsFile || !string.IsNullOrEmpty(uri.Query))
+            {
+                return null;
+            }
+
+            return HashUtilities.ComputeSha256Hash(uri.GetFilePath(), FileSystem);
+        }
+
         private static bool IsOpcArtifact(IEnumeratedArtifact artifact, string filePath, TContext globalContext)
         {
             string extension = Path.GetExtension(filePath.ReplaceInvalidCharInFileName(string.Empty));
@@ -979,14 +1078,55 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
                 {
                     TContext perFileContext = _fileContexts[item];
                     perFileContext.CancellationToken.ThrowIfCancellationRequested();
+
+                    if (_replayedTargetHashes?.ContainsKey(item) == true)
+                    {
+                        // Results for this target are replayed from the cache when it is logged.
+                        perFileContext.AnalysisComplete = true;
+                        await _resultsWritingChannel.Writer.WriteAsync(item);
+                        continue;
+                    }
+
                     string filePath = perFileContext.CurrentTarget.Uri.GetFilePath();
+                    var cachingLogger = (CachingLogger)perFileContext.Logger;
+
+                    string hash = null;
+                    _targetHashes?.TryRemove(item, out hash);
+
+                    if (hash != null && _analysisCache != null &&
+                        _analysisCache.TryReplay(hash, cachingLogger, out RuntimeConditions cachedConditions))
+                    {
+                        // The analysis may have been cached for another target with the same contents.
+                        UpdateCachingLoggerWithCurrentUri(cachingLogger, perFileContext.CurrentTarget.Uri);
+                        perFileContext.RuntimeErrors |= cachedConditions;
+                    }
+                    else
+                    {
+                        try
+                        {
+                            DriverEventSource.Log.ReadArtifactStart(filePath);
+                            // The size of a target on disk comes from its file system metadata; its
+                            // contents are only read if (and as far as) a rule actually asks for them.
+                            long sizeInBytes = perFileContext.CurrentTarget.SizeInBytes.Value;
+                            DriverEventSource.Log.ReadArtifactStop(filePath, sizeInBytes);
 
-                    DriverEventSource.Log.ReadArtifactStart(filePath);
-                    // Reading the length property faults in the file contents.
-                    long sizeInBytes = perFileContext.CurrentTarget.SizeInBytes.Value;
-                    DriverEventSource.Log.ReadArtifactStop(filePath, sizeInBytes);
+                            DetermineApplicabilityAndAnalyze(perFileContext, skimmers, disabledSkimmers);
+                        }
+                        catch (Exception ex) when (!(ex is OperationCanceledException))
+                        {
+                            // Results are logged in enumeration order, and enumeration waits on
+                            // logging, so a target that is never completed would stall the scan.
+                            Errors.LogUnhandledEngineException(perFileContext, ex);
+                            perFileContext.RuntimeExceptions ??= new List<Exception>();
+                            perFileContext.RuntimeExceptions.Add(ex);
+                        }
 
-                    DetermineApplicabilityAndAnalyze(perFileContext, skimmers, disabledSkimmers);
+                        if (hash != null && _analysisCache != null && IsAnalysisPersistable(perFileContext, disabledSkimmers))
+                        {
+                            // This must precede logging, which is free to modify the results.
+                            _analysisCache.Add(hash, cachingLogger, perFileContext.RuntimeErrors);
+                        }
+                    }
 
                     // Every scan worker merges into this flags enum, so the
                     // read-modify-write must be serialized against its peers and against
@@ -996,12 +1136,95 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
                         globalContext.RuntimeErrors |= perFileContext.RuntimeErrors;
                     }
 
+                    if (hash != null && _resultsCache != null)
+                    {
+                        // This must precede logging, which is free to modify the results.
+                        _resultsCache.Add(hash, cachingLogger, perFileContext.RuntimeErrors);
+                    }
+
                     perFileContext.AnalysisComplete = true;
                     await _resultsWritingChannel.Writer.WriteAsync(item);
                 }
             }
         }
 
+        private bool IsAnalysisPersistable(TContext context, ISet<string> disabledSkimmers)
+        {
+            // An analysis that failed, or that ran after a rule was disabled for raising an
+            // exception, isn't what the next run would produce and so mustn't be replayed.
+            if ((context.RuntimeErrors & RuntimeConditions.Fatal) != 0 || context.RuntimeExceptions?.Count > 0)
+            {
+                return false;
+            }
+
+            lock (disabledSkimmers)
+            {
+                return disabledSkimmers.Count == _initialDisabledSkimmersCount;
+            }
+        }
+
+        /// <summary>
+        /// Returns a hash of everything other than a target's contents that its analysis
+        /// depends on: the tool, the enabled rules (and the builds of the assemblies that
+        /// implement them) and their configuration. Analysis persisted by one run is only
+        /// replayed by a later run with the same identity. Tools whose analysis depends on
+        /// other inputs, such as the contents of other files, should override this to add
+        /// those inputs to the identity.
+        /// </summary>
+        protected virtual string ComputeAnalysisIdentity(TContext globalContext, IEnumerable<Skimmer<TContext>> enabledSkimmers)
+        {
+            var identity = new StringBuilder();
+
+            identity.AppendLine(Tool?.Driver?.Name);
+            identity.AppendLine(Tool?.Driver?.Version ?? Tool?.Driver?.SemanticVersion);
+            identity.AppendLine(GetAssemblyIdentity(GetType().Assembly));
+
+            foreach (Skimmer<TContext> skimmer in enabledSkimmers.OrderBy(skimmer => skimmer.Id, StringComparer.Ordinal))
+            {
+                identity.AppendLine($"{skimmer.Id}|{GetAssemblyIdentity(skimmer.GetType().Assembly)}");
+            }
+
+            // Results are filtered by level and kind as they are captured.
+            identity.AppendLine(string.Join(";", globalContext.FailureLevels.OrderBy(level => level)));
+            identity.AppendLine(string.Join(";", globalContext.ResultKinds.OrderBy(kind => kind)));
+
+            // Core settings describe the scan rather than the analysis of any one target (and
+            // include values, such as the output path, that differ from one run to the next).
+            string coreSettings = $"{AnalyzeContextBase.ThreadsProperty.Feature}.Options";
+            var configuration = new PropertiesDictionary();
+            foreach (KeyValuePair<string, object> kv in globalContext.Policy)
+            {
+                if (kv.Key != coreSettings) { configuration[kv.Key] = kv.Value; }
+            }
+
+            identity.AppendLine(SortProperties(JToken.FromObject(configuration)).ToString(Formatting.None));
+
+            return HashUtilities.ComputeSha256HashValue(identity.ToString());
+        }
+
+        private static string GetAssemblyIdentity(Assembly assembly)
+        {
+            // The module version id changes whenever the assembly is rebuilt from changed sources.
+            return $"{assembly.FullName}|{assembly.ManifestModule.ModuleVersionId}";
+        }
+
+        private static JToken SortProperties(JToken token)
+        {
+            switch (token)
+            {
+                case JObject jObject:
+                    return new JObject(jObject.Properties()
+                                              .OrderBy(property => property.Name, StringComparer.Ordinal)
+                                              .Select(property => new JProperty(property.Name, SortProperties(property.Value))));
+
+                case JArray jArray:
+                    return new JArray(jArray.Select(SortProperties));
+
+                default:
+                    return token;
+            }
+        }
+
         protected virtual void ValidateOptions(TOptions options, TContext context)
         {
             bool succeeded = true;
@@ -1414,6 +1637,36 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
             return context;
         }
 
+        private static void UpdateCachingLoggerWithCurrentUri(CachingLogger cachingLogger, Uri updatedUri)
+        {
+            if (cachingLogger.Results != null)
+            {
+                foreach (IList<Tuple<Result, int?>> results in cachingLogger.Results.Values)
+                {
+                    foreach (Tuple<Result, int?> tuple in results)
+                    {
+                        UpdateLocationsAndMessageWithCurrentUri(tuple.Item1.Locations, tuple.Item1.Message, updatedUri);
+                    }
+                }
+            }
+
+            if (cachingLogger.ToolNotifications != null)
+            {
+                foreach (Tuple<Notification, ReportingDescriptor> tuple in cachingLogger.ToolNotifications)
+                {
+                    UpdateLocationsAndMessageWithCurrentUri(tuple.Item1.Locations, tuple.Item1.Message, updatedUri);
+                }
+            }
+
+            if (cachingLogger.ConfigurationNotifications != null)
+            {
+                foreach (Notification notification in cachingLogger.ConfigurationNotifications)
+                {
+                    UpdateLocationsAndMessageWithCurrentUri(notification.Locations, notification.Message, updatedUri);
+                }
+            }
+        }
+
         internal static void UpdateLocationsAndMessageWithCurrentUri(IList<Location> locations, Message message, Uri updatedUri)
         {
             if (locations == null) { return; }
@@ -1474,10 +1727,70 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
             long sizeInBytes = context.CurrentTarget.SizeInBytes.Value;
 
             DriverEventSource.Log.ScanArtifactStart(filePath, sizeInBytes);
-            AnalyzeTargetHelper(context, skimmers, disabledSkimmers);
+
+            long threshold = context.RuleParallelismThresholdInKilobytes;
+            if (threshold > 0 && sizeInBytes >= threshold * 1024)
+            {
+                AnalyzeTargetInParallel(context, skimmers, disabledSkimmers);
+            }
+            else
+            {
+                AnalyzeTargetHelper(context, skimmers, disabledSkimmers);
+            }
+
             DriverEventSource.Log.ScanArtifactStop(filePath, sizeInBytes);
         }
 
+        /// <summary>
+        /// Analyzes a (large) target with each of its rules running as a separate work item, so
+        /// that idle scan threads can pick up rules for the target rather than waiting on the
+        /// thread that dequeued it. Each rule analyzes its own copy of the context and logs to
+        /// a logger of its own; these are merged, in rule order, into the target's logger once
+        /// every rule is done, so the output is the same as that of a serial analysis.
+        /// </summary>
+        public static void AnalyzeTargetInParallel(TContext context, IEnumerable<Skimmer<TContext>> skimmers, ISet<string> disabledSkimmers)
+        {
+            var targetLogger = (CachingLogger)context.Logger;
+            var skimmersList = skimmers.ToList();
+
+            if (skimmersList.Count < 2)
+            {
+                AnalyzeTargetHelper(context, skimmersList, disabledSkimmers);
+                return;
+            }
+
+            var ruleContexts = new TContext[skimmersList.Count];
+            var parallelOptions = new ParallelOptions
+            {
+                CancellationToken = context.CancellationToken,
+                MaxDegreeOfParallelism = Math.Max(context.Threads, 1),
+            };
+
+            Parallel.For(0, skimmersList.Count, parallelOptions, i =>
+            {
+                var ruleContext = (TContext)context.CloneForRule();
+                ruleContext.Logger = new CachingLogger(context.FailureLevels, context.ResultKinds);
+
+                AnalyzeTargetHelper(ruleContext, new[] { skimmersList[i] }, disabledSkimmers);
+                ruleContexts[i] = ruleContext;
+            });
+
+            foreach (TContext ruleContext in ruleContexts)
+            {
+                targetLogger.Append((CachingLogger)ruleContext.Logger);
+                context.RuntimeErrors |= ruleContext.RuntimeErrors;
+
+                if (ruleContext.RuntimeExceptions != null)
+                {
+                    context.RuntimeExceptions ??= new List<Exception>();
+                    foreach (Exception exception in ruleContext.RuntimeExceptions)
+                    {
+                        context.RuntimeExceptions.Add(exception);
+                    }
+                }
+            }
+        }
+
         public static void AnalyzeTargetHelper(TContext context, IEnumerable<Skimmer<TContext>> skimmers, ISet<string> disabledSkimmers)
         {
             foreach (Skimmer<TContext> skimmer in skimmers)
@@ -0,0 +1,131 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections.Generic;
+using System.IO;
+
+using Microsoft.CodeAnalysis.Sarif.Writers;
+
+using Newtonsoft.Json;
+
+namespace Microsoft.CodeAnalysis.Sarif.Driver
+{
+    /// <summary>
+    ///  PersistentAnalysisCache keeps the analysis of each target on disk, across runs, keyed
+    ///  by the hash of the target's contents and by an identity that captures everything else
+    ///  the analysis depends on (the tool, its rules and their configuration). Each entry is a
+    ///  separate file, laid out as '{identity}\{first two digits of hash}\{hash}.json', so a
+    ///  change to the tool, rules or configuration simply starts a new set of entries.
+    /// </summary>
+    /// <remarks>
+    ///  Any failure to read or write an entry is treated as a cache miss, as the cache is only
+    ///  ever an optimization. Entries are written to a temporary file and then moved into
+    ///  place, so a reader (or a concurrent run) never observes a partially written entry.
+    /// </remarks>
+    internal sealed class PersistentAnalysisCache
+    {
+        private readonly string _directory;
+        private readonly IFileSystem _fileSystem;
+        private readonly Dictionary<string, ReportingDescriptor> _rules;
+
+        /// <param name="cacheDirectory">The root directory of the cache.</param>
+        /// <param name="analysisIdentity">A hash of everything, other than the target, that the analysis depends on.</param>
+        /// <param name="rules">The rules that cached results may refer to.</param>
+        /// <param name="fileSystem">The file system in which the cache is kept.</param>
+        public PersistentAnalysisCache(string cacheDirectory, string analysisIdentity, IEnumerable<ReportingDescriptor> rules, IFileSystem fileSystem = null)
+        {
+            if (string.IsNullOrEmpty(cacheDirectory)) { throw new ArgumentNullException(nameof(cacheDirectory)); }
+            if (string.IsNullOrEmpty(analysisIdentity)) { throw new ArgumentNullException(nameof(analysisIdentity)); }
+            if (rules == null) { throw new ArgumentNullException(nameof(rules)); }
+
+            _directory = Path.Combine(cacheDirectory, analysisIdentity);
+            _fileSystem = fileSystem ?? FileSystem.Instance;
+            _rules = new Dictionary<string, ReportingDescriptor>(StringComparer.Ordinal);
+
+            foreach (ReportingDescriptor rule in rules)
+            {
+                if (rule.Id != null && !_rules.ContainsKey(rule.Id)) { _rules[rule.Id] = rule; }
+            }
+        }
+
+        /// <summary>
+        ///  Populates a logger with the analysis cached for a target, if any.
+        /// </summary>
+        /// <param name="hash">The hash of the target's contents.</param>
+        /// <param name="logger">The (empty) logger to populate.</param>
+        /// <param name="runtimeConditions">The runtime conditions raised analyzing the cached target.</param>
+        /// <returns>True if the analysis was cached (and could be replayed); otherwise false.</returns>
+        public bool TryReplay(string hash, CachingLogger logger, out RuntimeConditions runtimeConditions)
+        {
+            runtimeConditions = RuntimeConditions.None;
+
+            string path = GetEntryPath(hash);
+            if (!_fileSystem.FileExists(path)) { return false; }
+
+            CachedTargetAnalysis analysis;
+
+            try
+            {
+                using (Stream stream = _fileSystem.FileOpenRead(path))
+                {
+                    analysis = CachedTargetAnalysis.Read(stream);
+                }
+            }
+            catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException || ex is JsonException)
+            {
+                return false;
+            }
+
+            if (analysis == null ||
+                !analysis.TryPopulate(logger, ruleId => _rules.TryGetValue(ruleId, out ReportingDescriptor rule) ? rule : null))
+            {
+                return false;
+            }
+
+            runtimeConditions = analysis.RuntimeConditions;
+            return true;
+        }
+
+        /// <summary>
+        ///  Caches the data logged for a target. This must be called before the data is
+        ///  logged anywhere else, as loggers are free to modify what they log.
+        /// </summary>
+        /// <param name="hash">The hash of the target's contents.</param>
+        /// <param name="logger">The logger that captured the target's analysis.</param>
+        /// <param name="runtimeConditions">The runtime conditions raised analyzing the target.</param>
+        public void Add(string hash, CachingLogger logger, RuntimeConditions runtimeConditions)
+        {
+            string path = GetEntryPath(hash);
+            if (_fileSystem.FileExists(path)) { return; }
+
+            var analysis = CachedTargetAnalysis.Capture(logger, runtimeConditions);
+            string temporaryPath = $"{path}.{Guid.NewGuid():N}.tmp";
+
+            try
+            {
+                _fileSystem.DirectoryCreateDirectory(Path.GetDirectoryName(path));
+
+                // The temporary path is unique, so this never overwrites another writer's file.
+                using (Stream stream = _fileSystem.FileCreate(temporaryPath))
+                {
+                    analysis.Write(stream);
+                }
+
+                _fileSystem.FileMove(temporaryPath, path);
+            }
+            catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException)
+            {
+                // Most likely, another thread or run has cached the same contents first.
+                try { _fileSystem.FileDelete(temporaryPath); } catch (IOException) { } catch (UnauthorizedAccessException) { }
+            }
+        }
+
+        private string GetEntryPath(string hash)
+        {
+            if (string.IsNullOrEmpty(hash) || hash.Length < 2) { throw new ArgumentException("A hash of at least two characters is required.", nameof(hash)); }
+
+            return Path.Combine(_directory, hash.Substring(0, 2), hash + ".json");
+        }
+    }
+}
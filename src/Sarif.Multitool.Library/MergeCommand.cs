@@ -6,16 +6,19 @@ using System.Collections.Generic;
 using System.Diagnostics;
 using System.Globalization;
 using System.IO;
+using System.Linq;
 using System.Threading;
 using System.Threading.Channels;
 using System.Threading.Tasks;
 
 using Microsoft.CodeAnalysis.Sarif.Driver;
 using Microsoft.CodeAnalysis.Sarif.Processors;
+using Microsoft.CodeAnalysis.Sarif.Readers;
 using Microsoft.CodeAnalysis.Sarif.Visitors;
 using Microsoft.CodeAnalysis.Sarif.Writers;
 
 using Newtonsoft.Json;
+using Newtonsoft.Json.Linq;
 
 namespace Microsoft.CodeAnalysis.Sarif.Multitool
 {
@@ -35,12 +38,18 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
         private readonly Dictionary<string, RunMergingVisitor> _toolKeyToVisitor;
         private readonly Dictionary<string, HashSet<Result>> _toolKeyToResults;
 
+        // In streaming mode, each tool's remapped results are spilled to a temporary file as
+        // they arrive rather than being held in memory, and are read back only to write the
+        // merged log. Only the run's tables (rules, artifacts, etc.) stay in memory.
+        private readonly Dictionary<string, ResultSpill> _toolKeyToSpill;
+
         public MergeCommand(IFileSystem fileSystem = null) : base(fileSystem)
         {
             _toolKeyOrder = new List<string>();
             _toolKeyToMergedRun = new Dictionary<string, Run>();
             _toolKeyToVisitor = new Dictionary<string, RunMergingVisitor>();
             _toolKeyToResults = new Dictionary<string, HashSet<Result>>();
+            _toolKeyToSpill = new Dictionary<string, ResultSpill>();
         }
 
         public int Run(MergeOptions mergeOptions)
@@ -62,6 +71,26 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
                     return FAILURE;
                 }
 
+                if (mergeOptions.Streaming && mergeOptions.DataToInsert?.Any() == true)
+                {
+                    // Optional data is inserted by visiting the whole merged log, which
+                    // streaming mode never holds in memory.
+                    Console.Error.WriteLine(
+                    string.Format(
+                        CultureInfo.CurrentCulture,
+                        SdkResources.WRN997_InvalidOption,
+                        nameof(mergeOptions.DataToInsert)));
+                    return FAILURE;
+                }
+
+                if (mergeOptions.Streaming &&
+                    SarifBinaryFormat.FileExtension.Equals(Path.GetExtension(outputFilePath), StringComparison.OrdinalIgnoreCase))
+                {
+                    // A binary log is written from a whole SarifLog, which streaming mode never holds in memory.
+                    Console.Error.WriteLine($"--streaming can't write a binary ('{SarifBinaryFormat.FileExtension}') log.");
+                    return FAILURE;
+                }
+
                 if (!DriverUtilities.ReportWhetherOutputFileCanBeCreated(outputFilePath, _options.ForceOverwrite, FileSystem))
                 {
                     return FAILURE;
@@ -74,15 +103,29 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
                 };
                 _logLoadChannel = Channel.CreateBounded<string>(logLoadOptions);
 
-                var mergeLogsOptions = new UnboundedChannelOptions()
-                {
-                    SingleWriter = false,
-                    SingleReader = true
-                };
-                _mergeLogsChannel = Channel.CreateUnbounded<SarifLog>(mergeLogsOptions);
-
                 _options.Threads = _options.Threads > 0 ? _options.Threads : Environment.ProcessorCount;
 
+                if (_options.Streaming)
+                {
+                    // Bound the number of loaded logs waiting to be merged, so that readers
+                    // can't get arbitrarily far ahead of the (single) merging writer.
+                    var mergeLogsOptions = new BoundedChannelOptions(_options.Threads)
+                    {
+                        SingleWriter = false,
+                        SingleReader = true
+                    };
+                    _mergeLogsChannel = Channel.CreateBounded<SarifLog>(mergeLogsOptions);
+                }
+                else
+                {
+                    var mergeLogsOptions = new UnboundedChannelOptions()
+                    {
+                        SingleWriter = false,
+                        SingleReader = true
+                    };
+                    _mergeLogsChannel = Channel.CreateUnbounded<SarifLog>(mergeLogsOptions);
+                }
+
                 // creating readers
                 var readers = new Task<bool>[_options.Threads];
                 for (int i = 0; i < _options.Threads; i++)
@@ -90,12 +133,12 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
                     readers[i] = Task.Run(LoadSarifLogs);
                 }
 
+                // creating writer (before dispatching, as readers block on a full merge channel)
+                var writer = Task.Run(MergeSarifLogsAsync);
+
                 // reading and dispatching
                 FindFilesAsync().Wait();
 
-                // creating writer
-                var writer = Task.Run(MergeSarifLogsAsync);
-
                 // waiting all readers and closing merge channel
                 Task.WhenAll(readers)
                     .ContinueWith(_ => _mergeLogsChannel.Writer.Complete())
@@ -104,6 +147,14 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
                 // waiting writer
                 writer.Wait();
 
+                FileSystem.DirectoryCreateDirectory(outputDirectory);
+
+                if (_options.Streaming && _toolKeyOrder.Count > 0)
+                {
+                    WriteStreamedSarifFile(outputFilePath);
+                    return SUCCESS;
+                }
+
                 var mergedLog = new SarifLog { Runs = new List<Run>() };
                 foreach (string toolKey in _toolKeyOrder)
                 {
@@ -119,7 +170,6 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
                 mergedLog.Version = SarifVersion.Current;
                 mergedLog.SchemaUri = mergedLog.Version.ConvertToSchemaUri();
 
-                FileSystem.DirectoryCreateDirectory(outputDirectory);
                 WriteSarifFile(FileSystem, mergedLog, outputFilePath, _options.Minify);
             }
             catch (Exception ex)
@@ -129,6 +179,12 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             }
             finally
             {
+                foreach (ResultSpill spill in _toolKeyToSpill.Values)
+                {
+                    spill.Dispose();
+                }
+
+                _toolKeyToSpill.Clear();
                 Console.WriteLine($"Merge completed in {w.Elapsed}.");
             }
             return SUCCESS;
@@ -162,7 +218,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
                         string toolKey = CreateToolKey(run);
                         if (!_toolKeyToVisitor.TryGetValue(toolKey, out RunMergingVisitor visitor))
                         {
-                            visitor = _toolKeyToVisitor[toolKey] = new RunMergingVisitor();
+                            visitor = _toolKeyToVisitor[toolKey] = new RunMergingVisitor(retainResults: !_options.Streaming);
                             _toolKeyToResults[toolKey] = new HashSet<Result>(Result.ValueComparer);
                             _toolKeyOrder.Add(toolKey);
 
@@ -170,7 +226,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
                             // header (tool metadata, automationDetails, columnKind, etc.). Its
                             // result, artifact, and rule collections are replaced by the merged
                             // sets in PopulateWithMerged once every contributing run is absorbed.
-                            _toolKeyToMergedRun[toolKey] = run.DeepClone();
+                            _toolKeyToMergedRun[toolKey] = _options.Streaming ? CloneWithoutResults(run) : run.DeepClone();
                         }
 
                         if (run.Results == null)
@@ -178,6 +234,12 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
                             continue;
                         }
 
+                        if (_options.Streaming)
+                        {
+                            SpillResults(toolKey, run, visitor);
+                            continue;
+                        }
+
                         HashSet<Result> seenResults = _toolKeyToResults[toolKey];
                         foreach (Result result in run.Results)
                         {
@@ -198,6 +260,112 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             return true;
         }
 
+        private void SpillResults(string toolKey, Run run, RunMergingVisitor visitor)
+        {
+            if (!_toolKeyToSpill.TryGetValue(toolKey, out ResultSpill spill))
+            {
+                spill = _toolKeyToSpill[toolKey] = new ResultSpill(FileSystem);
+            }
+
+            visitor.CurrentRun = run;
+
+            foreach (Result result in run.Results)
+            {
+                // Results already written can't be compared by value, so value-identical
+                // results are detected by a hash of their canonical JSON instead.
+                string resultHash = HashUtilities.ComputeStringSha256Hash(ToCanonicalJson(result));
+                if (!spill.ResultHashes.Add(resultHash))
+                {
+                    continue;
+                }
+
+                spill.Write(visitor.VisitResult(result.DeepClone()));
+            }
+        }
+
+        // Result.ValueComparer ignores the order of the entries in property bags and other
+        // dictionaries, so every object's properties are written in ordinal order.
+        private static string ToCanonicalJson(Result result)
+        {
+            JToken token = JToken.FromObject(result);
+            SortProperties(token);
+            return token.ToString(Formatting.None);
+        }
+
+        private static void SortProperties(JToken token)
+        {
+            if (token is JObject jObject)
+            {
+                var properties = jObject.Properties().OrderBy(property => property.Name, StringComparer.Ordinal).ToList();
+                jObject.RemoveAll();
+
+                foreach (JProperty property in properties)
+                {
+                    SortProperties(property.Value);
+                    jObject.Add(property);
+                }
+            }
+            else if (token is JArray jArray)
+            {
+                foreach (JToken item in jArray)
+                {
+                    SortProperties(item);
+                }
+            }
+        }
+
+        private void WriteStreamedSarifFile(string outputFilePath)
+        {
+            using (var jsonWriter = new JsonTextWriter(new StreamWriter(FileSystem.FileCreate(outputFilePath))))
+            {
+                jsonWriter.Formatting = _options.Minify ? Formatting.None : Formatting.Indented;
+
+                using (var writer = new ResultLogJsonWriter(jsonWriter))
+                {
+                    foreach (string toolKey in _toolKeyOrder)
+                    {
+                        Run mergedRun = _toolKeyToMergedRun[toolKey];
+                        _toolKeyToVisitor[toolKey].PopulateWithMerged(mergedRun);
+
+                        // The results are written from the spill; the writer emits the rest
+                        // of the run's properties when the run is completed.
+                        mergedRun.Results = null;
+
+                        writer.InitializeNextRun(mergedRun);
+                        writer.WriteTool(mergedRun.Tool);
+                        writer.OpenResults();
+
+                        if (_toolKeyToSpill.TryGetValue(toolKey, out ResultSpill spill))
+                        {
+                            foreach (Result result in spill.ReadAll())
+                            {
+                                writer.WriteResult(result);
+                            }
+
+                            spill.Dispose();
+                        }
+
+                        writer.CloseResults();
+                    }
+                }
+            }
+        }
+
+        private static Run CloneWithoutResults(Run run)
+        {
+            IList<Result> results = run.Results;
+
+            try
+            {
+                run.Results = null;
+                return run.DeepClone();
+            }
+            finally
+            {
+                run.Results = results;
+            }
+        }
+
         private static string CreateToolKey(Run run)
         {
             return
@@ -220,7 +388,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
                 }
                 try
                 {
-                    ProcessInputSarifLog(filePath);
+                    await ProcessInputSarifLogAsync(filePath);
                 }
                 catch (Exception e)
                 {
@@ -231,14 +399,14 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             return true;
         }
 
-        private void ProcessInputSarifLog(string filePath)
+        private async Task ProcessInputSarifLogAsync(string filePath)
         {
             SarifLog sarifLog = PrereleaseCompatibilityTransformer.UpdateToCurrentVersion(
                 FileSystem.FileReadAllText(filePath),
                 formatting: Formatting.None,
                 out string sarifText);
 
-            _mergeLogsChannel.Writer.TryWrite(sarifLog);
+            await _mergeLogsChannel.Writer.WriteAsync(sarifLog);
             Interlocked.Decrement(ref _filesToProcessCount);
         }
 
@@ -281,5 +449,62 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
                 ? "merged.sarif"
                 : mergeOptions.OutputFileName;
         }
+
+        /// <summary>
+        ///  ResultSpill holds the results merged for one tool in a temporary file, as
+        ///  newline-delimited JSON, until the merged log is written.
+        /// </summary>
+        private sealed class ResultSpill : IDisposable
+        {
+            private static readonly JsonSerializer s_serializer = new JsonSerializer();
+
+            private readonly IFileSystem _fileSystem;
+            private readonly string _filePath;
+            private StreamWriter _writer;
+
+            public ResultSpill(IFileSystem fileSystem)
+            {
+                _fileSystem = fileSystem;
+                _filePath = Path.Combine(Path.GetTempPath(), Path.GetRandomFileName() + ".jsonl");
+                _writer = new StreamWriter(_fileSystem.FileCreate(_filePath));
+                ResultHashes = new HashSet<string>(StringComparer.Ordinal);
+            }
+
+            /// <summary>
+            ///  The hashes of the (original) results spilled so far, for deduplication.
+            /// </summary>
+            public HashSet<string> ResultHashes { get; }
+
+            public void Write(Result result)
+            {
+                s_serializer.Serialize(_writer, result);
+                _writer.WriteLine();
+            }
+
+            public IEnumerable<Result> ReadAll()
+            {
+                _writer?.Dispose();
+                _writer = null;
+
+                using (var reader = new JsonTextReader(new StreamReader(_fileSystem.FileOpenRead(_filePath))) { SupportMultipleContent = true })
+                {
+                    while (reader.Read())
+                    {
+                        yield return s_serializer.Deserialize<Result>(reader);
+                    }
+                }
+            }
+
+            public void Dispose()
+            {
+                _writer?.Dispose();
+                _writer = null;
+
+                if (_fileSystem.FileExists(_filePath))
+                {
+                    _fileSystem.FileDelete(_filePath);
+                }
+            }
+        }
     }
 }
@@ -20,5 +20,10 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             "merge-empty-logs",
             HelpText = "Merge log files with no results into the final log.")]
         public bool MergeEmptyLogs { get; set; }
+
+        [Option(
+            "streaming",
+            HelpText = "Write each tool's merged results to a temporary file as input logs are loaded, rather than holding every result in memory, and stream them into the output log. Cannot be combined with --insert.")]
+        public bool Streaming { get; set; }
     }
 }
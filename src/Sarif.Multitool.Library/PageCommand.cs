@@ -10,6 +10,7 @@ using System.Linq;
 
 using Microsoft.CodeAnalysis.Sarif.Driver;
 using Microsoft.CodeAnalysis.Sarif.Map;
+using Microsoft.CodeAnalysis.Sarif.Readers;
 
 using Newtonsoft.Json;
 
@@ -183,7 +184,10 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
 
             Console.WriteLine($"Run {options.RunIndex} in \"{options.InputFilePath}\" has {results.Count:n0} results.");
 
-            Func<Stream> inputStreamProvider = () => _fileSystem.FileOpenRead(options.InputFilePath);
+            // The page is located and copied with several seeks into the log, which the mapping makes cheap.
+            using var mappedFile = new MemoryMappedStreamProvider(options.InputFilePath, _fileSystem);
+
+            Func<Stream> inputStreamProvider = mappedFile.OpenStream;
             long firstResultStart = results.FindArrayStart(options.Index, inputStreamProvider);
             long lastResultEnd = results.FindArrayStart(options.Index + options.Count, inputStreamProvider) - 1;
 
@@ -196,7 +200,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             byte[] buffer = new byte[64 * 1024];
 
             using (Stream output = _fileSystem.FileCreate(options.OutputFilePath))
-            using (Stream source = _fileSystem.FileOpenRead(options.InputFilePath))
+            using (Stream source = mappedFile.OpenStream())
             {
                 // Copy everything up to 'runs' (includes the '[')
                 JsonMapNode.CopyStreamBytes(source, output, 0, runs.Start, buffer);
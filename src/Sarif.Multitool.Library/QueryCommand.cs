@@ -3,13 +3,17 @@
 
 using System;
 using System.Collections;
+using System.Collections.Generic;
 using System.Diagnostics;
+using System.IO;
 using System.Linq;
 
 using Microsoft.CodeAnalysis.Sarif.Driver;
 using Microsoft.CodeAnalysis.Sarif.Query;
 using Microsoft.CodeAnalysis.Sarif.Query.Evaluators;
 
+using Newtonsoft.Json;
+
 namespace Microsoft.CodeAnalysis.Sarif.Multitool
 {
     public class QueryCommand : CommandBase
@@ -45,9 +49,45 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             int originalTotal = 0;
             int matchCount = 0;
 
-            // Parse the Query and create a Result evaluator for it
+            // Parse the Query
             IExpression expression = ExpressionParser.ParseExpression(options.Expression);
-            IExpressionEvaluator<Result> evaluator = expression.ToEvaluator<Result>(SarifEvaluators.ResultEvaluator);
+
+            SarifLog log = options.UseIndex && SarifEvaluators.CanEvaluateFromIndex(expression)
+                ? QueryIndex(options, expression, ref originalTotal, ref matchCount)
+                : QueryLog(options, expression, ref originalTotal, ref matchCount);
+
+            // Remove any Runs with no remaining matches
+            log.Runs = log.Runs.Where(r => (r?.Results?.Count ?? 0) > 0).ToList();
+
+            w.Stop();
+            Console.WriteLine($"Found {matchCount:n0} of {originalTotal:n0} results matched in {w.Elapsed.TotalSeconds:n1}s.");
+
+            // Write to Output file, if caller requested
+            if (!string.IsNullOrEmpty(options.OutputFilePath) && (options.Force || !_fileSystem.FileExists(options.OutputFilePath)))
+            {
+                Console.WriteLine($"Writing matches to {options.OutputFilePath}.");
+                WriteSarifFile<SarifLog>(_fileSystem, log, options.OutputFilePath, options.Minify);
+            }
+
+            // Return exit code based on configuration
+            if (options.ReturnCount)
+            {
+                return matchCount;
+            }
+            else if (options.NonZeroExitCodeIfCountOver >= 0 && matchCount > options.NonZeroExitCodeIfCountOver)
+            {
+                return TOO_MANY_RESULTS;
+            }
+            else
+            {
+                return SUCCESS;
+            }
+        }
+
+        private SarifLog QueryLog(QueryOptions options, IExpression expression, ref int originalTotal, ref int matchCount)
+        {
+            // Create a Result evaluator for the Query
+            IExpressionEvaluator<Result> evaluator = WithThreads(new CompiledResultEvaluator(expression), options);
 
             // Read the log
             SarifLog log = ReadSarifFile<SarifLog>(_fileSystem, options.InputFilePath);
@@ -72,38 +112,111 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
                 // Write to console, if caller requested
                 if (options.WriteToConsole)
                 {
-                    foreach (Result result in run.Results)
-                    {
-                        Console.WriteLine(result.FormatForVisualStudio());
-                    }
+                    WriteToConsole(run.Results);
                 }
             }
 
-            // Remove any Runs with no remaining matches
-            log.Runs = log.Runs.Where(r => (r?.Results?.Count ?? 0) > 0).ToList();
+            return log;
+        }
 
-            w.Stop();
-            Console.WriteLine($"Found {matchCount:n0} of {originalTotal:n0} results matched in {w.Elapsed.TotalSeconds:n1}s.");
+        private SarifLog QueryIndex(QueryOptions options, IExpression expression, ref int originalTotal, ref int matchCount)
+        {
+            // Create an evaluator against the index rows for the Query
+            IExpressionEvaluator<ResultIndexRow> evaluator = WithThreads(expression.ToEvaluator<ResultIndexRow>(SarifEvaluators.ResultIndexRowEvaluator), options);
 
-            // Write to Output file, if caller requested
-            if (!string.IsNullOrEmpty(options.OutputFilePath) && (options.Force || !_fileSystem.FileExists(options.OutputFilePath)))
+            ResultIndex index = LoadOrRebuildIndex(options.InputFilePath);
+            SarifLog log = index.Log ?? new SarifLog();
+
+            // Only read Results from the log if they're going to be written somewhere
+            bool readMatches = options.WriteToConsole || !string.IsNullOrEmpty(options.OutputFilePath);
+
+            using (Stream stream = readMatches ? _fileSystem.FileOpenRead(options.InputFilePath) : null)
             {
-                Console.WriteLine($"Writing matches to {options.OutputFilePath}.");
-                WriteSarifFile<SarifLog>(_fileSystem, log, options.OutputFilePath, options.Minify);
+                for (int runIndex = 0; runIndex < index.Runs.Count; ++runIndex)
+                {
+                    ResultIndexRun indexRun = index.Runs[runIndex];
+                    Run run = log.Runs[runIndex];
+                    if (run == null || indexRun.Count == 0) { continue; }
+
+                    originalTotal += indexRun.Count;
+
+                    // Find matches for Results in the Run, from the index alone
+                    var matches = new BitArray(indexRun.Count);
+                    evaluator.Evaluate(ResultIndexRow.ForRun(indexRun), matches);
+
+                    matchCount += matches.TrueCount();
+
+                    if (!readMatches) { continue; }
+
+                    // Seek to and read only the matching Results
+                    var results = new List<Result>();
+                    for (int i = 0; i < matches.Length; ++i)
+                    {
+                        if (!matches[i]) { continue; }
+
+                        Result result = ResultIndexBuilder.ReadResult(stream, indexRun.ResultStarts[i]);
+                        result.Run = run;
+                        results.Add(result);
+                    }
+
+                    run.Results = results;
+
+                    if (options.WriteToConsole)
+                    {
+                        WriteToConsole(run.Results);
+                    }
+                }
             }
 
-            // Return exit code based on configuration
-            if (options.ReturnCount)
+            log.Runs = log.Runs ?? new List<Run>();
+            return log;
+        }
+
+        private ResultIndex LoadOrRebuildIndex(string inputFilePath)
+        {
+            ResultIndex index = null;
+            var w = Stopwatch.StartNew();
+
+            string indexPath = Path.ChangeExtension(inputFilePath, ".index.json");
+
+            if (_fileSystem.FileExists(indexPath) && _fileSystem.FileGetLastWriteTime(indexPath) > _fileSystem.FileGetLastWriteTime(inputFilePath))
             {
-                return matchCount;
+                // If the index exists and is up-to-date, just reload it
+                Console.WriteLine($"Loading Result Index \"{indexPath}\"...");
+                index = JsonConvert.DeserializeObject<ResultIndex>(_fileSystem.FileReadAllText(indexPath));
+
+                // Rebuild indices from other versions of the format, or for logs which have since changed length
+                if (index?.Version != ResultIndex.CurrentVersion || index.SourceLength != _fileSystem.FileInfoLength(inputFilePath))
+                {
+                    index = null;
+                }
             }
-            else if (options.NonZeroExitCodeIfCountOver >= 0 && matchCount > options.NonZeroExitCodeIfCountOver)
+
+            if (index == null)
             {
-                return TOO_MANY_RESULTS;
+                // Otherwise, build the index and save it
+                Console.WriteLine($"Building Result Index of \"{inputFilePath}\" into \"{indexPath}\"...");
+                index = ResultIndexBuilder.Build(() => _fileSystem.FileOpenRead(inputFilePath));
+                _fileSystem.FileWriteAllText(indexPath, JsonConvert.SerializeObject(index, Formatting.None));
             }
-            else
+
+            w.Stop();
+            Console.WriteLine($"Done in {w.Elapsed.TotalSeconds:n1}s.");
+
+            return index;
+        }
+
+        private static IExpressionEvaluator<T> WithThreads<T>(IExpressionEvaluator<T> evaluator, QueryOptions options)
+        {
+            // Evaluate in chunks across threads, unless the caller asked for one thread
+            return options.Threads == 1 ? evaluator : new ParallelEvaluator<T>(evaluator, options.Threads);
+        }
+
+        private static void WriteToConsole(IEnumerable<Result> results)
+        {
+            foreach (Result result in results)
             {
-                return SUCCESS;
+                Console.WriteLine(result.FormatForVisualStudio());
             }
         }
     }
@@ -58,6 +58,20 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             HelpText = "Produce compact JSON output rather than more readable, expanded form.")]
         public bool Minify { get; set; }
 
+        [Option(
+            "use-index",
+            Default = false,
+            HelpText = "Evaluate the expression using a result index saved beside the input file (building it if it is missing or out of date). " +
+                       "Repeated queries on the same file then read only the matching results. Used only when the expression refers to " +
+                       "BaselineState, IsSuppressed, Kind, Level, Rank, RuleId, or Uri.")]
+        public bool UseIndex { get; set; }
+
+        [Option(
+            "threads",
+            Default = 1,
+            HelpText = "A count of threads to evaluate the expression on, for runs with many results. Use 0 for one thread per processor.")]
+        public int Threads { get; set; } = 1;
+
         [Option(
             'o',
             "output",
@@ -8,6 +8,9 @@ using System.Linq;
 
 using Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching;
 using Microsoft.CodeAnalysis.Sarif.Driver;
+using Microsoft.CodeAnalysis.Sarif.Readers;
+
+using Newtonsoft.Json;
 
 namespace Microsoft.CodeAnalysis.Sarif.Multitool
 {
@@ -24,6 +27,11 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
         {
             try
             {
+                if (options.Streaming)
+                {
+                    return RunStreaming(options);
+                }
+
                 SarifLog baselineFile = null;
                 if (!string.IsNullOrEmpty(options.PreviousFilePath))
                 {
@@ -48,11 +56,22 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
                     currentSarifLogs.Add(ReadSarifFile<SarifLog>(_fileSystem, currentFilePath));
                 }
 
-                ISarifLogMatcher matcher = ResultMatchingBaselinerFactory.GetDefaultResultMatchingBaseliner();
+                BaselineCache baselineCache = null;
+                if (!string.IsNullOrEmpty(options.BaselineCachePath) && baselineFile != null)
+                {
+                    baselineCache = BaselineCache.Load(options.BaselineCachePath, _fileSystem);
+                }
+
+                ISarifLogMatcher matcher = ResultMatchingBaselinerFactory.GetDefaultResultMatchingBaseliner(oldAlgorithm: false, options.PartitionByArtifact, options.Threads, baselineCache, _fileSystem);
 
                 SarifLog output = matcher.Match(new SarifLog[] { baselineFile }, currentSarifLogs).First();
 
                 WriteSarifFile(_fileSystem, output, outputFilePath, options.Minify);
+
+                if (!string.IsNullOrEmpty(options.BaselineCachePath))
+                {
+                    BaselineCache.Create(output, _fileSystem).Save(options.BaselineCachePath, _fileSystem);
+                }
             }
             catch (Exception ex)
             {
@@ -62,5 +81,45 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
 
             return SUCCESS;
         }
+
+        private int RunStreaming(ResultMatchingOptions options)
+        {
+            if (options.CurrentFilePaths.Count() != 1)
+            {
+                Console.Error.WriteLine("--streaming requires exactly one current log.");
+                return FAILURE;
+            }
+
+            string currentFilePath = options.CurrentFilePaths.First();
+
+            string outputFilePath = options.OutputFilePath;
+            if (string.IsNullOrEmpty(outputFilePath))
+            {
+                outputFilePath = Path.GetFileNameWithoutExtension(options.PreviousFilePath) + "-annotated.sarif";
+            }
+
+            if (!DriverUtilities.ReportWhetherOutputFileCanBeCreated(outputFilePath, options.ForceOverwrite, _fileSystem))
+            {
+                return FAILURE;
+            }
+
+            // Deferred logs read each Result from disk on demand, so neither log's Results are ever all in memory.
+            // Mapping each log into memory makes reading matched Results back, out of file order, cheap.
+            using MemoryMappedStreamProvider baselineMapping = string.IsNullOrEmpty(options.PreviousFilePath) ? null : new MemoryMappedStreamProvider(options.PreviousFilePath, _fileSystem);
+            using var currentMapping = new MemoryMappedStreamProvider(currentFilePath, _fileSystem);
+
+            SarifLog baselineFile = baselineMapping == null ? null : SarifLog.LoadDeferred(baselineMapping);
+            SarifLog currentFile = SarifLog.LoadDeferred(currentMapping);
+
+            IStreamingSarifLogMatcher matcher = ResultMatchingBaselinerFactory.GetStreamingResultMatchingBaseliner(options.PartitionByArtifact, options.Threads);
+
+            using (var writer = new JsonTextWriter(new StreamWriter(_fileSystem.FileCreate(outputFilePath))))
+            {
+                writer.Formatting = options.Minify ? Formatting.None : Formatting.Indented;
+                matcher.Match(baselineFile, currentFile, writer);
+            }
+
+            return SUCCESS;
+        }
     }
 }
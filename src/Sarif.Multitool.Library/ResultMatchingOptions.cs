@@ -30,5 +30,20 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             "output-file-path",
             HelpText = "File path to output the annotated SARIF log with result matching information.  Defaults to <currentFile>-annotated.sarif")]
         public string OutputFilePath { get; set; }
+
+        [Option(
+            "partition-by-artifact",
+            HelpText = "Baseline each tool's results, and within each tool the results for each artifact, independently and in parallel (see --threads), comparing result properties by hash. Much faster for very large or many-tool logs; results which are near each other in different files may match differently.")]
+        public bool PartitionByArtifact { get; set; }
+
+        [Option(
+            "streaming",
+            HelpText = "Match a single current log against the previous log without loading either log's results into memory, writing the output log as results are matched. Each log must contain a single run.")]
+        public bool Streaming { get; set; }
+
+        [Option(
+            "baseline-cache",
+            HelpText = "Path to a cache of the previous baseline's results by artifact content hash. Results in files whose contents haven't changed are carried forward from the cache without heuristic matching; the cache is then rewritten for the output log. Not used with --streaming.")]
+        public string BaselineCachePath { get; set; }
     }
 }
@@ -0,0 +1,102 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+
+using Newtonsoft.Json;
+using Newtonsoft.Json.Linq;
+
+namespace Microsoft.CodeAnalysis.Sarif.Multitool
+{
+    /// <summary>
+    ///  ResultsSkippingJsonReader wraps a JsonTextReader over a SARIF log and presents every
+    ///  'runs[*].results' array as empty. Each result it hides is loaded, one at a time, and
+    ///  handed to a callback instead. Loading a JToken from this reader therefore produces the
+    ///  log with everything but its results, while the results stream past the caller without
+    ///  ever being held in memory together.
+    /// </summary>
+    /// <remarks>
+    ///  Line information is passed through from the underlying reader, so tokens loaded from
+    ///  this reader (and the result tokens handed to the callback) report their positions in
+    ///  the original file.
+    /// </remarks>
+    internal sealed class ResultsSkippingJsonReader : JsonReader, IJsonLineInfo
+    {
+        // Depth of a 'results' array: root object (0) > 'runs' (1) > run (2) > 'results' (3).
+        private const int ResultsArrayDepth = 3;
+
+        private static readonly JsonLoadSettings s_loadSettings = new JsonLoadSettings { LineInfoHandling = LineInfoHandling.Load };
+
+        private readonly JsonTextReader _reader;
+        private readonly Action<string, JToken> _resultLoaded;
+        private bool _atResultsArrayStart;
+
+        /// <param name="reader">
+        /// The reader over the SARIF log.
+        /// </param>
+        /// <param name="resultLoaded">
+        /// Called with the JSON path (for example, 'runs[0].results[12]') and the token of each
+        /// result, in document order.
+        /// </param>
+        public ResultsSkippingJsonReader(JsonTextReader reader, Action<string, JToken> resultLoaded)
+        {
+            _reader = reader ?? throw new ArgumentNullException(nameof(reader));
+            _resultLoaded = resultLoaded ?? throw new ArgumentNullException(nameof(resultLoaded));
+        }
+
+        public int LineNumber => _reader.LineNumber;
+
+        public int LinePosition => _reader.LinePosition;
+
+        public bool HasLineInfo() => _reader.HasLineInfo();
+
+        public override bool Read()
+        {
+            if (_atResultsArrayStart)
+            {
+                _atResultsArrayStart = false;
+                StreamResults();
+                SetToken(JsonToken.EndArray);
+                return true;
+            }
+
+            if (!_reader.Read())
+            {
+                SetToken(JsonToken.None);
+                return false;
+            }
+
+            if (_reader.TokenType == JsonToken.StartArray && _reader.Depth == ResultsArrayDepth && IsResultsArrayPath(_reader.Path))
+            {
+                _atResultsArrayStart = true;
+            }
+
+            SetToken(_reader.TokenType, _reader.Value);
+            return true;
+        }
+
+        public override void Close()
+        {
+            base.Close();
+            _reader.Close();
+        }
+
+        private void StreamResults()
+        {
+            string resultsPath = _reader.Path;
+            int index = 0;
+
+            while (_reader.Read() && _reader.TokenType != JsonToken.EndArray)
+            {
+                JToken result = JToken.Load(_reader, s_loadSettings);
+                _resultLoaded(resultsPath + "[" + index++ + "]", result);
+            }
+        }
+
+        private static bool IsResultsArrayPath(string path)
+        {
+            return path.StartsWith("runs[", StringComparison.Ordinal) &&
+                   path.EndsWith("]." + SarifPropertyName.Results, StringComparison.Ordinal);
+        }
+    }
+}
@@ -41,8 +41,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool.Rules
             else
             {
                 string regionPointer = physicalLocationPointer.AtProperty(SarifPropertyName.Region);
-                var jsonPointer = new JsonPointer(regionPointer);
-                JToken regionToken = jsonPointer.Evaluate(Context.InputLogToken);
+                JToken regionToken = Context.EvaluateJsonPointer(regionPointer);
                 Region region = physicalLocation.Region;
 
                 if (!region.IsBinaryRegion &&
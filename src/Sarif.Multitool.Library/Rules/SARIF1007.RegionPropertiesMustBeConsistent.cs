@@ -42,8 +42,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool.Rules
 
         protected override void Analyze(Region region, string regionPointer)
         {
-            var jsonPointer = new JsonPointer(regionPointer);
-            JToken regionToken = jsonPointer.Evaluate(Context.InputLogToken);
+            JToken regionToken = Context.EvaluateJsonPointer(regionPointer);
 
             if (!region.IsBinaryRegion &&
                 !region.IsLineColumnBasedTextRegion &&
@@ -4,8 +4,6 @@
 using System;
 using System.Collections.Generic;
 
-using Microsoft.Json.Pointer;
-
 using Newtonsoft.Json.Linq;
 
 namespace Microsoft.CodeAnalysis.Sarif.Multitool.Rules
@@ -45,8 +43,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool.Rules
 
             try
             {
-                var jsonPointer = new JsonPointer(jsonPointerString);
-                JToken resolved = jsonPointer.Evaluate(Context.InputLogToken);
+                JToken resolved = Context.EvaluateJsonPointer(jsonPointerString);
                 if (resolved == null)
                 {
                     LogResult(
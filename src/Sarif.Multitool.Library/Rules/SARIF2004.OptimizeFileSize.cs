@@ -120,7 +120,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool.Rules
             // on deserialization) from "the producer literally wrote 'index: -1' in
             // the JSON" (the bloat case we want to flag). We only fire when the
             // property is physically present in the input log token.
-            var objectToken = objectPointer.ToJToken(Context.InputLogToken);
+            var objectToken = Context.EvaluateJsonPointer(objectPointer);
             if (objectToken is JObject obj && obj.ContainsKey(propertyName))
             {
                 LogResult(
@@ -242,7 +242,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool.Rules
 
         private bool HasResultLocationsWithUriAndIndex(string resultPointer)
         {
-            var resultToken = resultPointer.ToJToken(Context.InputLogToken);
+            var resultToken = Context.EvaluateJsonPointer(resultPointer);
             return
                 resultToken.HasProperty(SarifPropertyName.Uri) &&
                 resultToken.HasProperty(SarifPropertyName.Index);
@@ -250,7 +250,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool.Rules
 
         private bool HasLocationOnlyArtifacts(string artifactPointer)
         {
-            var artifactToken = artifactPointer.ToJToken(Context.InputLogToken);
+            var artifactToken = Context.EvaluateJsonPointer(artifactPointer);
             return
                 artifactToken.HasProperty(SarifPropertyName.Location) &&
                 artifactToken.Children().Count() == 1;
@@ -292,7 +292,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool.Rules
 
         private bool HasIdOnlyRules(string rulePointer)
         {
-            var ruleToken = rulePointer.ToJToken(Context.InputLogToken);
+            var ruleToken = Context.EvaluateJsonPointer(rulePointer);
             return
                 ruleToken.HasProperty(SarifPropertyName.Id) &&
                 ruleToken.Children().Count() == 1;
@@ -2,7 +2,10 @@
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
 using System;
+using System.Collections.Concurrent;
 using System.Collections.Generic;
+using System.Diagnostics;
+using System.Reflection;
 using System.Resources;
 using System.Text;
 using System.Text.RegularExpressions;
@@ -53,7 +56,44 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool.Rules
 
             Context.InputLogToken = JToken.Parse(Context.InputLogContents);
 
-            Visit(Context.InputLog, logPointer: string.Empty);
+            new SinglePassVisitor(context, new[] { this }, disabledSkimmers: null, isolateFailures: false, measureRuleScanTimes: false).Analyze(Context.InputLog);
+        }
+
+        /// <summary>
+        /// Runs <paramref name="skimmers"/> against the log in <paramref name="context"/> in a
+        /// single walk of the log, rather than one walk per rule. Each rule's output is buffered
+        /// and replayed in the order of <paramref name="skimmers"/>, so the logged results are the
+        /// same as those produced by invoking <see cref="Analyze(SarifValidationContext)"/> on
+        /// each rule in turn. A rule that throws is reported and disabled, as in the driver.
+        /// </summary>
+        /// <param name="measureRuleScanTimes">
+        /// If true, the time spent in each rule is accumulated across the walk and returned.
+        /// </param>
+        /// <returns>
+        /// The time spent in each rule, in the order of <paramref name="skimmers"/>, if
+        /// <paramref name="measureRuleScanTimes"/> is true; otherwise null.
+        /// </returns>
+        public static TimeSpan[] AnalyzeInSinglePass(SarifValidationContext context,
+                                                     IList<SarifValidationSkimmerBase> skimmers,
+                                                     ISet<string> disabledSkimmers,
+                                                     bool measureRuleScanTimes = false)
+        {
+            if (context == null) { throw new ArgumentNullException(nameof(context)); }
+            if (skimmers == null) { throw new ArgumentNullException(nameof(skimmers)); }
+
+            if (skimmers.Count == 0) { return measureRuleScanTimes ? Array.Empty<TimeSpan>() : null; }
+
+            // In streaming mode, the caller has already supplied the log's token (without
+            // its results, which are read one at a time as the walk reaches them).
+            if (context.StreamedResults == null)
+            {
+                context.InputLogToken = JToken.Parse(context.InputLogContents);
+            }
+
+            var visitor = new SinglePassVisitor(context, skimmers, disabledSkimmers, isolateFailures: true, measureRuleScanTimes);
+            visitor.Analyze(context.InputLog);
+
+            return visitor.RuleScanTimes;
         }
 
         protected Result GetResult(string jPointer, string formatId, params string[] args)
@@ -332,978 +372,1626 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool.Rules
             return s_javaScriptIdentifierRegex.IsMatch(token);
         }
 
-        private void Visit(SarifLog log, string logPointer)
-        {
-            Analyze(log, logPointer);
-
-            if (log.Runs != null)
-            {
-                string runsPointer = logPointer.AtProperty(SarifPropertyName.Runs);
-
-                for (int i = 0; i < log.Runs.Count; ++i)
+        /// <summary>
+        /// Walks a SARIF log once on behalf of a set of validation rules. At each node, only the
+        /// rules that override the matching <c>Analyze</c> overload are invoked, and the node's
+        /// JSON pointer is materialized at most once, and only when some rule receives it.
+        /// </summary>
+        private sealed class SinglePassVisitor
+        {
+            private static readonly ConcurrentDictionary<Type, bool[]> s_overriddenNodeKindsByType = new ConcurrentDictionary<Type, bool[]>();
+
+            // The node types for which SarifValidationSkimmerBase declares an Analyze overload.
+            private static readonly Tuple<SarifNodeKind, Type>[] s_analyzableNodeKinds = new[]
+            {
+                Tuple.Create(SarifNodeKind.Address, typeof(Address)),
+                Tuple.Create(SarifNodeKind.Artifact, typeof(Artifact)),
+                Tuple.Create(SarifNodeKind.ArtifactChange, typeof(ArtifactChange)),
+                Tuple.Create(SarifNodeKind.ArtifactLocation, typeof(ArtifactLocation)),
+                Tuple.Create(SarifNodeKind.Attachment, typeof(Attachment)),
+                Tuple.Create(SarifNodeKind.CodeFlow, typeof(CodeFlow)),
+                Tuple.Create(SarifNodeKind.ConfigurationOverride, typeof(ConfigurationOverride)),
+                Tuple.Create(SarifNodeKind.Conversion, typeof(Conversion)),
+                Tuple.Create(SarifNodeKind.Edge, typeof(Edge)),
+                Tuple.Create(SarifNodeKind.EdgeTraversal, typeof(EdgeTraversal)),
+                Tuple.Create(SarifNodeKind.Graph, typeof(Graph)),
+                Tuple.Create(SarifNodeKind.GraphTraversal, typeof(GraphTraversal)),
+                Tuple.Create(SarifNodeKind.Invocation, typeof(Invocation)),
+                Tuple.Create(SarifNodeKind.Location, typeof(Location)),
+                Tuple.Create(SarifNodeKind.LogicalLocation, typeof(LogicalLocation)),
+                Tuple.Create(SarifNodeKind.Message, typeof(Message)),
+                Tuple.Create(SarifNodeKind.MultiformatMessageString, typeof(MultiformatMessageString)),
+                Tuple.Create(SarifNodeKind.Node, typeof(Node)),
+                Tuple.Create(SarifNodeKind.Notification, typeof(Notification)),
+                Tuple.Create(SarifNodeKind.PhysicalLocation, typeof(PhysicalLocation)),
+                Tuple.Create(SarifNodeKind.Rectangle, typeof(Rectangle)),
+                Tuple.Create(SarifNodeKind.Region, typeof(Region)),
+                Tuple.Create(SarifNodeKind.ReportingConfiguration, typeof(ReportingConfiguration)),
+                Tuple.Create(SarifNodeKind.ReportingDescriptor, typeof(ReportingDescriptor)),
+                Tuple.Create(SarifNodeKind.ReportingDescriptorReference, typeof(ReportingDescriptorReference)),
+                Tuple.Create(SarifNodeKind.ReportingDescriptorRelationship, typeof(ReportingDescriptorRelationship)),
+                Tuple.Create(SarifNodeKind.Result, typeof(Result)),
+                Tuple.Create(SarifNodeKind.ResultProvenance, typeof(ResultProvenance)),
+                Tuple.Create(SarifNodeKind.Run, typeof(Run)),
+                Tuple.Create(SarifNodeKind.SarifLog, typeof(SarifLog)),
+                Tuple.Create(SarifNodeKind.Stack, typeof(Stack)),
+                Tuple.Create(SarifNodeKind.StackFrame, typeof(StackFrame)),
+                Tuple.Create(SarifNodeKind.ThreadFlow, typeof(ThreadFlow)),
+                Tuple.Create(SarifNodeKind.ThreadFlowLocation, typeof(ThreadFlowLocation)),
+                Tuple.Create(SarifNodeKind.Tool, typeof(Tool)),
+                Tuple.Create(SarifNodeKind.ToolComponent, typeof(ToolComponent)),
+                Tuple.Create(SarifNodeKind.ToolComponentReference, typeof(ToolComponentReference)),
+                Tuple.Create(SarifNodeKind.VersionControlDetails, typeof(VersionControlDetails)),
+                Tuple.Create(SarifNodeKind.WebRequest, typeof(WebRequest)),
+                Tuple.Create(SarifNodeKind.WebResponse, typeof(WebResponse)),
+            };
+
+            private static readonly Action<SarifValidationSkimmerBase, Address, string> s_analyzeAddress = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, Artifact, string> s_analyzeArtifact = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, ArtifactChange, string> s_analyzeArtifactChange = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, ArtifactLocation, string> s_analyzeArtifactLocation = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, Attachment, string> s_analyzeAttachment = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, CodeFlow, string> s_analyzeCodeFlow = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, ConfigurationOverride, string> s_analyzeConfigurationOverride = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, Conversion, string> s_analyzeConversion = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, Edge, string> s_analyzeEdge = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, EdgeTraversal, string> s_analyzeEdgeTraversal = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, Graph, string> s_analyzeGraph = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, GraphTraversal, string> s_analyzeGraphTraversal = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, Invocation, string> s_analyzeInvocation = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, LogicalLocation, string> s_analyzeLogicalLocation = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, Message, string> s_analyzeMessage = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, MultiformatMessageString, string> s_analyzeMultiformatMessageString = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, Node, string> s_analyzeNode = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, Notification, string> s_analyzeNotification = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, PhysicalLocation, string> s_analyzePhysicalLocation = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, Rectangle, string> s_analyzeRectangle = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, Region, string> s_analyzeRegion = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, ReportingConfiguration, string> s_analyzeReportingConfiguration = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, ReportingDescriptor, string> s_analyzeReportingDescriptor = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, ReportingDescriptorReference, string> s_analyzeReportingDescriptorReference = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, ReportingDescriptorRelationship, string> s_analyzeReportingDescriptorRelationship = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, Result, string> s_analyzeResult = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, ResultProvenance, string> s_analyzeResultProvenance = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, Run, string> s_analyzeRun = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, SarifLog, string> s_analyzeSarifLog = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, Stack, string> s_analyzeStack = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, StackFrame, string> s_analyzeStackFrame = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, ThreadFlow, string> s_analyzeThreadFlow = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, ThreadFlowLocation, string> s_analyzeThreadFlowLocation = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, Tool, string> s_analyzeTool = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, ToolComponent, string> s_analyzeToolComponent = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, ToolComponentReference, string> s_analyzeToolComponentReference = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, VersionControlDetails, string> s_analyzeVersionControlDetails = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, WebRequest, string> s_analyzeWebRequest = (s, n, p) => s.Analyze(n, p);
+            private static readonly Action<SarifValidationSkimmerBase, WebResponse, string> s_analyzeWebResponse = (s, n, p) => s.Analyze(n, p);
+
+            private readonly SarifValidationContext _context;
+            private readonly IList<SarifValidationSkimmerBase> _skimmers;
+            private readonly int[][] _subscribersByNodeKind;
+            private readonly ISet<string> _disabledSkimmers;
+            private readonly RecordingLogger[] _loggers;
+            private readonly bool[] _faulted;
+            private readonly JsonPointerStack _pointer;
+            private readonly long[] _elapsedTicks;
+
+            /// <param name="isolateFailures">
+            /// If true, each rule logs into its own buffer and an exception raised by one rule
+            /// disables that rule for the remainder of the walk, as the driver does for skimmers
+            /// run one at a time. If false, exceptions propagate to the caller.
+            /// </param>
+            /// <param name="measureRuleScanTimes">
+            /// If true, the time spent in each rule's dispatches is accumulated in <see cref="RuleScanTimes"/>.
+            /// </param>
+            public SinglePassVisitor(SarifValidationContext context,
+                                     IList<SarifValidationSkimmerBase> skimmers,
+                                     ISet<string> disabledSkimmers,
+                                     bool isolateFailures,
+                                     bool measureRuleScanTimes)
+            {
+                _context = context;
+                _skimmers = skimmers;
+                _disabledSkimmers = disabledSkimmers;
+                _faulted = new bool[skimmers.Count];
+                _pointer = new JsonPointerStack();
+                _elapsedTicks = measureRuleScanTimes ? new long[skimmers.Count] : null;
+
+                var subscribers = new List<int>[Enum.GetValues(typeof(SarifNodeKind)).Length];
+                for (int i = 0; i < skimmers.Count; i++)
                 {
-                    Run run = log.Runs[i];
-                    Context.CurrentRun = run;
-                    Context.CurrentRunIndex = i;
+                    bool[] overriddenNodeKinds = s_overriddenNodeKindsByType.GetOrAdd(skimmers[i].GetType(), GetOverriddenNodeKinds);
 
-                    try
+                    for (int kind = 0; kind < overriddenNodeKinds.Length; kind++)
                     {
-                        Visit(run, runsPointer.AtIndex(i));
+                        if (overriddenNodeKinds[kind])
+                        {
+                            subscribers[kind] ??= new List<int>();
+                            subscribers[kind].Add(i);
+                        }
                     }
-                    finally
+                }
+
+                _subscribersByNodeKind = new int[subscribers.Length][];
+                for (int kind = 0; kind < subscribers.Length; kind++)
+                {
+                    _subscribersByNodeKind[kind] = subscribers[kind]?.ToArray() ?? Array.Empty<int>();
+                }
+
+                if (isolateFailures)
+                {
+                    _loggers = new RecordingLogger[skimmers.Count];
+                    for (int i = 0; i < skimmers.Count; i++)
                     {
-                        Context.CurrentRun = null;
-                        Context.CurrentRunIndex = -1;
+                        _loggers[i] = new RecordingLogger { FileRegionsCache = context.Logger?.FileRegionsCache };
                     }
                 }
             }
-        }
-
-        private void Visit(Address address, string addressPointer)
-        {
-            Analyze(address, addressPointer);
-        }
-
-        private void Visit(Artifact artifact, string artifactPointer)
-        {
-            Analyze(artifact, artifactPointer);
 
-            if (artifact.Location != null)
+            /// <summary>
+            /// The time spent in each rule over the walk, or null if it was not measured.
+            /// </summary>
+            public TimeSpan[] RuleScanTimes
             {
-                Visit(artifact.Location, artifactPointer.AtProperty(SarifPropertyName.Location));
-            }
-        }
+                get
+                {
+                    if (_elapsedTicks == null) { return null; }
 
-        private void Visit(ArtifactLocation artifactLocation, string artifactLocationPointer)
-        {
-            Analyze(artifactLocation, artifactLocationPointer);
-        }
+                    var ruleScanTimes = new TimeSpan[_elapsedTicks.Length];
+                    for (int i = 0; i < _elapsedTicks.Length; i++)
+                    {
+                        ruleScanTimes[i] = TimeSpan.FromTicks((long)(_elapsedTicks[i] * ((double)TimeSpan.TicksPerSecond / Stopwatch.Frequency)));
+                    }
 
-        private void Visit(ArtifactChange artifactChange, string artifactChangePointer)
-        {
-            Analyze(artifactChange, artifactChangePointer);
+                    return ruleScanTimes;
+                }
+            }
 
-            if (artifactChange.ArtifactLocation != null)
+            public void Analyze(SarifLog log)
             {
-                Visit(artifactChange.ArtifactLocation, artifactChangePointer.AtProperty(SarifPropertyName.ArtifactLocation));
-            }
-        }
+                IAnalysisLogger logger = _context.Logger;
+                s_context = _context;
 
-        private void Visit(Attachment attachment, string attachmentPointer)
-        {
-            Analyze(attachment, attachmentPointer);
+                try
+                {
+                    Visit(log);
+                }
+                finally
+                {
+                    _context.Logger = logger;
+                }
 
-            if (attachment.ArtifactLocation != null)
-            {
-                Visit(attachment.ArtifactLocation, attachmentPointer.AtProperty(SarifPropertyName.ArtifactLocation));
+                if (_loggers != null)
+                {
+                    // Replaying rule by rule reproduces the output order of running
+                    // each rule over the entire log in turn.
+                    foreach (RecordingLogger recordingLogger in _loggers)
+                    {
+                        recordingLogger.Replay(logger);
+                    }
+                }
             }
 
-            if (attachment.Description != null)
+            private static bool[] GetOverriddenNodeKinds(Type skimmerType)
             {
-                Visit(attachment.Description, attachmentPointer.AtProperty(SarifPropertyName.Description));
+                var overriddenNodeKinds = new bool[Enum.GetValues(typeof(SarifNodeKind)).Length];
+
+                foreach (Tuple<SarifNodeKind, Type> nodeKind in s_analyzableNodeKinds)
+                {
+                    MethodInfo method = skimmerType.GetMethod(nameof(Analyze),
+                                                              BindingFlags.Instance | BindingFlags.NonPublic,
+                                                              binder: null,
+                                                              new[] { nodeKind.Item2, typeof(string) },
+                                                              modifiers: null);
+
+                    overriddenNodeKinds[(int)nodeKind.Item1] = method != null && method.DeclaringType != typeof(SarifValidationSkimmerBase);
+                }
+
+                return overriddenNodeKinds;
             }
 
-            if (attachment.Regions != null)
+            private void Dispatch<T>(SarifNodeKind nodeKind, T node, Action<SarifValidationSkimmerBase, T, string> analyze)
             {
-                string regionsPointer = attachmentPointer.AtProperty(SarifPropertyName.Regions);
+                string pointer = null;
 
-                for (int i = 0; i < attachment.Regions.Count; ++i)
+                foreach (int i in _subscribersByNodeKind[(int)nodeKind])
                 {
-                    Visit(attachment.Regions[i], regionsPointer.AtIndex(i));
+                    if (_faulted[i]) { continue; }
+
+                    // As in the driver, cancellation is observed before each rule is invoked.
+                    _context.CancellationToken.ThrowIfCancellationRequested();
+
+                    // Every subscriber to this node shares one pointer string.
+                    pointer ??= _pointer.Current;
+
+                    SarifValidationSkimmerBase skimmer = _skimmers[i];
+                    _context.Rule = skimmer;
+
+                    if (_loggers == null)
+                    {
+                        analyze(skimmer, node, pointer);
+                        continue;
+                    }
+
+                    _context.Logger = _loggers[i];
+                    long start = _elapsedTicks != null ? Stopwatch.GetTimestamp() : 0;
+
+                    try
+                    {
+                        analyze(skimmer, node, pointer);
+                    }
+                    catch (Exception ex)
+                    {
+                        _faulted[i] = true;
+                        Errors.LogUnhandledRuleExceptionAnalyzingTarget(_disabledSkimmers, _context, ex);
+
+                        _context.RuntimeExceptions ??= new List<Exception>();
+                        _context.RuntimeExceptions.Add(ex);
+                    }
+
+                    if (_elapsedTicks != null)
+                    {
+                        _elapsedTicks[i] += Stopwatch.GetTimestamp() - start;
+                    }
                 }
             }
 
-            if (attachment.Rectangles != null)
+            private void Visit(SarifLog log)
             {
-                string rectangesPointer = attachmentPointer.AtProperty(SarifPropertyName.Rectangles);
+                Dispatch(SarifNodeKind.SarifLog, log, s_analyzeSarifLog);
 
-                for (int i = 0; i < attachment.Rectangles.Count; ++i)
+                if (log.Runs != null)
                 {
-                    Visit(attachment.Rectangles[i], rectangesPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Runs);
+
+                    for (int i = 0; i < log.Runs.Count; ++i)
+                    {
+                        Run run = log.Runs[i];
+                        _context.CurrentRun = run;
+                        _context.CurrentRunIndex = i;
+
+                        try
+                        {
+                            _pointer.PushIndex(i);
+                            Visit(run);
+                            _pointer.Pop();
+                        }
+                        finally
+                        {
+                            _context.CurrentRun = null;
+                            _context.CurrentRunIndex = -1;
+                        }
+                    }
+
+                    _pointer.Pop();
                 }
             }
-        }
-
-        private void Visit(CodeFlow codeFlow, string codeFlowPointer)
-        {
-            Analyze(codeFlow, codeFlowPointer);
 
-            if (codeFlow.Message != null)
+            private void Visit(Address address)
             {
-                Visit(codeFlow.Message, codeFlowPointer.AtProperty(SarifPropertyName.Message));
+                Dispatch(SarifNodeKind.Address, address, s_analyzeAddress);
             }
 
-            if (codeFlow.ThreadFlows != null)
+            private void Visit(Artifact artifact)
             {
-                string threadFlowsPointer = codeFlowPointer.AtProperty(SarifPropertyName.ThreadFlows);
+                Dispatch(SarifNodeKind.Artifact, artifact, s_analyzeArtifact);
 
-                for (int i = 0; i < codeFlow.ThreadFlows.Count; ++i)
+                if (artifact.Location != null)
                 {
-                    Visit(codeFlow.ThreadFlows[i], threadFlowsPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Location);
+                    Visit(artifact.Location);
+                    _pointer.Pop();
                 }
             }
-        }
-
-        private void Visit(ConfigurationOverride configurationOverride, string configurationOverridePointer)
-        {
-            Analyze(configurationOverride, configurationOverridePointer);
 
-            if (configurationOverride.Descriptor != null)
+            private void Visit(ArtifactLocation artifactLocation)
             {
-                Visit(configurationOverride.Descriptor, configurationOverridePointer.AtProperty(SarifPropertyName.Descriptor));
+                Dispatch(SarifNodeKind.ArtifactLocation, artifactLocation, s_analyzeArtifactLocation);
             }
 
-            if (configurationOverride.Configuration != null)
+            private void Visit(ArtifactChange artifactChange)
             {
-                Visit(configurationOverride.Configuration, configurationOverridePointer.AtProperty(SarifPropertyName.Configuration));
-            }
-        }
+                Dispatch(SarifNodeKind.ArtifactChange, artifactChange, s_analyzeArtifactChange);
 
-        private void Visit(Conversion conversion, string conversionPointer)
-        {
-            Analyze(conversion, conversionPointer);
+                if (artifactChange.ArtifactLocation != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.ArtifactLocation);
+                    Visit(artifactChange.ArtifactLocation);
+                    _pointer.Pop();
+                }
+            }
 
-            if (conversion.AnalysisToolLogFiles != null)
+            private void Visit(Attachment attachment)
             {
-                string analysisToolLogFilesPointer = conversionPointer.AtProperty(SarifPropertyName.AnalysisToolLogFiles);
+                Dispatch(SarifNodeKind.Attachment, attachment, s_analyzeAttachment);
 
-                for (int i = 0; i < conversion.AnalysisToolLogFiles.Count; ++i)
+                if (attachment.ArtifactLocation != null)
                 {
-                    Visit(conversion.AnalysisToolLogFiles[i], analysisToolLogFilesPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.ArtifactLocation);
+                    Visit(attachment.ArtifactLocation);
+                    _pointer.Pop();
                 }
-            }
-        }
 
-        private void Visit(Edge edge, string edgePointer)
-        {
-            Analyze(edge, edgePointer);
-        }
+                if (attachment.Description != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Description);
+                    Visit(attachment.Description);
+                    _pointer.Pop();
+                }
 
-        private void Visit(EdgeTraversal edgeTraversal, string edgeTraversalPointer)
-        {
-            Analyze(edgeTraversal, edgeTraversalPointer);
+                if (attachment.Regions != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Regions);
 
-            if (edgeTraversal.Message != null)
-            {
-                Visit(edgeTraversal.Message, edgeTraversalPointer.AtProperty(SarifPropertyName.Message));
-            }
-        }
+                    for (int i = 0; i < attachment.Regions.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(attachment.Regions[i]);
+                        _pointer.Pop();
+                    }
 
-        private void Visit(Fix fix, string fixPointer)
-        {
-            if (fix.Description != null)
-            {
-                Visit(fix.Description, fixPointer.AtProperty(SarifPropertyName.Description));
+                    _pointer.Pop();
+                }
+
+                if (attachment.Rectangles != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Rectangles);
+
+                    for (int i = 0; i < attachment.Rectangles.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(attachment.Rectangles[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
+                }
             }
 
-            if (fix.ArtifactChanges != null)
+            private void Visit(CodeFlow codeFlow)
             {
-                string fileChangesPointer = fixPointer.AtProperty(SarifPropertyName.ArtifactChanges);
+                Dispatch(SarifNodeKind.CodeFlow, codeFlow, s_analyzeCodeFlow);
 
-                for (int i = 0; i < fix.ArtifactChanges.Count; ++i)
+                if (codeFlow.Message != null)
                 {
-                    Visit(fix.ArtifactChanges[i], fileChangesPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Message);
+                    Visit(codeFlow.Message);
+                    _pointer.Pop();
                 }
-            }
-        }
-        private void Visit(Graph graph, string graphPointer)
-        {
-            Analyze(graph, graphPointer);
 
-            if (graph.Description != null)
-            {
-                Visit(graph.Description, graphPointer.AtProperty(SarifPropertyName.Description));
+                if (codeFlow.ThreadFlows != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.ThreadFlows);
+
+                    for (int i = 0; i < codeFlow.ThreadFlows.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(codeFlow.ThreadFlows[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
+                }
             }
 
-            if (graph.Edges != null)
+            private void Visit(ConfigurationOverride configurationOverride)
             {
-                string edgesPointer = graphPointer.AtProperty(SarifPropertyName.Edges);
+                Dispatch(SarifNodeKind.ConfigurationOverride, configurationOverride, s_analyzeConfigurationOverride);
+
+                if (configurationOverride.Descriptor != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Descriptor);
+                    Visit(configurationOverride.Descriptor);
+                    _pointer.Pop();
+                }
 
-                for (int i = 0; i < graph.Edges.Count; ++i)
+                if (configurationOverride.Configuration != null)
                 {
-                    Visit(graph.Edges[i], edgesPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Configuration);
+                    Visit(configurationOverride.Configuration);
+                    _pointer.Pop();
                 }
             }
 
-            if (graph.Nodes != null)
+            private void Visit(Conversion conversion)
             {
-                string nodesPointer = graphPointer.AtProperty(SarifPropertyName.Nodes);
+                Dispatch(SarifNodeKind.Conversion, conversion, s_analyzeConversion);
 
-                for (int i = 0; i < graph.Nodes.Count; ++i)
+                if (conversion.AnalysisToolLogFiles != null)
                 {
-                    Visit(graph.Nodes[i], nodesPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.AnalysisToolLogFiles);
+
+                    for (int i = 0; i < conversion.AnalysisToolLogFiles.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(conversion.AnalysisToolLogFiles[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
                 }
             }
-        }
-
-        private void Visit(GraphTraversal graphTraversal, string graphTraversalPointer)
-        {
-            Analyze(graphTraversal, graphTraversalPointer);
 
-            if (graphTraversal.Description != null)
+            private void Visit(Edge edge)
             {
-                Visit(graphTraversal.Description, graphTraversalPointer.AtProperty(SarifPropertyName.Description));
+                Dispatch(SarifNodeKind.Edge, edge, s_analyzeEdge);
             }
 
-            if (graphTraversal.EdgeTraversals != null)
+            private void Visit(EdgeTraversal edgeTraversal)
             {
-                string edgeTraversalsPointer = graphTraversalPointer.AtProperty(SarifPropertyName.EdgeTraversals);
+                Dispatch(SarifNodeKind.EdgeTraversal, edgeTraversal, s_analyzeEdgeTraversal);
 
-                for (int i = 0; i < graphTraversal.EdgeTraversals.Count; ++i)
+                if (edgeTraversal.Message != null)
                 {
-                    Visit(graphTraversal.EdgeTraversals[i], edgeTraversalsPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Message);
+                    Visit(edgeTraversal.Message);
+                    _pointer.Pop();
                 }
             }
-        }
-
-        private void Visit(Invocation invocation, string invocationPointer)
-        {
-            Analyze(invocation, invocationPointer);
-
-            if (invocation.ExecutableLocation != null)
-            {
-                Visit(invocation.ExecutableLocation, invocationPointer.AtProperty(SarifPropertyName.ExecutableLocation));
-            }
 
-            if (invocation.NotificationConfigurationOverrides != null)
+            private void Visit(Fix fix)
             {
-                string notificationConfigurationOverridesPointer = invocationPointer.AtProperty(SarifPropertyName.NotificationConfigurationOverrides);
-                Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Notification;
+                if (fix.Description != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Description);
+                    Visit(fix.Description);
+                    _pointer.Pop();
+                }
 
-                try
+                if (fix.ArtifactChanges != null)
                 {
-                    for (int i = 0; i < invocation.NotificationConfigurationOverrides.Count; ++i)
+                    _pointer.PushProperty(SarifPropertyName.ArtifactChanges);
+
+                    for (int i = 0; i < fix.ArtifactChanges.Count; ++i)
                     {
-                        Visit(invocation.NotificationConfigurationOverrides[i], notificationConfigurationOverridesPointer.AtIndex(i));
+                        _pointer.PushIndex(i);
+                        Visit(fix.ArtifactChanges[i]);
+                        _pointer.Pop();
                     }
-                }
-                finally
-                {
-                    Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
+
+                    _pointer.Pop();
                 }
             }
-
-            if (invocation.ResponseFiles != null)
+            private void Visit(Graph graph)
             {
-                string responseFilesPointer = invocationPointer.AtProperty(SarifPropertyName.ResponseFiles);
+                Dispatch(SarifNodeKind.Graph, graph, s_analyzeGraph);
 
-                for (int i = 0; i < invocation.ResponseFiles.Count; ++i)
+                if (graph.Description != null)
                 {
-                    Visit(invocation.ResponseFiles[i], responseFilesPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Description);
+                    Visit(graph.Description);
+                    _pointer.Pop();
                 }
-            }
 
-            if (invocation.RuleConfigurationOverrides != null)
-            {
-                string ruleConfigurationOverridesPointer = invocationPointer.AtProperty(SarifPropertyName.RuleConfigurationOverrides);
-                Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Rule;
-
-                try
+                if (graph.Edges != null)
                 {
-                    for (int i = 0; i < invocation.RuleConfigurationOverrides.Count; ++i)
+                    _pointer.PushProperty(SarifPropertyName.Edges);
+
+                    for (int i = 0; i < graph.Edges.Count; ++i)
                     {
-                        Visit(invocation.RuleConfigurationOverrides[i], ruleConfigurationOverridesPointer.AtIndex(i));
+                        _pointer.PushIndex(i);
+                        Visit(graph.Edges[i]);
+                        _pointer.Pop();
                     }
+
+                    _pointer.Pop();
                 }
-                finally
+
+                if (graph.Nodes != null)
                 {
-                    Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
-                }
-            }
+                    _pointer.PushProperty(SarifPropertyName.Nodes);
 
-            if (invocation.Stdin != null)
-            {
-                Visit(invocation.Stdin, invocationPointer.AtProperty(SarifPropertyName.Stdin));
-            }
+                    for (int i = 0; i < graph.Nodes.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(graph.Nodes[i]);
+                        _pointer.Pop();
+                    }
 
-            if (invocation.Stdout != null)
-            {
-                Visit(invocation.Stdout, invocationPointer.AtProperty(SarifPropertyName.Stdout));
+                    _pointer.Pop();
+                }
             }
 
-            if (invocation.Stderr != null)
+            private void Visit(GraphTraversal graphTraversal)
             {
-                Visit(invocation.Stderr, invocationPointer.AtProperty(SarifPropertyName.Stderr));
-            }
+                Dispatch(SarifNodeKind.GraphTraversal, graphTraversal, s_analyzeGraphTraversal);
 
-            if (invocation.StdoutStderr != null)
-            {
-                Visit(invocation.StdoutStderr, invocationPointer.AtProperty(SarifPropertyName.StdoutStderr));
-            }
+                if (graphTraversal.Description != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Description);
+                    Visit(graphTraversal.Description);
+                    _pointer.Pop();
+                }
 
-            if (invocation.ToolExecutionNotifications != null)
-            {
-                Visit(invocation.ToolExecutionNotifications, invocationPointer, SarifPropertyName.ToolExecutionNotifications);
-            }
+                if (graphTraversal.EdgeTraversals != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.EdgeTraversals);
 
-            if (invocation.ToolConfigurationNotifications != null)
-            {
-                Visit(invocation.ToolConfigurationNotifications, invocationPointer, SarifPropertyName.ToolConfigurationNotifications);
-            }
-        }
+                    for (int i = 0; i < graphTraversal.EdgeTraversals.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(graphTraversal.EdgeTraversals[i]);
+                        _pointer.Pop();
+                    }
 
-        private void Visit(Location location, string locationPointer)
-        {
-            if (location.Message != null)
-            {
-                Visit(location.Message, locationPointer.AtProperty(SarifPropertyName.Message));
+                    _pointer.Pop();
+                }
             }
 
-            if (location.PhysicalLocation != null)
+            private void Visit(Invocation invocation)
             {
-                Visit(location.PhysicalLocation, locationPointer.AtProperty(SarifPropertyName.PhysicalLocation));
-            }
+                Dispatch(SarifNodeKind.Invocation, invocation, s_analyzeInvocation);
 
-            if (location.LogicalLocations != null)
-            {
-                string logicalLocationsPointer = locationPointer.AtProperty(SarifPropertyName.LogicalLocations);
+                if (invocation.ExecutableLocation != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.ExecutableLocation);
+                    Visit(invocation.ExecutableLocation);
+                    _pointer.Pop();
+                }
 
-                for (int i = 0; i < location.LogicalLocations.Count; ++i)
+                if (invocation.NotificationConfigurationOverrides != null)
                 {
-                    Visit(location.LogicalLocations[i], logicalLocationsPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.NotificationConfigurationOverrides);
+                    _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Notification;
+
+                    try
+                    {
+                        for (int i = 0; i < invocation.NotificationConfigurationOverrides.Count; ++i)
+                        {
+                            _pointer.PushIndex(i);
+                            Visit(invocation.NotificationConfigurationOverrides[i]);
+                            _pointer.Pop();
+                        }
+                    }
+                    finally
+                    {
+                        _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
+                    }
+
+                    _pointer.Pop();
                 }
-            }
-        }
 
-        private void Visit(LogicalLocation logicalLocation, string logicalLocationPointer)
-        {
-            Analyze(logicalLocation, logicalLocationPointer);
-        }
+                if (invocation.ResponseFiles != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.ResponseFiles);
 
-        private void Visit(Message message, string messagePointer)
-        {
-            Analyze(message, messagePointer);
-        }
+                    for (int i = 0; i < invocation.ResponseFiles.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(invocation.ResponseFiles[i]);
+                        _pointer.Pop();
+                    }
 
-        private void Visit(MultiformatMessageString multiformatMessageString, string multiformatMessageStringPointer)
-        {
-            Analyze(multiformatMessageString, multiformatMessageStringPointer);
-        }
+                    _pointer.Pop();
+                }
 
-        private void Visit(Node node, string nodePointer)
-        {
-            Analyze(node, nodePointer);
+                if (invocation.RuleConfigurationOverrides != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.RuleConfigurationOverrides);
+                    _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Rule;
 
-            if (node.Location != null)
-            {
-                Visit(node.Location, nodePointer.AtProperty(SarifPropertyName.Location));
-            }
-        }
+                    try
+                    {
+                        for (int i = 0; i < invocation.RuleConfigurationOverrides.Count; ++i)
+                        {
+                            _pointer.PushIndex(i);
+                            Visit(invocation.RuleConfigurationOverrides[i]);
+                            _pointer.Pop();
+                        }
+                    }
+                    finally
+                    {
+                        _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
+                    }
 
-        private void Visit(Notification notification, string notificationPointer)
-        {
-            Analyze(notification, notificationPointer);
+                    _pointer.Pop();
+                }
 
-            if (notification.AssociatedRule != null)
-            {
-                Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Rule;
-                try
+                if (invocation.Stdin != null)
                 {
-                    Visit(notification.AssociatedRule, notificationPointer.AtProperty(SarifPropertyName.AssociatedRule));
+                    _pointer.PushProperty(SarifPropertyName.Stdin);
+                    Visit(invocation.Stdin);
+                    _pointer.Pop();
                 }
-                finally
+
+                if (invocation.Stdout != null)
                 {
-                    Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
+                    _pointer.PushProperty(SarifPropertyName.Stdout);
+                    Visit(invocation.Stdout);
+                    _pointer.Pop();
                 }
-            }
 
-            if (notification.Descriptor != null)
-            {
-                Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Notification;
-                try
+                if (invocation.Stderr != null)
                 {
-                    Visit(notification.Descriptor, notificationPointer.AtProperty(SarifPropertyName.Descriptor));
+                    _pointer.PushProperty(SarifPropertyName.Stderr);
+                    Visit(invocation.Stderr);
+                    _pointer.Pop();
                 }
-                finally
+
+                if (invocation.StdoutStderr != null)
                 {
-                    Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
+                    _pointer.PushProperty(SarifPropertyName.StdoutStderr);
+                    Visit(invocation.StdoutStderr);
+                    _pointer.Pop();
                 }
-            }
 
-            if (notification.Message != null)
-            {
-                Visit(notification.Message, notificationPointer.AtProperty(SarifPropertyName.Message));
+                if (invocation.ToolExecutionNotifications != null)
+                {
+                    Visit(invocation.ToolExecutionNotifications, SarifPropertyName.ToolExecutionNotifications);
+                }
+
+                if (invocation.ToolConfigurationNotifications != null)
+                {
+                    Visit(invocation.ToolConfigurationNotifications, SarifPropertyName.ToolConfigurationNotifications);
+                }
             }
 
-            if (notification.Locations != null)
+            private void Visit(Location location)
             {
-                string locationsPointer = notificationPointer.AtProperty(SarifPropertyName.Locations);
+                if (location.Message != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Message);
+                    Visit(location.Message);
+                    _pointer.Pop();
+                }
 
-                for (int i = 0; i < notification.Locations.Count; ++i)
+                if (location.PhysicalLocation != null)
                 {
-                    Visit(notification.Locations[i], locationsPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.PhysicalLocation);
+                    Visit(location.PhysicalLocation);
+                    _pointer.Pop();
                 }
-            }
-        }
 
-        private void Visit(PhysicalLocation physicalLocation, string physicalLocationPointer)
-        {
-            Analyze(physicalLocation, physicalLocationPointer);
+                if (location.LogicalLocations != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.LogicalLocations);
 
-            if (physicalLocation.Address != null)
-            {
-                Visit(physicalLocation.Address, physicalLocationPointer.AtProperty(SarifPropertyName.Address));
+                    for (int i = 0; i < location.LogicalLocations.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(location.LogicalLocations[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
+                }
             }
 
-            if (physicalLocation.ArtifactLocation != null)
+            private void Visit(LogicalLocation logicalLocation)
             {
-                Visit(physicalLocation.ArtifactLocation, physicalLocationPointer.AtProperty(SarifPropertyName.ArtifactLocation));
+                Dispatch(SarifNodeKind.LogicalLocation, logicalLocation, s_analyzeLogicalLocation);
             }
 
-            if (physicalLocation.Region != null)
+            private void Visit(Message message)
             {
-                Visit(physicalLocation.Region, physicalLocationPointer.AtProperty(SarifPropertyName.Region));
+                Dispatch(SarifNodeKind.Message, message, s_analyzeMessage);
             }
-        }
 
-        private void Visit(Rectangle rectangle, string rectanglePointer)
-        {
-            if (rectangle.Message != null)
+            private void Visit(MultiformatMessageString multiformatMessageString)
             {
-                Visit(rectangle.Message, rectanglePointer.AtProperty(SarifPropertyName.Message));
+                Dispatch(SarifNodeKind.MultiformatMessageString, multiformatMessageString, s_analyzeMultiformatMessageString);
             }
 
-            Analyze(rectangle, rectanglePointer);
-        }
-
-        private void Visit(Region region, string regionPointer)
-        {
-            if (region.Message != null)
+            private void Visit(Node node)
             {
-                Visit(region.Message, regionPointer.AtProperty(SarifPropertyName.Message));
+                Dispatch(SarifNodeKind.Node, node, s_analyzeNode);
+
+                if (node.Location != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Location);
+                    Visit(node.Location);
+                    _pointer.Pop();
+                }
             }
 
-            Analyze(region, regionPointer);
-        }
-
-        private void Visit(ReportingConfiguration reportingConfiguration, string reportingConfigurationPointer)
-        {
-            Analyze(reportingConfiguration, reportingConfigurationPointer);
-        }
-
-        private void Visit(ReportingDescriptor reportingDescriptor, string reportingDescriptorPointer)
-        {
-            Analyze(reportingDescriptor, reportingDescriptorPointer);
-
-            if (reportingDescriptor.ShortDescription != null)
+            private void Visit(Notification notification)
             {
-                Visit(reportingDescriptor.ShortDescription, reportingDescriptorPointer.AtProperty(SarifPropertyName.ShortDescription));
-            }
+                Dispatch(SarifNodeKind.Notification, notification, s_analyzeNotification);
 
-            if (reportingDescriptor.FullDescription != null)
-            {
-                Visit(reportingDescriptor.FullDescription, reportingDescriptorPointer.AtProperty(SarifPropertyName.FullDescription));
-            }
-
-            if (reportingDescriptor.Relationships != null)
-            {
-                string relationshipsPointer = reportingDescriptorPointer.AtProperty(SarifPropertyName.Relationships);
+                if (notification.AssociatedRule != null)
+                {
+                    _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Rule;
+                    try
+                    {
+                        _pointer.PushProperty(SarifPropertyName.AssociatedRule);
+                        Visit(notification.AssociatedRule);
+                        _pointer.Pop();
+                    }
+                    finally
+                    {
+                        _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
+                    }
+                }
 
-                for (int i = 0; i < reportingDescriptor.Relationships.Count; ++i)
+                if (notification.Descriptor != null)
                 {
-                    Visit(reportingDescriptor.Relationships[i], relationshipsPointer.AtIndex(i));
+                    _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Notification;
+                    try
+                    {
+                        _pointer.PushProperty(SarifPropertyName.Descriptor);
+                        Visit(notification.Descriptor);
+                        _pointer.Pop();
+                    }
+                    finally
+                    {
+                        _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
+                    }
                 }
-            }
-        }
 
-        private void Visit(ReportingDescriptorReference reportingDescriptorReference, string reportingDescriptorReferencePointer)
-        {
-            Analyze(reportingDescriptorReference, reportingDescriptorReferencePointer);
+                if (notification.Message != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Message);
+                    Visit(notification.Message);
+                    _pointer.Pop();
+                }
 
-            if (reportingDescriptorReference.ToolComponent != null)
-            {
-                Visit(reportingDescriptorReference.ToolComponent, reportingDescriptorReferencePointer.AtProperty(SarifPropertyName.ToolComponent));
-            }
-        }
+                if (notification.Locations != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Locations);
 
-        private void Visit(ReportingDescriptorRelationship reportingDescriptorRelationship, string reportingDescriptorRelationshipPointer)
-        {
-            Analyze(reportingDescriptorRelationship, reportingDescriptorRelationshipPointer);
+                    for (int i = 0; i < notification.Locations.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(notification.Locations[i]);
+                        _pointer.Pop();
+                    }
 
-            if (reportingDescriptorRelationship.Description != null)
-            {
-                Visit(reportingDescriptorRelationship.Description, reportingDescriptorRelationshipPointer.AtProperty(SarifPropertyName.Description));
+                    _pointer.Pop();
+                }
             }
 
-            if (reportingDescriptorRelationship.Target != null)
+            private void Visit(PhysicalLocation physicalLocation)
             {
-                Visit(reportingDescriptorRelationship.Target, reportingDescriptorRelationshipPointer.AtProperty(SarifPropertyName.Target));
-            }
-        }
+                Dispatch(SarifNodeKind.PhysicalLocation, physicalLocation, s_analyzePhysicalLocation);
 
-        private void Visit(Result result, string resultPointer)
-        {
-            Analyze(result, resultPointer);
-
-            if (result.AnalysisTarget != null)
-            {
-                Visit(result.AnalysisTarget, resultPointer.AtProperty(SarifPropertyName.AnalysisTarget));
-            }
+                if (physicalLocation.Address != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Address);
+                    Visit(physicalLocation.Address);
+                    _pointer.Pop();
+                }
 
-            if (result.Attachments != null)
-            {
-                string attachmentsPointer = resultPointer.AtProperty(SarifPropertyName.Attachments);
+                if (physicalLocation.ArtifactLocation != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.ArtifactLocation);
+                    Visit(physicalLocation.ArtifactLocation);
+                    _pointer.Pop();
+                }
 
-                for (int i = 0; i < result.Attachments.Count; ++i)
+                if (physicalLocation.Region != null)
                 {
-                    Visit(result.Attachments[i], attachmentsPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Region);
+                    Visit(physicalLocation.Region);
+                    _pointer.Pop();
                 }
             }
 
-            if (result.Locations != null)
+            private void Visit(Rectangle rectangle)
             {
-                string locationsPointer = resultPointer.AtProperty(SarifPropertyName.Locations);
-
-                for (int i = 0; i < result.Locations.Count; ++i)
+                if (rectangle.Message != null)
                 {
-                    Visit(result.Locations[i], locationsPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Message);
+                    Visit(rectangle.Message);
+                    _pointer.Pop();
                 }
+
+                Dispatch(SarifNodeKind.Rectangle, rectangle, s_analyzeRectangle);
             }
 
-            if (result.CodeFlows != null)
+            private void Visit(Region region)
             {
-                string codeFlowsPointer = resultPointer.AtProperty(SarifPropertyName.CodeFlows);
-
-                for (int i = 0; i < result.CodeFlows.Count; ++i)
+                if (region.Message != null)
                 {
-                    Visit(result.CodeFlows[i], codeFlowsPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Message);
+                    Visit(region.Message);
+                    _pointer.Pop();
                 }
+
+                Dispatch(SarifNodeKind.Region, region, s_analyzeRegion);
             }
 
-            if (result.Provenance != null)
+            private void Visit(ReportingConfiguration reportingConfiguration)
             {
-                Visit(result.Provenance, resultPointer.AtProperty(SarifPropertyName.Provenance));
+                Dispatch(SarifNodeKind.ReportingConfiguration, reportingConfiguration, s_analyzeReportingConfiguration);
             }
 
-            if (result.Rule != null)
+            private void Visit(ReportingDescriptor reportingDescriptor)
             {
-                Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Rule;
-                try
+                Dispatch(SarifNodeKind.ReportingDescriptor, reportingDescriptor, s_analyzeReportingDescriptor);
+
+                if (reportingDescriptor.ShortDescription != null)
                 {
-                    Visit(result.Rule, resultPointer.AtProperty(SarifPropertyName.Rule));
+                    _pointer.PushProperty(SarifPropertyName.ShortDescription);
+                    Visit(reportingDescriptor.ShortDescription);
+                    _pointer.Pop();
                 }
-                finally
+
+                if (reportingDescriptor.FullDescription != null)
                 {
-                    Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
+                    _pointer.PushProperty(SarifPropertyName.FullDescription);
+                    Visit(reportingDescriptor.FullDescription);
+                    _pointer.Pop();
                 }
-            }
-
-            if (result.Graphs != null)
-            {
-                string graphsPointer = resultPointer.AtProperty(SarifPropertyName.Graphs);
 
-                for (int i = 0; i < result.Graphs.Count; ++i)
+                if (reportingDescriptor.Relationships != null)
                 {
-                    Visit(result.Graphs[i], graphsPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Relationships);
+
+                    for (int i = 0; i < reportingDescriptor.Relationships.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(reportingDescriptor.Relationships[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
                 }
             }
 
-            if (result.GraphTraversals != null)
+            private void Visit(ReportingDescriptorReference reportingDescriptorReference)
             {
-                string graphTraversalsPointer = resultPointer.AtProperty(SarifPropertyName.GraphTraversals);
+                Dispatch(SarifNodeKind.ReportingDescriptorReference, reportingDescriptorReference, s_analyzeReportingDescriptorReference);
 
-                for (int i = 0; i < result.GraphTraversals.Count; ++i)
+                if (reportingDescriptorReference.ToolComponent != null)
                 {
-                    Visit(result.GraphTraversals[i], graphTraversalsPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.ToolComponent);
+                    Visit(reportingDescriptorReference.ToolComponent);
+                    _pointer.Pop();
                 }
             }
 
-            if (result.Message != null)
+            private void Visit(ReportingDescriptorRelationship reportingDescriptorRelationship)
             {
-                Visit(result.Message, resultPointer.AtProperty(SarifPropertyName.Message));
-            }
+                Dispatch(SarifNodeKind.ReportingDescriptorRelationship, reportingDescriptorRelationship, s_analyzeReportingDescriptorRelationship);
 
-            if (result.Stacks != null)
-            {
-                string stacksPointer = resultPointer.AtProperty(SarifPropertyName.Stacks);
+                if (reportingDescriptorRelationship.Description != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Description);
+                    Visit(reportingDescriptorRelationship.Description);
+                    _pointer.Pop();
+                }
 
-                for (int i = 0; i < result.Stacks.Count; ++i)
+                if (reportingDescriptorRelationship.Target != null)
                 {
-                    Visit(result.Stacks[i], stacksPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Target);
+                    Visit(reportingDescriptorRelationship.Target);
+                    _pointer.Pop();
                 }
             }
 
-            if (result.RelatedLocations != null)
+            private void Visit(Result result)
             {
-                string relatedLocationsPointer = resultPointer.AtProperty(SarifPropertyName.RelatedLocations);
+                Dispatch(SarifNodeKind.Result, result, s_analyzeResult);
 
-                for (int i = 0; i < result.RelatedLocations.Count; ++i)
+                if (result.AnalysisTarget != null)
                 {
-                    Visit(result.RelatedLocations[i], relatedLocationsPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.AnalysisTarget);
+                    Visit(result.AnalysisTarget);
+                    _pointer.Pop();
                 }
-            }
 
-            if (result.Fixes != null)
-            {
-                string fixesPointer = resultPointer.AtProperty(SarifPropertyName.Fixes);
+                if (result.Attachments != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Attachments);
+
+                    for (int i = 0; i < result.Attachments.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(result.Attachments[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
+                }
 
-                for (int i = 0; i < result.Fixes.Count; ++i)
+                if (result.Locations != null)
                 {
-                    Visit(result.Fixes[i], fixesPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Locations);
+
+                    for (int i = 0; i < result.Locations.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(result.Locations[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
                 }
-            }
 
-            if (result.Taxa != null)
-            {
-                string taxaPointer = resultPointer.AtProperty(SarifPropertyName.Taxa);
+                if (result.CodeFlows != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.CodeFlows);
 
-                Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Taxon;
-                try
+                    for (int i = 0; i < result.CodeFlows.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(result.CodeFlows[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
+                }
+
+                if (result.Provenance != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Provenance);
+                    Visit(result.Provenance);
+                    _pointer.Pop();
+                }
+
+                if (result.Rule != null)
                 {
-                    for (int i = 0; i < result.Taxa.Count; ++i)
+                    _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Rule;
+                    try
                     {
-                        Visit(result.Taxa[i], taxaPointer.AtIndex(i));
+                        _pointer.PushProperty(SarifPropertyName.Rule);
+                        Visit(result.Rule);
+                        _pointer.Pop();
+                    }
+                    finally
+                    {
+                        _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
                     }
                 }
-                finally
+
+                if (result.Graphs != null)
                 {
-                    Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
+                    _pointer.PushProperty(SarifPropertyName.Graphs);
+
+                    for (int i = 0; i < result.Graphs.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(result.Graphs[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
                 }
-            }
 
-            if (result.WebRequest != null)
-            {
-                Visit(result.WebRequest, resultPointer.AtProperty(SarifPropertyName.WebRequest));
-            }
+                if (result.GraphTraversals != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.GraphTraversals);
 
-            if (result.WebResponse != null)
-            {
-                Visit(result.WebResponse, resultPointer.AtProperty(SarifPropertyName.WebResponse));
-            }
-        }
+                    for (int i = 0; i < result.GraphTraversals.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(result.GraphTraversals[i]);
+                        _pointer.Pop();
+                    }
 
-        private void Visit(IList<Notification> notifications, string parentPointer, string propertyName)
-        {
-            string notificationsPointer = parentPointer.AtProperty(propertyName);
+                    _pointer.Pop();
+                }
 
-            for (int i = 0; i < notifications.Count; ++i)
-            {
-                Visit(notifications[i], notificationsPointer.AtIndex(i));
-            }
-        }
+                if (result.Message != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Message);
+                    Visit(result.Message);
+                    _pointer.Pop();
+                }
 
-        private void Visit(ResultProvenance resultProvenance, string resultProvenancePointer)
-        {
-            Analyze(resultProvenance, resultProvenancePointer);
+                if (result.Stacks != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Stacks);
 
-            if (resultProvenance.ConversionSources != null)
-            {
-                string conversionSourcesPointer = resultProvenancePointer.AtProperty(SarifPropertyName.ConversionSources);
+                    for (int i = 0; i < result.Stacks.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(result.Stacks[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
+                }
 
-                for (int i = 0; i < resultProvenance.ConversionSources.Count; ++i)
+                if (result.RelatedLocations != null)
                 {
-                    Visit(resultProvenance.ConversionSources[i], conversionSourcesPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.RelatedLocations);
+
+                    for (int i = 0; i < result.RelatedLocations.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(result.RelatedLocations[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
                 }
-            }
-        }
 
-        private void Visit(Run run, string runPointer)
-        {
-            Analyze(run, runPointer);
+                if (result.Fixes != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Fixes);
 
-            if (run.Conversion != null)
-            {
-                Visit(run.Conversion, runPointer.AtProperty(SarifPropertyName.Conversion));
-            }
+                    for (int i = 0; i < result.Fixes.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(result.Fixes[i]);
+                        _pointer.Pop();
+                    }
 
-            if (run.Results != null)
-            {
-                string resultsPointer = runPointer.AtProperty(SarifPropertyName.Results);
+                    _pointer.Pop();
+                }
 
-                for (int i = 0; i < run.Results.Count; ++i)
+                if (result.Taxa != null)
                 {
-                    Result result = run.Results[i];
-                    Context.CurrentResult = result;
-                    Context.CurrentResultIndex = i;
+                    _pointer.PushProperty(SarifPropertyName.Taxa);
 
+                    _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Taxon;
                     try
                     {
-                        Visit(result, resultsPointer.AtIndex(i));
+                        for (int i = 0; i < result.Taxa.Count; ++i)
+                        {
+                            _pointer.PushIndex(i);
+                            Visit(result.Taxa[i]);
+                            _pointer.Pop();
+                        }
                     }
                     finally
                     {
-                        Context.CurrentResult = null;
-                        Context.CurrentResultIndex = -1;
+                        _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
                     }
+
+                    _pointer.Pop();
                 }
-            }
 
-            if (run.Addresses != null)
-            {
-                string addressesPointer = runPointer.AtProperty(SarifPropertyName.Addresses);
+                if (result.WebRequest != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.WebRequest);
+                    Visit(result.WebRequest);
+                    _pointer.Pop();
+                }
 
-                for (int i = 0; i < run.Addresses.Count; ++i)
+                if (result.WebResponse != null)
                 {
-                    Visit(run.Addresses[i], addressesPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.WebResponse);
+                    Visit(result.WebResponse);
+                    _pointer.Pop();
                 }
             }
 
-            if (run.Artifacts != null)
+            private void Visit(IList<Notification> notifications, string propertyName)
             {
-                string artifactsPointer = runPointer.AtProperty(SarifPropertyName.Artifacts);
+                _pointer.PushProperty(propertyName);
 
-                for (int i = 0; i < run.Artifacts.Count; ++i)
+                for (int i = 0; i < notifications.Count; ++i)
                 {
-                    Visit(run.Artifacts[i], artifactsPointer.AtIndex(i));
+                    _pointer.PushIndex(i);
+                    Visit(notifications[i]);
+                    _pointer.Pop();
                 }
+
+                _pointer.Pop();
             }
 
-            if (run.LogicalLocations != null)
+            private void Visit(ResultProvenance resultProvenance)
             {
-                string logicalLocationsPointer = runPointer.AtProperty(SarifPropertyName.LogicalLocations);
+                Dispatch(SarifNodeKind.ResultProvenance, resultProvenance, s_analyzeResultProvenance);
 
-                for (int i = 0; i < run.LogicalLocations.Count; ++i)
+                if (resultProvenance.ConversionSources != null)
                 {
-                    Visit(run.LogicalLocations[i], logicalLocationsPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.ConversionSources);
+
+                    for (int i = 0; i < resultProvenance.ConversionSources.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(resultProvenance.ConversionSources[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
                 }
             }
 
-            if (run.Graphs != null)
+            private void Visit(Run run)
             {
-                string graphsPointer = runPointer.AtProperty(SarifPropertyName.Graphs);
+                Dispatch(SarifNodeKind.Run, run, s_analyzeRun);
 
-                for (int i = 0; i < run.Graphs.Count; ++i)
+                if (run.Conversion != null)
                 {
-                    Visit(run.Graphs[i], graphsPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Conversion);
+                    Visit(run.Conversion);
+                    _pointer.Pop();
                 }
-            }
-
-            if (run.Invocations != null)
-            {
-                string invocationsPointer = runPointer.AtProperty(SarifPropertyName.Invocations);
 
-                for (int i = 0; i < run.Invocations.Count; ++i)
+                if (run.Results != null)
                 {
-                    Visit(run.Invocations[i], invocationsPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Results);
+
+                    // Enumerate rather than index, so that deferred results are read
+                    // one at a time in a single forward pass.
+                    int i = 0;
+                    foreach (Result result in run.Results)
+                    {
+                        _context.CurrentResult = result;
+                        _context.CurrentResultIndex = i;
+                        _context.StreamedResults?.MoveTo(_context.CurrentRunIndex, i);
+
+                        try
+                        {
+                            _pointer.PushIndex(i);
+                            Visit(result);
+                            _pointer.Pop();
+                        }
+                        finally
+                        {
+                            _context.CurrentResult = null;
+                            _context.CurrentResultIndex = -1;
+                        }
+
+                        i++;
+                    }
+
+                    _pointer.Pop();
                 }
-            }
 
-            if (run.Tool != null)
-            {
-                Visit(run.Tool, runPointer.AtProperty(SarifPropertyName.Tool));
-            }
+                if (run.Addresses != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Addresses);
 
-            if (run.VersionControlProvenance != null)
-            {
-                string versionControlProvenancePointer = runPointer.AtProperty(SarifPropertyName.VersionControlProvenance);
+                    for (int i = 0; i < run.Addresses.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(run.Addresses[i]);
+                        _pointer.Pop();
+                    }
 
-                for (int i = 0; i < run.VersionControlProvenance.Count; ++i)
+                    _pointer.Pop();
+                }
+
+                if (run.Artifacts != null)
                 {
-                    Visit(run.VersionControlProvenance[i], versionControlProvenancePointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Artifacts);
+
+                    for (int i = 0; i < run.Artifacts.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(run.Artifacts[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
                 }
-            }
 
-            if (run.WebRequests != null)
-            {
-                string webRequestsPointer = runPointer.AtProperty(SarifPropertyName.WebRequests);
+                if (run.LogicalLocations != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.LogicalLocations);
+
+                    for (int i = 0; i < run.LogicalLocations.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(run.LogicalLocations[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
+                }
 
-                for (int i = 0; i < run.WebRequests.Count; ++i)
+                if (run.Graphs != null)
                 {
-                    Visit(run.WebRequests[i], webRequestsPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Graphs);
+
+                    for (int i = 0; i < run.Graphs.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(run.Graphs[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
                 }
-            }
 
-            if (run.WebResponses != null)
-            {
-                string webResponsesPointer = runPointer.AtProperty(SarifPropertyName.WebResponses);
+                if (run.Invocations != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Invocations);
 
-                for (int i = 0; i < run.WebResponses.Count; ++i)
+                    for (int i = 0; i < run.Invocations.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(run.Invocations[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
+                }
+
+                if (run.Tool != null)
                 {
-                    Visit(run.WebResponses[i], webResponsesPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Tool);
+                    Visit(run.Tool);
+                    _pointer.Pop();
                 }
-            }
 
-            if (run.OriginalUriBaseIds != null)
-            {
-                string originalUriBaseIdsPointer = runPointer.AtProperty(SarifPropertyName.OriginalUriBaseIds);
+                if (run.VersionControlProvenance != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.VersionControlProvenance);
+
+                    for (int i = 0; i < run.VersionControlProvenance.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(run.VersionControlProvenance[i]);
+                        _pointer.Pop();
+                    }
 
-                foreach (string uriBaseId in run.OriginalUriBaseIds.Keys)
+                    _pointer.Pop();
+                }
+
+                if (run.WebRequests != null)
                 {
-                    Visit(run.OriginalUriBaseIds[uriBaseId], originalUriBaseIdsPointer.AtProperty(uriBaseId));
+                    _pointer.PushProperty(SarifPropertyName.WebRequests);
+
+                    for (int i = 0; i < run.WebRequests.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(run.WebRequests[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
                 }
-            }
-        }
 
-        private void Visit(Stack stack, string stackPointer)
-        {
-            Analyze(stack, stackPointer);
+                if (run.WebResponses != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.WebResponses);
 
-            if (stack.Frames != null)
-            {
-                string framesPointer = stackPointer.AtProperty(SarifPropertyName.Frames);
+                    for (int i = 0; i < run.WebResponses.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(run.WebResponses[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
+                }
 
-                for (int i = 0; i < stack.Frames.Count; ++i)
+                if (run.OriginalUriBaseIds != null)
                 {
-                    Visit(stack.Frames[i], framesPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.OriginalUriBaseIds);
+
+                    foreach (string uriBaseId in run.OriginalUriBaseIds.Keys)
+                    {
+                        _pointer.PushProperty(uriBaseId);
+                        Visit(run.OriginalUriBaseIds[uriBaseId]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
                 }
             }
 
-            if (stack.Message != null)
+            private void Visit(Stack stack)
             {
-                Visit(stack.Message, stackPointer.AtProperty(SarifPropertyName.Message));
-            }
-        }
+                Dispatch(SarifNodeKind.Stack, stack, s_analyzeStack);
 
-        private void Visit(StackFrame frame, string framePointer)
-        {
-            Analyze(frame, framePointer);
+                if (stack.Frames != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Frames);
 
-            if (frame.Location != null)
-            {
-                Visit(frame.Location, framePointer.AtProperty(SarifPropertyName.Location));
-            }
-        }
+                    for (int i = 0; i < stack.Frames.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(stack.Frames[i]);
+                        _pointer.Pop();
+                    }
 
-        private void Visit(ThreadFlow threadFlow, string threadFlowPointer)
-        {
-            Analyze(threadFlow, threadFlowPointer);
+                    _pointer.Pop();
+                }
 
-            if (threadFlow.Message != null)
-            {
-                Visit(threadFlow.Message, threadFlowPointer.AtProperty(SarifPropertyName.Message));
+                if (stack.Message != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Message);
+                    Visit(stack.Message);
+                    _pointer.Pop();
+                }
             }
 
-            if (threadFlow.Locations != null)
+            private void Visit(StackFrame frame)
             {
-                string threadFlowLocationsPointer = threadFlowPointer.AtProperty(SarifPropertyName.Locations);
+                Dispatch(SarifNodeKind.StackFrame, frame, s_analyzeStackFrame);
 
-                for (int i = 0; i < threadFlow.Locations.Count; ++i)
+                if (frame.Location != null)
                 {
-                    Visit(threadFlow.Locations[i], threadFlowLocationsPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.Location);
+                    Visit(frame.Location);
+                    _pointer.Pop();
                 }
             }
-        }
-
-        private void Visit(ThreadFlowLocation threadFlowLocation, string threadFlowLocationPointer)
-        {
-            Analyze(threadFlowLocation, threadFlowLocationPointer);
 
-            if (threadFlowLocation.Location != null)
+            private void Visit(ThreadFlow threadFlow)
             {
-                Visit(threadFlowLocation.Location, threadFlowLocationPointer.AtProperty(SarifPropertyName.Location));
+                Dispatch(SarifNodeKind.ThreadFlow, threadFlow, s_analyzeThreadFlow);
+
+                if (threadFlow.Message != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Message);
+                    Visit(threadFlow.Message);
+                    _pointer.Pop();
+                }
+
+                if (threadFlow.Locations != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Locations);
+
+                    for (int i = 0; i < threadFlow.Locations.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(threadFlow.Locations[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
+                }
             }
 
-            if (threadFlowLocation.Taxa != null)
+            private void Visit(ThreadFlowLocation threadFlowLocation)
             {
-                string taxaPointer = threadFlowLocationPointer.AtProperty(SarifPropertyName.Taxa);
+                Dispatch(SarifNodeKind.ThreadFlowLocation, threadFlowLocation, s_analyzeThreadFlowLocation);
 
-                Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Taxon;
-                try
+                if (threadFlowLocation.Location != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Location);
+                    Visit(threadFlowLocation.Location);
+                    _pointer.Pop();
+                }
+
+                if (threadFlowLocation.Taxa != null)
                 {
-                    for (int i = 0; i < threadFlowLocation.Taxa.Count; ++i)
+                    _pointer.PushProperty(SarifPropertyName.Taxa);
+
+                    _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Taxon;
+                    try
+                    {
+                        for (int i = 0; i < threadFlowLocation.Taxa.Count; ++i)
+                        {
+                            _pointer.PushIndex(i);
+                            Visit(threadFlowLocation.Taxa[i]);
+                            _pointer.Pop();
+                        }
+                    }
+                    finally
                     {
-                        Visit(threadFlowLocation.Taxa[i], taxaPointer.AtIndex(i));
+                        _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
                     }
+
+                    _pointer.Pop();
                 }
-                finally
+
+                if (threadFlowLocation.WebRequest != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.WebRequest);
+                    Visit(threadFlowLocation.WebRequest);
+                    _pointer.Pop();
+                }
+
+                if (threadFlowLocation.WebResponse != null)
                 {
-                    Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
+                    _pointer.PushProperty(SarifPropertyName.WebResponse);
+                    Visit(threadFlowLocation.WebResponse);
+                    _pointer.Pop();
                 }
             }
 
-            if (threadFlowLocation.WebRequest != null)
+            private void Visit(Tool tool)
             {
-                Visit(threadFlowLocation.WebRequest, threadFlowLocationPointer.AtProperty(SarifPropertyName.WebRequest));
+                Dispatch(SarifNodeKind.Tool, tool, s_analyzeTool);
+
+                if (tool.Driver != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Driver);
+                    Visit(tool.Driver);
+                    _pointer.Pop();
+                }
+
+                if (tool.Extensions != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.Extensions);
+                    for (int i = 0; i < tool.Extensions.Count; ++i)
+                    {
+                        _pointer.PushIndex(i);
+                        Visit(tool.Extensions[i]);
+                        _pointer.Pop();
+                    }
+
+                    _pointer.Pop();
+                }
             }
 
-            if (threadFlowLocation.WebResponse != null)
+            private void Visit(ToolComponent toolComponent)
             {
-                Visit(threadFlowLocation.WebResponse, threadFlowLocationPointer.AtProperty(SarifPropertyName.WebResponse));
-            }
-        }
+                Dispatch(SarifNodeKind.ToolComponent, toolComponent, s_analyzeToolComponent);
 
-        private void Visit(Tool tool, string toolPointer)
-        {
-            Analyze(tool, toolPointer);
+                if (toolComponent.AssociatedComponent != null)
+                {
+                    _pointer.PushProperty(SarifPropertyName.AssociatedComponent);
+                    Visit(toolComponent.AssociatedComponent);
+                    _pointer.Pop();
+                }
+
+                if (toolComponent.Notifications != null)
+                {
+                    _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Notification;
+                    try
+                    {
+                        _pointer.PushProperty(SarifPropertyName.Notifications);
+                        for (int i = 0; i < toolComponent.Notifications.Count; ++i)
+                        {
+                            _pointer.PushIndex(i);
+                            Visit(toolComponent.Notifications[i]);
+                            _pointer.Pop();
+                        }
+
+                        _pointer.Pop();
+                    }
+                    finally
+                    {
+                        _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
+                    }
+                }
+
+                if (toolComponent.Rules != null)
+                {
+                    _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Rule;
+                    try
+                    {
+                        _pointer.PushProperty(SarifPropertyName.Rules);
+                        for (int i = 0; i < toolComponent.Rules.Count; ++i)
+                        {
+                            _pointer.PushIndex(i);
+                            Visit(toolComponent.Rules[i]);
+                            _pointer.Pop();
+                        }
+
+                        _pointer.Pop();
+                    }
+                    finally
+                    {
+                        _context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
+                    }
+                }
+            }
 
-            if (tool.Driver != null)
+            private void Visit(ToolComponentReference toolComponentReference)
             {
-                Visit(tool.Driver, toolPointer.AtProperty(SarifPropertyName.Driver));
+                Dispatch(SarifNodeKind.ToolComponentReference, toolComponentReference, s_analyzeToolComponentReference);
             }
 
-            if (tool.Extensions != null)
+            private void Visit(VersionControlDetails versionControlDetails)
             {
-                string extensionsPointer = toolPointer.AtProperty(SarifPropertyName.Extensions);
-                for (int i = 0; i < tool.Extensions.Count; ++i)
+                Dispatch(SarifNodeKind.VersionControlDetails, versionControlDetails, s_analyzeVersionControlDetails);
+
+                if (versionControlDetails.MappedTo != null)
                 {
-                    Visit(tool.Extensions[i], extensionsPointer.AtIndex(i));
+                    _pointer.PushProperty(SarifPropertyName.MappedTo);
+                    Visit(versionControlDetails.MappedTo);
+                    _pointer.Pop();
                 }
             }
-        }
 
-        private void Visit(ToolComponent toolComponent, string toolComponentPointer)
-        {
-            Analyze(toolComponent, toolComponentPointer);
+            private void Visit(WebRequest webRequest)
+            {
+                Dispatch(SarifNodeKind.WebRequest, webRequest, s_analyzeWebRequest);
+            }
 
-            if (toolComponent.AssociatedComponent != null)
+            private void Visit(WebResponse webResponse)
             {
-                Visit(toolComponent.AssociatedComponent, toolComponentPointer.AtProperty(SarifPropertyName.AssociatedComponent));
+                Dispatch(SarifNodeKind.WebResponse, webResponse, s_analyzeWebResponse);
             }
 
-            if (toolComponent.Notifications != null)
+            /// <summary>
+            /// The reference tokens of the JSON pointer to the node currently being visited.
+            /// A pointer string is built only on request, and is memoized at each depth so that
+            /// descendants extend their parent's pointer rather than rebuilding it.
+            /// </summary>
+            private sealed class JsonPointerStack
             {
-                Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Notification;
-                try
+                private string[] _propertyNames = new string[16];
+                private int[] _indices = new int[16];
+                private string[] _pointers = new string[16];
+                private int _depth;
+
+                public string Current
                 {
-                    string notificationsPointer = toolComponentPointer.AtProperty(SarifPropertyName.Notifications);
-                    for (int i = 0; i < toolComponent.Notifications.Count; ++i)
+                    get
                     {
-                        Visit(toolComponent.Notifications[i], notificationsPointer.AtIndex(i));
+                        int cached = _depth - 1;
+                        while (cached >= 0 && _pointers[cached] == null) { cached--; }
+
+                        string pointer = cached >= 0 ? _pointers[cached] : string.Empty;
+                        for (int i = cached + 1; i < _depth; i++)
+                        {
+                            pointer = _propertyNames[i] != null
+                                ? pointer.AtProperty(_propertyNames[i])
+                                : pointer.AtIndex(_indices[i]);
+
+                            _pointers[i] = pointer;
+                        }
+
+                        return pointer;
                     }
                 }
-                finally
+
+                public void PushProperty(string propertyName)
                 {
-                    Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
+                    Push(propertyName, index: -1);
                 }
-            }
 
-            if (toolComponent.Rules != null)
-            {
-                Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.Rule;
-                try
+                public void PushIndex(int index)
                 {
-                    string rulesPointer = toolComponentPointer.AtProperty(SarifPropertyName.Rules);
-                    for (int i = 0; i < toolComponent.Rules.Count; ++i)
+                    Push(propertyName: null, index);
+                }
+
+                public void Pop()
+                {
+                    _depth--;
+                }
+
+                private void Push(string propertyName, int index)
+                {
+                    if (_depth == _pointers.Length)
                     {
-                        Visit(toolComponent.Rules[i], rulesPointer.AtIndex(i));
+                        Array.Resize(ref _propertyNames, _depth * 2);
+                        Array.Resize(ref _indices, _depth * 2);
+                        Array.Resize(ref _pointers, _depth * 2);
                     }
+
+                    _propertyNames[_depth] = propertyName;
+                    _indices[_depth] = index;
+                    _pointers[_depth] = null;
+                    _depth++;
                 }
-                finally
+            }
+
+            /// <summary>
+            /// Buffers everything one rule logs during the walk so that it can be replayed
+            /// into the target's logger after the walk completes.
+            /// </summary>
+            private sealed class RecordingLogger : IAnalysisLogger
+            {
+                private readonly List<Action<IAnalysisLogger>> _entries = new List<Action<IAnalysisLogger>>();
+
+                public FileRegionsCache FileRegionsCache { get; set; }
+
+                public void AnalysisStarted()
                 {
-                    Context.CurrentReportingDescriptorKind = SarifValidationContext.ReportingDescriptorKind.None;
                 }
-            }
-        }
 
-        private void Visit(ToolComponentReference toolComponentReference, string toolComponentReferencePointer)
-        {
-            Analyze(toolComponentReference, toolComponentReferencePointer);
-        }
+                public void AnalysisStopped(RuntimeConditions runtimeConditions)
+                {
+                }
 
-        private void Visit(VersionControlDetails versionControlDetails, string versionControlDetailsPointer)
-        {
-            Analyze(versionControlDetails, versionControlDetailsPointer);
+                public void AnalyzingTarget(IAnalysisContext context)
+                {
+                }
 
-            if (versionControlDetails.MappedTo != null)
-            {
-                Visit(versionControlDetails.MappedTo, versionControlDetailsPointer.AtProperty(SarifPropertyName.MappedTo));
-            }
-        }
+                public void TargetAnalyzed(IAnalysisContext context)
+                {
+                }
 
-        private void Visit(WebRequest webRequest, string webRequestPointer)
-        {
-            Analyze(webRequest, webRequestPointer);
-        }
+                public void Log(ReportingDescriptor rule, Result result, int? extensionIndex = null)
+                {
+                    _entries.Add(logger => logger.Log(rule, result, extensionIndex));
+                }
 
-        private void Visit(WebResponse webResponse, string webResponsePointer)
-        {
-            Analyze(webResponse, webResponsePointer);
+                public void LogToolNotification(Notification notification, ReportingDescriptor associatedRule = null)
+                {
+                    _entries.Add(logger => logger.LogToolNotification(notification, associatedRule));
+                }
+
+                public void LogConfigurationNotification(Notification notification)
+                {
+                    _entries.Add(logger => logger.LogConfigurationNotification(notification));
+                }
+
+                public void Replay(IAnalysisLogger logger)
+                {
+                    foreach (Action<IAnalysisLogger> entry in _entries)
+                    {
+                        entry(logger);
+                    }
+                }
+            }
         }
 
         private Region GetRegionFromJPointer(string jPointer)
         {
-            var jsonPointer = new JsonPointer(jPointer);
-            JToken jToken = jsonPointer.Evaluate(Context.InputLogToken);
+            JToken jToken = Context.EvaluateJsonPointer(jPointer);
             IJsonLineInfo lineInfo = jToken;
 
             Region region = null;
@@ -59,6 +59,8 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
 
         public bool UpdateInputsToCurrentSarif { get; set; }
 
+        public bool Streaming { get; set; }
+
         public string SchemaFilePath { get; internal set; }
 
         public string InputLogContents { get; internal set; }
@@ -75,8 +77,25 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
 
         public ReportingDescriptorKind CurrentReportingDescriptorKind { get; internal set; }
 
+        /// <summary>
+        /// The JSON of the log being validated. When the log is validated in streaming mode,
+        /// its results arrays are empty; use <see cref="EvaluateJsonPointer(string)"/> to
+        /// reach into the results.
+        /// </summary>
         public JToken InputLogToken { get; internal set; }
 
+        internal StreamedResultTokens StreamedResults { get; set; }
+
+        /// <summary>
+        /// Evaluates a JSON pointer against the log being validated.
+        /// </summary>
+        public JToken EvaluateJsonPointer(string jsonPointer)
+        {
+            return StreamedResults != null
+                ? StreamedResults.Evaluate(jsonPointer, InputLogToken)
+                : jsonPointer.ToJToken(InputLogToken);
+        }
+
         public override void Dispose()
         {
             base.Dispose();
@@ -0,0 +1,224 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections.Generic;
+using System.IO;
+
+using Newtonsoft.Json;
+using Newtonsoft.Json.Linq;
+
+namespace Microsoft.CodeAnalysis.Sarif.Multitool
+{
+    /// <summary>
+    ///  StreamedResultTokens supplies the JSON for the result currently being validated when
+    ///  a log is validated in streaming mode. It reads forward through the log, in step with
+    ///  the rules' walk over the (deferred) results, so only one result token is in memory at
+    ///  a time. JSON pointers into that result are evaluated against its token; all other
+    ///  pointers are evaluated against the log with its results removed.
+    /// </summary>
+    internal sealed class StreamedResultTokens : IDisposable
+    {
+        private const string RunsPointerPrefix = "/" + SarifPropertyName.Runs + "/";
+        private const string ResultsPointerSegment = "/" + SarifPropertyName.Results + "/";
+
+        // Depths of a run and of a result: root object (0) > 'runs' (1) > run (2) > 'results' (3) > result (4).
+        private const int RunDepth = 2;
+        private const int ResultDepth = 4;
+
+        private static readonly JsonLoadSettings s_loadSettings = new JsonLoadSettings { LineInfoHandling = LineInfoHandling.Load };
+
+        private readonly JsonTextReader _reader;
+        private readonly SarifLog _log;
+
+        private int _readerRunIndex = -1;
+        private int _readerResultIndex = -1;
+
+        private int _currentRunIndex = -1;
+        private int _currentResultIndex = -1;
+        private JToken _currentResult;
+
+        private int _otherRunIndex = -1;
+        private int _otherResultIndex = -1;
+        private JToken _otherResult;
+
+        /// <param name="stream">
+        /// A stream over the log being validated.
+        /// </param>
+        /// <param name="log">
+        /// The log, deserialized with deferred results, that the rules are walking. It is used to
+        /// materialize any result other than the current one that a rule happens to refer to.
+        /// </param>
+        public StreamedResultTokens(Stream stream, SarifLog log)
+        {
+            if (stream == null) { throw new ArgumentNullException(nameof(stream)); }
+
+            _log = log ?? throw new ArgumentNullException(nameof(log));
+            _reader = new JsonTextReader(new StreamReader(stream)) { DateParseHandling = DateParseHandling.None };
+        }
+
+        /// <summary>
+        /// Advances to the specified result. Results must be visited in document order.
+        /// </summary>
+        public void MoveTo(int runIndex, int resultIndex)
+        {
+            if (runIndex == _currentRunIndex && resultIndex == _currentResultIndex) { return; }
+
+            if (runIndex < _readerRunIndex || (runIndex == _readerRunIndex && resultIndex <= _readerResultIndex))
+            {
+                throw new InvalidOperationException($"Results must be visited in order; 'runs[{runIndex}].results[{resultIndex}]' has already been read.");
+            }
+
+            _currentRunIndex = runIndex;
+            _currentResultIndex = resultIndex;
+            _currentResult = null;
+
+            while (_reader.Read())
+            {
+                if (_reader.TokenType == JsonToken.PropertyName)
+                {
+                    // Only 'runs' (at the root) and 'results' (in a run) can lead to a result.
+                    if ((_reader.Depth == 1 && (string)_reader.Value != SarifPropertyName.Runs) ||
+                        (_reader.Depth == 3 && (string)_reader.Value != SarifPropertyName.Results))
+                    {
+                        _reader.Skip();
+                    }
+
+                    continue;
+                }
+
+                if (!IsValueToken(_reader.TokenType)) { continue; }
+
+                if (_reader.Depth == RunDepth)
+                {
+                    _readerRunIndex++;
+                    _readerResultIndex = -1;
+                }
+                else if (_reader.Depth == ResultDepth)
+                {
+                    _readerResultIndex++;
+
+                    if (_readerRunIndex == runIndex && _readerResultIndex == resultIndex)
+                    {
+                        _currentResult = JToken.Load(_reader, s_loadSettings);
+                        return;
+                    }
+
+                    _reader.Skip();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Evaluates a JSON pointer into the log.
+        /// </summary>
+        /// <param name="jsonPointer">
+        /// The pointer to evaluate.
+        /// </param>
+        /// <param name="logWithoutResults">
+        /// The log, with its results arrays empty.
+        /// </param>
+        public JToken Evaluate(string jsonPointer, JToken logWithoutResults)
+        {
+            if (TryParseResultPointer(jsonPointer, out int runIndex, out int resultIndex, out string pointerIntoResult))
+            {
+                JToken result = GetResultToken(runIndex, resultIndex);
+
+                if (result != null)
+                {
+                    return pointerIntoResult.Length == 0 ? result : pointerIntoResult.ToJToken(result);
+                }
+            }
+
+            return jsonPointer.ToJToken(logWithoutResults);
+        }
+
+        public void Dispose()
+        {
+            _reader.Close();
+        }
+
+        private JToken GetResultToken(int runIndex, int resultIndex)
+        {
+            if (runIndex == _currentRunIndex && resultIndex == _currentResultIndex)
+            {
+                return _currentResult;
+            }
+
+            if (runIndex == _otherRunIndex && resultIndex == _otherResultIndex)
+            {
+                return _otherResult;
+            }
+
+            // A rule has referred to a result other than the one being visited (for example,
+            // through a 'sarif:' URI). That's rare, so rather than keeping every result's token,
+            // we materialize that result from the deferred log. The token has no line information.
+            IList<Run> runs = _log.Runs;
+            IList<Result> results = runIndex < runs?.Count ? runs[runIndex]?.Results : null;
+            if (results == null || resultIndex >= results.Count) { return null; }
+
+            Result result = results[resultIndex];
+
+            _otherRunIndex = runIndex;
+            _otherResultIndex = resultIndex;
+            _otherResult = result != null ? JToken.FromObject(result) : JValue.CreateNull();
+
+            return _otherResult;
+        }
+
+        private static bool TryParseResultPointer(string jsonPointer, out int runIndex, out int resultIndex, out string pointerIntoResult)
+        {
+            runIndex = resultIndex = -1;
+            pointerIntoResult = null;
+
+            if (jsonPointer == null || !jsonPointer.StartsWith(RunsPointerPrefix, StringComparison.Ordinal)) { return false; }
+
+            int position = RunsPointerPrefix.Length;
+            if (!TryParseIndex(jsonPointer, ref position, out runIndex)) { return false; }
+
+            if (string.CompareOrdinal(jsonPointer, position, ResultsPointerSegment, 0, ResultsPointerSegment.Length) != 0) { return false; }
+
+            position += ResultsPointerSegment.Length;
+            if (!TryParseIndex(jsonPointer, ref position, out resultIndex)) { return false; }
+
+            if (position < jsonPointer.Length && jsonPointer[position] != '/') { return false; }
+
+            pointerIntoResult = jsonPointer.Substring(position);
+            return true;
+        }
+
+        private static bool TryParseIndex(string jsonPointer, ref int position, out int index)
+        {
+            index = 0;
+            int start = position;
+
+            while (position < jsonPointer.Length && jsonPointer[position] >= '0' && jsonPointer[position] <= '9')
+            {
+                if (index > (int.MaxValue - 9) / 10) { return false; }
+
+                index = (index * 10) + (jsonPointer[position++] - '0');
+            }
+
+            // JSON pointer array indices have no leading zeros.
+            int length = position - start;
+            return length == 1 || (length > 1 && jsonPointer[start] != '0');
+        }
+
+        private static bool IsValueToken(JsonToken tokenType)
+        {
+            switch (tokenType)
+            {
+                case JsonToken.None:
+                case JsonToken.PropertyName:
+                case JsonToken.Comment:
+                case JsonToken.EndObject:
+                case JsonToken.EndArray:
+                case JsonToken.EndConstructor:
+                    return false;
+
+                default:
+                    return true;
+            }
+        }
+    }
+}
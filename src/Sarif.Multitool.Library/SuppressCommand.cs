@@ -106,7 +106,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             int matchCount = 0;
             // Parse the Query and create a Result evaluator for it
             IExpression expression = ExpressionParser.ParseExpression(options.Expression);
-            IExpressionEvaluator<Result> evaluator = expression.ToEvaluator<Result>(SarifEvaluators.ResultEvaluator);
+            IExpressionEvaluator<Result> evaluator = new CompiledResultEvaluator(expression);
 
             // Read the log
             SarifLog log = ReadSarifFile<SarifLog>(this.FileSystem, options.InputFilePath);
@@ -1,16 +1,21 @@
 ﻿// Copyright (c) Microsoft. All rights reserved.
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
+using System;
 using System.Collections.Generic;
 using System.IO;
+using System.Linq;
 using System.Reflection;
 
 using Microsoft.CodeAnalysis.Sarif.Driver;
+using Microsoft.CodeAnalysis.Sarif.Multitool.Rules;
+using Microsoft.CodeAnalysis.Sarif.Readers;
 using Microsoft.CodeAnalysis.Sarif.Writers;
 using Microsoft.Json.Schema;
 using Microsoft.Json.Schema.Validation;
 
 using Newtonsoft.Json;
+using Newtonsoft.Json.Linq;
 
 namespace Microsoft.CodeAnalysis.Sarif.Multitool
 {
@@ -40,12 +45,20 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             }
         }
 
+        public override SarifValidationContext InitializeGlobalContextFromOptions(ValidateOptions options, ref SarifValidationContext context)
+        {
+            context = base.InitializeGlobalContextFromOptions(options, ref context);
+            context.Streaming = options.Streaming || context.Streaming;
+            return context;
+        }
+
         protected override SarifValidationContext CreateScanTargetContext(SarifValidationContext globalContext)
         {
             SarifValidationContext scanTargetContext = base.CreateScanTargetContext(globalContext);
 
             scanTargetContext.SchemaFilePath = globalContext.SchemaFilePath;
             scanTargetContext.UpdateInputsToCurrentSarif = globalContext.UpdateInputsToCurrentSarif;
+            scanTargetContext.Streaming = globalContext.Streaming;
             return scanTargetContext;
         }
 
@@ -53,6 +66,14 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
                                               IEnumerable<Skimmer<SarifValidationContext>> skimmers,
                                               ISet<string> disabledSkimmers)
         {
+            // Updating a log to the current version rewrites its entire text, so that
+            // can't be done in streaming mode.
+            if (context.Streaming && !context.UpdateInputsToCurrentSarif)
+            {
+                AnalyzeTargetStreaming(context, skimmers, disabledSkimmers);
+                return;
+            }
+
             // The base class knows how to invoke the skimmers that implement smart validation,
             // but it doesn't know how to invoke schema validation, which has its own set of rules,
             // so we do that ourselves.
@@ -74,9 +95,139 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
                 if (context.InputLog != null)
                 {
                     // Everything's ready, so run all the skimmers.
-                    base.AnalyzeTarget(context, skimmers, disabledSkimmers);
+                    AnalyzeTargetInSinglePass(context, skimmers, disabledSkimmers);
+                }
+            }
+        }
+
+        private void AnalyzeTargetStreaming(SarifValidationContext context,
+                                            IEnumerable<Skimmer<SarifValidationContext>> skimmers,
+                                            ISet<string> disabledSkimmers)
+        {
+            // In streaming mode, the log is never held in memory in its entirety. Schema
+            // validation reads the log once, checking each result against the schema as it
+            // goes by and retaining only the rest of the log (its runs' metadata). The
+            // skimmers then walk a deserialized log whose results are deferred, so they are
+            // read one at a time; the JSON of the result being visited is read alongside it.
+            string filePath = context.CurrentTarget.Uri.GetFilePath();
+            IFileSystem fileSystem = context.FileSystem;
+            Func<Stream> streamProvider = () => fileSystem.FileOpenRead(filePath);
+
+            JObject logWithoutResults;
+
+            try
+            {
+                logWithoutResults = ValidateStreaming(filePath, context.SchemaFilePath, context.Logger, streamProvider);
+            }
+            catch (JsonReaderException)
+            {
+                logWithoutResults = null;
+            }
+
+            if (logWithoutResults == null)
+            {
+                // The log isn't well-formed JSON, or isn't a JSON object. Nothing has been
+                // reported yet, so we validate it the usual way, which reports the problem.
+                context.Streaming = false;
+                AnalyzeTarget(context, skimmers, disabledSkimmers);
+                return;
+            }
+
+            context.InputLog = DeserializeDeferred(streamProvider);
+            if (context.InputLog == null) { return; }
+
+            context.InputLogToken = logWithoutResults;
+
+            using (var streamedResults = new StreamedResultTokens(streamProvider(), context.InputLog))
+            {
+                context.StreamedResults = streamedResults;
+
+                try
+                {
+                    AnalyzeTargetInSinglePass(context, skimmers, disabledSkimmers);
+                }
+                catch (JsonSerializationException)
+                {
+                    // A deferred result couldn't be deserialized (for example, because a property
+                    // required by the schema is missing). The schema validation results already
+                    // describe the problem; as in the non-streaming case, the skimmers report nothing.
+                }
+                finally
+                {
+                    context.StreamedResults = null;
+                }
+            }
+        }
+
+        private void AnalyzeTargetInSinglePass(SarifValidationContext context,
+                                               IEnumerable<Skimmer<SarifValidationContext>> skimmers,
+                                               ISet<string> disabledSkimmers)
+        {
+            // Rules built on SarifValidationSkimmerBase share a single walk of the log
+            // rather than each walking it in turn. Any other skimmers (for example, from
+            // a plugin) are run one at a time by the base class, as usual.
+            var validationSkimmers = new List<SarifValidationSkimmerBase>();
+            var otherSkimmers = new List<Skimmer<SarifValidationContext>>();
+
+            foreach (Skimmer<SarifValidationContext> skimmer in skimmers)
+            {
+                if (disabledSkimmers.Count > 0)
+                {
+                    lock (disabledSkimmers)
+                    {
+                        if (disabledSkimmers.Contains(skimmer.Id)) { continue; }
+                    }
+                }
+
+                if (skimmer is SarifValidationSkimmerBase validationSkimmer)
+                {
+                    validationSkimmers.Add(validationSkimmer);
+                }
+                else
+                {
+                    otherSkimmers.Add(skimmer);
                 }
             }
+
+            string filePath = context.CurrentTarget.Uri.GetFilePath();
+            long sizeInBytes = context.CurrentTarget.SizeInBytes.Value;
+
+            DriverEventSource.Log.ScanArtifactStart(filePath, sizeInBytes);
+
+            // The rules run interleaved, so each rule's start and stop events bracket the
+            // entire walk, and its scan time is the sum of its time at each node.
+            foreach (SarifValidationSkimmerBase skimmer in validationSkimmers)
+            {
+                DriverEventSource.Log.RuleStart(filePath, skimmer.Id, skimmer.Name);
+            }
+
+            bool traceRuleScanTime = context.Traces.Contains(nameof(DefaultTraces.RuleScanTime));
+            TimeSpan[] ruleScanTimes = SarifValidationSkimmerBase.AnalyzeInSinglePass(context, validationSkimmers, disabledSkimmers, traceRuleScanTime);
+
+            foreach (SarifValidationSkimmerBase skimmer in validationSkimmers)
+            {
+                DriverEventSource.Log.RuleStop(filePath, skimmer.Id, skimmer.Name);
+            }
+
+            if (ruleScanTimes != null)
+            {
+                string directory = Path.GetDirectoryName(filePath);
+                string file = Path.GetFileName(filePath);
+                string id = $"TRC101.{nameof(DefaultTraces.RuleScanTime)}";
+
+                for (int i = 0; i < validationSkimmers.Count; i++)
+                {
+                    string timing = $"'{file}' : elapsed {ruleScanTimes[i]} : '{validationSkimmers[i].Name}' : at '{directory}'";
+                    LogTrace(context, timing, id, validationSkimmers[i]);
+                }
+            }
+
+            DriverEventSource.Log.ScanArtifactStop(filePath, sizeInBytes);
+
+            if (otherSkimmers.Count > 0)
+            {
+                base.AnalyzeTarget(context, otherSkimmers, disabledSkimmers);
+            }
         }
 
         private static SarifLog Deserialize(string logContents)
@@ -95,6 +246,26 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             return log;
         }
 
+        private static SarifLog DeserializeDeferred(Func<Stream> streamProvider)
+        {
+            var serializer = new JsonSerializer { ContractResolver = SarifDeferredContractResolver.Instance };
+
+            try
+            {
+                using (var reader = new JsonPositionedTextReader(streamProvider))
+                {
+                    return serializer.Deserialize<SarifLog>(reader);
+                }
+            }
+            catch (JsonSerializationException)
+            {
+                // This exception can happen, for example, if a property required by the schema is
+                // missing.
+            }
+
+            return null;
+        }
+
         private string Validate(
             string instanceFilePath,
             string schemaFilePath,
@@ -141,29 +312,161 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             string schemaFilePath,
             IAnalysisLogger logger)
         {
-            string schemaText = null;
+            string schemaText = ReadSchemaText(schemaFilePath);
 
-            if (schemaFilePath != null)
+            JsonSchema schema = SchemaReader.ReadSchema(schemaText, schemaFilePath);
+
+            var validator = new Validator(schema);
+            Result[] results = validator.Validate(instanceText, instanceFilePath);
+
+            ReportResults(results, logger);
+        }
+
+        /// <summary>
+        /// Validates a log against the schema without loading it into memory in its entirety.
+        /// Each result is validated against the schema's 'result' definition as it is read;
+        /// what remains of the log is then validated against the full schema.
+        /// </summary>
+        /// <returns>
+        /// The log, with its results arrays empty, or null (having reported nothing) if the
+        /// log is not a JSON object.
+        /// </returns>
+        /// <exception cref="JsonReaderException">
+        /// The log is not well-formed JSON.
+        /// </exception>
+        private JObject ValidateStreaming(
+            string instanceFilePath,
+            string schemaFilePath,
+            IAnalysisLogger logger,
+            Func<Stream> streamProvider)
+        {
+            Validator logValidator = null, resultValidator = null;
+            SchemaValidationException invalidSchemaException = null;
+
+            try
+            {
+                string schemaText = ReadSchemaText(schemaFilePath);
+
+                logValidator = new Validator(SchemaReader.ReadSchema(schemaText, schemaFilePath));
+                resultValidator = new Validator(SchemaReader.ReadSchema(CreateDefinitionSchemaText(schemaText, "result"), schemaFilePath));
+            }
+            catch (SchemaValidationException ex)
+            {
+                invalidSchemaException = ex;
+            }
+
+            // Nothing is reported until the entire log has been read, so that nothing
+            // is reported for a log that turns out not to be well-formed JSON.
+            var resultValidationResults = new List<Result>();
+
+            JObject logWithoutResults;
+
+            using (Stream stream = streamProvider())
+            using (var reader = new ResultsSkippingJsonReader(
+                new JsonTextReader(new StreamReader(stream)) { DateParseHandling = DateParseHandling.None },
+                (resultPath, resultToken) =>
+                {
+                    if (resultValidator != null)
+                    {
+                        resultValidationResults.AddRange(ValidateToken(resultValidator, resultToken, resultPath, instanceFilePath));
+                    }
+                }))
             {
-                schemaText = FileSystem.FileReadAllText(schemaFilePath);
+                logWithoutResults = JToken.Load(reader) as JObject;
+            }
+
+            if (logWithoutResults == null) { return null; }
+
+            if (invalidSchemaException != null)
+            {
+                ReportInvalidSchemaErrors(invalidSchemaException, schemaFilePath, logger);
             }
             else
             {
-                string schemaResource = "Microsoft.CodeAnalysis.Sarif.Multitool.sarif-2.1.0.json";
+                ReportResults(ValidateToken(logValidator, logWithoutResults, pathPrefix: null, instanceFilePath), logger);
+            }
+
+            ReportResults(resultValidationResults.ToArray(), logger);
+
+            return logWithoutResults;
+        }
+
+        private string ReadSchemaText(string schemaFilePath)
+        {
+            if (schemaFilePath != null)
+            {
+                return FileSystem.FileReadAllText(schemaFilePath);
+            }
+
+            string schemaResource = "Microsoft.CodeAnalysis.Sarif.Multitool.sarif-2.1.0.json";
 
-                using (Stream stream = this.GetType().Assembly.GetManifestResourceStream(schemaResource))
-                using (var reader = new StreamReader(stream))
+            using (Stream stream = this.GetType().Assembly.GetManifestResourceStream(schemaResource))
+            using (var reader = new StreamReader(stream))
+            {
+                return reader.ReadToEnd();
+            }
+        }
+
+        /// <summary>
+        /// Creates a schema whose root is one of the definitions in <paramref name="schemaText"/>,
+        /// carrying all of its definitions so that references among them still resolve.
+        /// </summary>
+        private static string CreateDefinitionSchemaText(string schemaText, string definitionName)
+        {
+            var schema = JObject.Parse(schemaText);
+            var definitions = (JObject)schema["definitions"];
+
+            var definitionSchema = (JObject)definitions[definitionName].DeepClone();
+            definitionSchema["definitions"] = definitions.DeepClone();
+
+            if (schema["$schema"] != null)
+            {
+                definitionSchema["$schema"] = schema["$schema"].DeepClone();
+            }
+
+            return definitionSchema.ToString(Formatting.None);
+        }
+
+        /// <summary>
+        /// Validates a token read from a log, and rewrites the JSON path and region of each
+        /// validation result so that they refer to the token's location in the log rather than
+        /// in the text that was validated.
+        /// </summary>
+        private static Result[] ValidateToken(Validator validator, JToken token, string pathPrefix, string instanceFilePath)
+        {
+            const string JsonPathPropertyName = "jsonPath";
+
+            Result[] results = validator.Validate(token.ToString(Formatting.None), instanceFilePath);
+
+            foreach (Result result in results)
+            {
+                if (!result.TryGetProperty<string>(JsonPathPropertyName, out string relativePath)) { continue; }
+
+                IJsonLineInfo lineInfo = string.IsNullOrEmpty(relativePath) ? token : token.SelectToken(relativePath);
+                Region region = result.Locations?.FirstOrDefault()?.PhysicalLocation?.Region;
+
+                if (region != null && lineInfo?.HasLineInfo() == true)
                 {
-                    schemaText = reader.ReadToEnd();
+                    region.StartLine = lineInfo.LineNumber;
+                    region.StartColumn = lineInfo.LinePosition;
                 }
-            }
 
-            JsonSchema schema = SchemaReader.ReadSchema(schemaText, schemaFilePath);
+                if (pathPrefix == null) { continue; }
 
-            var validator = new Validator(schema);
-            Result[] results = validator.Validate(instanceText, instanceFilePath);
+                string path = string.IsNullOrEmpty(relativePath)
+                    ? pathPrefix
+                    : relativePath[0] == '[' ? pathPrefix + relativePath : pathPrefix + "." + relativePath;
 
-            ReportResults(results, logger);
+                IList<string> arguments = result.Message?.Arguments;
+                if (arguments?.Count > 0 && arguments[0] == relativePath)
+                {
+                    arguments[0] = path;
+                }
+
+                result.SetProperty(JsonPathPropertyName, path);
+            }
+
+            return results;
         }
 
         private static void ReportInvalidSchemaErrors(
@@ -21,5 +21,11 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             HelpText =
             @"Update any SARIF v1 or prerelease v2 files to the current SARIF v2 format.")]
         public bool UpdateInputsToCurrentSarif { get; set; }
+
+        [Option(
+            "streaming",
+            HelpText =
+            @"Validate results one at a time as they are read rather than loading the entire log into memory. Use this for very large logs. Ignored if --update-inputs-to-current-sarif is specified.")]
+        public bool Streaming { get; set; }
     }
 }
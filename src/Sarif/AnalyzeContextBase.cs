@@ -25,10 +25,12 @@ namespace Microsoft.CodeAnalysis.Sarif
         {
             return new IOption[]
             {
+                AnalysisCacheDirectoryProperty,
                 AutomationGuidProperty,
                 AutomationIdProperty,
                 BaselineFilePathProperty,
                 BinaryFileExtensionsProperty,
+                CacheResultsByHashProperty,
                 ChannelSizeProperty,
                 OutputConfigurationFilePathProperty,
                 DataToInsertProperty,
@@ -38,6 +40,7 @@ namespace Microsoft.CodeAnalysis.Sarif
                 GlobalFilePathDenyRegexProperty,
                 MaxFileSizeInKilobytesProperty,
                 MaxArchiveRecursionDepthProperty,
+                MaxBufferedTargetsProperty,
                 EventsBufferSizeInMegabytesProperty,
                 OpcFileExtensionsProperty,
                 OutputFileOptionsProperty,
@@ -48,6 +51,7 @@ namespace Microsoft.CodeAnalysis.Sarif
                 ResultKindsProperty,
                 RuleKindsProperty,
                 RichReturnCodeProperty,
+                RuleParallelismThresholdInKilobytesProperty,
                 TargetFileSpecifiersProperty,
                 ThreadsProperty,
                 TracesProperty,
@@ -141,6 +145,12 @@ namespace Microsoft.CodeAnalysis.Sarif
             set => this.Policy.SetProperty(BaselineFilePathProperty, value);
         }
 
+        public string AnalysisCacheDirectory
+        {
+            get => this.Policy.GetProperty(AnalysisCacheDirectoryProperty);
+            set => this.Policy.SetProperty(AnalysisCacheDirectoryProperty, value);
+        }
+
         public string OutputFilePath
         {
             get => this.Policy.GetProperty(OutputFilePathProperty);
@@ -253,18 +263,51 @@ namespace Microsoft.CodeAnalysis.Sarif
             set => this.Policy.SetProperty(MaxFileSizeInKilobytesProperty, value >= 0 ? value : MaxFileSizeInKilobytesProperty.DefaultValue());
         }
 
+        public long RuleParallelismThresholdInKilobytes
+        {
+            get => this.Policy.GetProperty(RuleParallelismThresholdInKilobytesProperty);
+            set => this.Policy.SetProperty(RuleParallelismThresholdInKilobytesProperty, value >= 0 ? value : RuleParallelismThresholdInKilobytesProperty.DefaultValue());
+        }
+
         public int MaxArchiveRecursionDepth
         {
             get => this.Policy.GetProperty(MaxArchiveRecursionDepthProperty);
             set => this.Policy.SetProperty(MaxArchiveRecursionDepthProperty, value >= 0 ? value : MaxArchiveRecursionDepthProperty.DefaultValue());
         }
 
+        public virtual bool CacheResultsByHash
+        {
+            get => this.Policy.GetProperty(CacheResultsByHashProperty);
+            set => this.Policy.SetProperty(CacheResultsByHashProperty, value);
+        }
+
+        public int MaxBufferedTargets
+        {
+            get => this.Policy.GetProperty(MaxBufferedTargetsProperty);
+            set => this.Policy.SetProperty(MaxBufferedTargetsProperty, value >= 0 ? value : MaxBufferedTargetsProperty.DefaultValue());
+        }
+
         public int EventsBufferSizeInMegabytes
         {
             get => this.Policy.GetProperty(EventsBufferSizeInMegabytesProperty);
             set => this.Policy.SetProperty(EventsBufferSizeInMegabytesProperty, value >= 0 ? value : EventsBufferSizeInMegabytesProperty.DefaultValue());
         }
 
+        /// <summary>
+        /// Creates a shallow copy of this context, in which a single rule analyzes the current
+        /// target concurrently with other rules. The copy starts with no rule, runtime errors or
+        /// exceptions of its own, and is not disposed. Contexts that hold state which a rule
+        /// modifies as it analyzes a target should override this to give the copy its own.
+        /// </summary>
+        public virtual AnalyzeContextBase CloneForRule()
+        {
+            var context = (AnalyzeContextBase)MemberwiseClone();
+            context.Rule = null;
+            context.RuntimeErrors = RuntimeConditions.None;
+            context.RuntimeExceptions = null;
+            return context;
+        }
+
         public virtual void Dispose()
         {
             var disposableLogger = this.Logger as IDisposable;
@@ -320,6 +363,13 @@ namespace Microsoft.CodeAnalysis.Sarif
                         "CoreSettings", nameof(BaselineFilePath), defaultValue: () => string.Empty,
                         "The path to a SARIF baseline file.");
 
+        public static PerLanguageOption<string> AnalysisCacheDirectoryProperty { get; } =
+                    new PerLanguageOption<string>(
+                        "CoreSettings", nameof(AnalysisCacheDirectory), defaultValue: () => string.Empty,
+                        "A directory in which to persist analysis results across runs, by target hash, " +
+                        "so that targets unchanged since a previous run with the same rules and " +
+                        "configuration aren't analyzed again.");
+
         public static PerLanguageOption<string> OutputFilePathProperty { get; } =
                             new PerLanguageOption<string>(
                                 "CoreSettings", nameof(OutputFilePath), defaultValue: () => string.Empty,
@@ -414,6 +464,12 @@ namespace Microsoft.CodeAnalysis.Sarif
                         "CoreSettings", nameof(RichReturnCode), defaultValue: () => false,
                         "Emit a 'rich' return code consisting of a bitfield of conditions (as opposed to 0 or 1 indicating success or failure.");
 
+        public static PerLanguageOption<bool> CacheResultsByHashProperty { get; } =
+                    new PerLanguageOption<bool>(
+                        "CoreSettings", nameof(CacheResultsByHash), defaultValue: () => false,
+                        "Specifies whether to analyze each distinct file (by SHA-256 hash) once, replaying its " +
+                        "results for every other scan target with identical contents. Defaults to 'False'.");
+
         public static PerLanguageOption<bool> RecurseProperty { get; } =
                     new PerLanguageOption<bool>(
                         "CoreSettings", nameof(Recurse), defaultValue: () => false,
@@ -430,6 +486,12 @@ namespace Microsoft.CodeAnalysis.Sarif
                 $"    records what scan targets would have been analyzed, given current configuration.{Environment.NewLine}" +
                 $"    Negative values will be discarded in favor of the default of {MaxFileSizeInKilobytesProperty?.DefaultValue() ?? DefaultMaxFileSizeInKilobytes} KB.");
 
+        public static PerLanguageOption<long> RuleParallelismThresholdInKilobytesProperty { get; } =
+            new PerLanguageOption<long>(
+                "CoreSettings", nameof(RuleParallelismThresholdInKilobytes), defaultValue: () => 0,
+                "Scan targets at least this large (in kilobytes) are analyzed by their applicable rules " +
+                "concurrently rather than one rule at a time. Defaults to 0 (rules always run one at a time).");
+
         private const int DefaultMaxArchiveRecursionDepth = 10;
         public static PerLanguageOption<int> MaxArchiveRecursionDepthProperty { get; } =
             new PerLanguageOption<int>(
@@ -439,6 +501,16 @@ namespace Microsoft.CodeAnalysis.Sarif
                 $"    This prevents stack overflow when processing deeply nested or circular archive structures.{Environment.NewLine}" +
                 $"    Negative values will be discarded in favor of the default of {DefaultMaxArchiveRecursionDepth}.");
 
+        private const int DefaultMaxBufferedTargets = 10000;
+        public static PerLanguageOption<int> MaxBufferedTargetsProperty { get; } =
+            new PerLanguageOption<int>(
+                $"CoreSettings", nameof(MaxBufferedTargets), defaultValue: () => DefaultMaxBufferedTargets,
+                $"{Environment.NewLine}" +
+                $"    Maximum number of scan targets that may be enumerated but not yet logged. Results are{Environment.NewLine}" +
+                $"    logged in enumeration order, so targets completed behind a slow one are held in memory{Environment.NewLine}" +
+                $"    until it finishes; at this limit, enumeration waits for logging to catch up. Zero for{Environment.NewLine}" +
+                $"    no limit. Negative values will be discarded in favor of the default of {DefaultMaxBufferedTargets}.");
+
 
         public static PerLanguageOption<int> EventsBufferSizeInMegabytesProperty { get; } =
             new PerLanguageOption<int>(
@@ -0,0 +1,123 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+using Newtonsoft.Json;
+
+namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching
+{
+    /// <summary>
+    ///  BaselineCache records, for each artifact content hash and rule id, the correlation Guids of
+    ///  the Results a baselined log reported for that rule in that content (in 'Where' order).
+    ///  When the next baseline sees the same content reporting the same number of Results for the
+    ///  rule, those Results are paired with the previous ones by correlation Guid instead of being
+    ///  matched heuristically, so only Results in changed artifacts go through the full matcher.
+    /// </summary>
+    public class BaselineCache
+    {
+        private const int CurrentVersion = 1;
+
+        [JsonProperty("version")]
+        private int _version = CurrentVersion;
+
+        [JsonProperty("entries")]
+        private readonly Dictionary<string, List<Guid>> _entries;
+
+        public BaselineCache()
+        {
+            _entries = new Dictionary<string, List<Guid>>(StringComparer.Ordinal);
+        }
+
+        /// <summary>
+        /// The number of (artifact content, rule) entries in the cache.
+        /// </summary>
+        [JsonIgnore]
+        public int Count => _entries.Count;
+
+        /// <summary>
+        /// Load a cache written by <see cref="Save"/>. A missing file, or one written by a different
+        /// version of the SDK, loads as an empty cache.
+        /// </summary>
+        public static BaselineCache Load(string path, IFileSystem fileSystem = null)
+        {
+            fileSystem ??= FileSystem.Instance;
+
+            if (!fileSystem.FileExists(path))
+            {
+                return new BaselineCache();
+            }
+
+            BaselineCache cache = JsonConvert.DeserializeObject<BaselineCache>(fileSystem.FileReadAllText(path));
+
+            return cache?._version == CurrentVersion ? cache : new BaselineCache();
+        }
+
+        public void Save(string path, IFileSystem fileSystem = null)
+        {
+            fileSystem ??= FileSystem.Instance;
+            fileSystem.FileWriteAllText(path, JsonConvert.SerializeObject(this));
+        }
+
+        /// <summary>
+        /// Build the cache describing a baselined log, for use when that log is next the baseline.
+        /// </summary>
+        /// <param name="baselinedLog">The output of result matching.</param>
+        /// <param name="fileSystem">The file system used to hash artifacts whose hashes aren't in the log.</param>
+        public static BaselineCache Create(SarifLog baselinedLog, IFileSystem fileSystem = null)
+        {
+            var cache = new BaselineCache();
+            if (baselinedLog?.Runs == null) { return cache; }
+
+            var hashes = new ArtifactContentHashes(fileSystem);
+            var groups = new Dictionary<string, List<ExtractedResult>>(StringComparer.Ordinal);
+
+            foreach (Run run in baselinedLog.Runs)
+            {
+                if (run?.Results == null) { continue; }
+
+                foreach (Result result in run.Results)
+                {
+                    if (result.BaselineState == BaselineState.Absent || result.CorrelationGuid == null) { continue; }
+
+                    var extracted = new ExtractedResult(result, run);
+                    string key = GetKey(hashes.GetHash(result, run), extracted.RuleId);
+                    if (key == null) { continue; }
+
+                    if (!groups.TryGetValue(key, out List<ExtractedResult> group))
+                    {
+                        group = new List<ExtractedResult>();
+                        groups[key] = group;
+                    }
+
+                    group.Add(extracted);
+                }
+            }
+
+            foreach (KeyValuePair<string, List<ExtractedResult>> group in groups)
+            {
+                cache._entries[group.Key] = OrderByWhere(group.Value).Select(r => r.Result.CorrelationGuid.Value).ToList();
+            }
+
+            return cache;
+        }
+
+        internal bool TryGetCorrelationGuids(string key, out List<Guid> correlationGuids)
+        {
+            return _entries.TryGetValue(key, out correlationGuids);
+        }
+
+        internal static string GetKey(string contentHash, string ruleId)
+        {
+            return contentHash == null || ruleId == null ? null : contentHash + "|" + ruleId;
+        }
+
+        internal static IEnumerable<ExtractedResult> OrderByWhere(IEnumerable<ExtractedResult> results)
+        {
+            // OrderBy is stable, so Results at the same location keep their order in the log.
+            return results.OrderBy(r => r, WhereComparer.Instance);
+        }
+    }
+}
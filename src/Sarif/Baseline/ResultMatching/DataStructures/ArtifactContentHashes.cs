@@ -0,0 +1,91 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching
+{
+    /// <summary>
+    ///  ArtifactContentHashes looks up the SHA-256 content hash of the artifact a Result was
+    ///  found in (its first location). The hash recorded in run.artifacts is used when present;
+    ///  otherwise, for file Uris (relative ones resolved through run.originalUriBaseIds), the
+    ///  file on disk is hashed once and remembered.
+    /// </summary>
+    internal class ArtifactContentHashes
+    {
+        private const string Sha256 = "sha-256";
+
+        private readonly IFileSystem _fileSystem;
+        private readonly Dictionary<Run, Dictionary<string, string>> _hashesByRun;
+        private readonly Dictionary<string, string> _fileHashes;
+
+        public ArtifactContentHashes(IFileSystem fileSystem = null)
+        {
+            _fileSystem = fileSystem ?? FileSystem.Instance;
+            _hashesByRun = new Dictionary<Run, Dictionary<string, string>>();
+            _fileHashes = new Dictionary<string, string>(StringComparer.Ordinal);
+        }
+
+        public string GetHash(Result result, Run run)
+        {
+            ArtifactLocation artifactLocation = result?.Locations?.FirstOrDefault()?.PhysicalLocation?.ArtifactLocation;
+            if (artifactLocation == null) { return null; }
+
+            Artifact artifact = null;
+            if (run?.Artifacts != null && artifactLocation.Index >= 0 && artifactLocation.Index < run.Artifacts.Count)
+            {
+                artifact = run.Artifacts[artifactLocation.Index];
+                if (artifact?.Hashes != null && artifact.Hashes.TryGetValue(Sha256, out string indexedHash))
+                {
+                    return indexedHash;
+                }
+            }
+
+            ArtifactLocation uriLocation = artifactLocation.Uri != null ? artifactLocation : artifact?.Location;
+            Uri uri = uriLocation?.Uri;
+            if (uri == null) { return null; }
+
+            if (run != null && GetRunHashes(run).TryGetValue(uri.OriginalString, out string hash))
+            {
+                return hash;
+            }
+
+            if (!uriLocation.TryReconstructAbsoluteUri(run?.OriginalUriBaseIds, out Uri absoluteUri) || !absoluteUri.IsFile) { return null; }
+
+            string path = absoluteUri.LocalPath;
+            if (!_fileHashes.TryGetValue(path, out hash))
+            {
+                hash = _fileSystem.FileExists(path) ? HashUtilities.ComputeSha256Hash(path, _fileSystem) : null;
+                _fileHashes[path] = hash;
+            }
+
+            return hash;
+        }
+
+        private Dictionary<string, string> GetRunHashes(Run run)
+        {
+            if (!_hashesByRun.TryGetValue(run, out Dictionary<string, string> hashes))
+            {
+                hashes = new Dictionary<string, string>(StringComparer.Ordinal);
+
+                if (run.Artifacts != null)
+                {
+                    foreach (Artifact artifact in run.Artifacts)
+                    {
+                        string uri = artifact?.Location?.Uri?.OriginalString;
+                        if (uri != null && artifact.Hashes != null && artifact.Hashes.TryGetValue(Sha256, out string hash))
+                        {
+                            hashes[uri] = hash;
+                        }
+                    }
+                }
+
+                _hashesByRun[run] = hashes;
+            }
+
+            return hashes;
+        }
+    }
+}
@@ -0,0 +1,123 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System.Collections.Generic;
+
+namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching
+{
+    /// <summary>
+    ///  ResultMatchingProjection reduces a Result to the properties the default matcher compares,
+    ///  so that the Results of very large logs can be matched without holding them in memory.
+    ///  The projection keeps the rule, Guid, fingerprints and the formatted message text; keeps each
+    ///  location's resolved Uri, Region position and logical location names; and replaces the first
+    ///  snippet and each property value with a hash (they're only ever compared for equality).
+    /// </summary>
+    internal static class ResultMatchingProjection
+    {
+        public static Result Project(Result result, Run run)
+        {
+            return new Result
+            {
+                RuleId = result.ResolvedRuleId(run),
+                RuleIndex = result.RuleIndex,
+                Rule = result.Rule,
+                Guid = result.Guid,
+                CorrelationGuid = result.CorrelationGuid,
+                BaselineState = result.BaselineState,
+                Message = new Message { Text = result.GetMessageText(result.GetRule(run)) },
+                Fingerprints = result.Fingerprints,
+                PartialFingerprints = result.PartialFingerprints,
+                Locations = ProjectLocations(result.Locations, run),
+                Properties = ProjectProperties(result.Properties),
+                Run = run
+            };
+        }
+
+        private static IList<Location> ProjectLocations(IList<Location> locations, Run run)
+        {
+            if (locations == null) { return null; }
+
+            var projected = new List<Location>(locations.Count);
+            bool snippetSeen = false;
+
+            foreach (Location location in locations)
+            {
+                if (location == null)
+                {
+                    projected.Add(null);
+                    continue;
+                }
+
+                PhysicalLocation physicalLocation = null;
+                if (location.PhysicalLocation != null)
+                {
+                    ArtifactLocation artifactLocation = location.PhysicalLocation.ArtifactLocation;
+                    physicalLocation = new PhysicalLocation
+                    {
+                        ArtifactLocation = artifactLocation == null
+                            ? null
+                            : new ArtifactLocation { Uri = artifactLocation.Uri ?? artifactLocation.Resolve(run)?.Uri },
+                        Region = ProjectRegion(location.PhysicalLocation.Region, ref snippetSeen)
+                    };
+                }
+
+                List<LogicalLocation> logicalLocations = null;
+                if (location.LogicalLocations != null)
+                {
+                    logicalLocations = new List<LogicalLocation>(location.LogicalLocations.Count);
+                    foreach (LogicalLocation logicalLocation in location.LogicalLocations)
+                    {
+                        logicalLocations.Add(new LogicalLocation { FullyQualifiedName = logicalLocation?.Resolve(run)?.FullyQualifiedName });
+                    }
+                }
+
+                projected.Add(new Location { PhysicalLocation = physicalLocation, LogicalLocations = logicalLocations });
+            }
+
+            return projected;
+        }
+
+        private static Region ProjectRegion(Region region, ref bool snippetSeen)
+        {
+            if (region == null) { return null; }
+
+            var projected = new Region
+            {
+                StartLine = region.StartLine,
+                StartColumn = region.StartColumn,
+                EndLine = region.EndLine,
+                EndColumn = region.EndColumn,
+                ByteOffset = region.ByteOffset,
+                ByteLength = region.ByteLength,
+                CharOffset = region.CharOffset,
+                CharLength = region.CharLength
+            };
+
+            // Only the first snippet in a Result is ever compared.
+            string snippet = region.Snippet?.Text;
+            if (snippet != null && !snippetSeen)
+            {
+                projected.Snippet = new ArtifactContent { Text = HashUtilities.ComputeStringSha256Hash(snippet) };
+                snippetSeen = true;
+            }
+
+            return projected;
+        }
+
+        private static IDictionary<string, SerializedPropertyInfo> ProjectProperties(IDictionary<string, SerializedPropertyInfo> properties)
+        {
+            if (properties == null) { return null; }
+
+            var projected = new Dictionary<string, SerializedPropertyInfo>(properties.Count);
+            foreach (KeyValuePair<string, SerializedPropertyInfo> property in properties)
+            {
+                string value = property.Value?.SerializedValue;
+                projected[property.Key] = value == null
+                    ? property.Value
+                    : new SerializedPropertyInfo(HashUtilities.ComputeStringSha256Hash(value), isString: true);
+            }
+
+            return projected;
+        }
+    }
+}
@@ -0,0 +1,100 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System.Collections.Generic;
+
+namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching
+{
+    /// <summary>
+    ///  UnmatchedResults tracks which baseline and current Results haven't been matched yet,
+    ///  as each matcher in a chain runs. Results are tracked by index with a liveness flag, so
+    ///  marking a match is O(1) and each matcher is handed the remaining Results in O(n),
+    ///  rather than removing every matched Result from a List.
+    /// </summary>
+    internal class UnmatchedResults
+    {
+        private readonly List<ExtractedResult> _baseline;
+        private readonly List<ExtractedResult> _current;
+
+        // ExtractedResult doesn't override Equals, so these map each Result by reference to its index.
+        private readonly Dictionary<ExtractedResult, int> _baselineIndex;
+        private readonly Dictionary<ExtractedResult, int> _currentIndex;
+
+        private readonly bool[] _baselineMatched;
+        private readonly bool[] _currentMatched;
+
+        private List<ExtractedResult> _remainingBaseline;
+        private List<ExtractedResult> _remainingCurrent;
+
+        public UnmatchedResults(List<ExtractedResult> baseline, List<ExtractedResult> current)
+        {
+            _baseline = baseline;
+            _current = current;
+
+            _baselineIndex = BuildIndex(baseline);
+            _currentIndex = BuildIndex(current);
+
+            _baselineMatched = new bool[baseline.Count];
+            _currentMatched = new bool[current.Count];
+
+            _remainingBaseline = baseline;
+            _remainingCurrent = current;
+        }
+
+        /// <summary>
+        ///  The baseline Results not yet matched, in their original order.
+        /// </summary>
+        public List<ExtractedResult> Baseline => _remainingBaseline ??= Remaining(_baseline, _baselineMatched);
+
+        /// <summary>
+        ///  The current Results not yet matched, in their original order.
+        /// </summary>
+        public List<ExtractedResult> Current => _remainingCurrent ??= Remaining(_current, _currentMatched);
+
+        /// <summary>
+        ///  Record that the Results in a pair (either of which may be null) have been matched.
+        /// </summary>
+        public void MarkMatched(MatchedResults match)
+        {
+            if (MarkMatched(match.PreviousResult, _baselineIndex, _baselineMatched))
+            {
+                _remainingBaseline = null;
+            }
+
+            if (MarkMatched(match.CurrentResult, _currentIndex, _currentMatched))
+            {
+                _remainingCurrent = null;
+            }
+        }
+
+        private static bool MarkMatched(ExtractedResult result, Dictionary<ExtractedResult, int> index, bool[] matched)
+        {
+            if (result == null || !index.TryGetValue(result, out int i) || matched[i]) { return false; }
+
+            matched[i] = true;
+            return true;
+        }
+
+        private static Dictionary<ExtractedResult, int> BuildIndex(List<ExtractedResult> results)
+        {
+            var index = new Dictionary<ExtractedResult, int>(results.Count);
+            for (int i = 0; i < results.Count; ++i)
+            {
+                index[results[i]] = i;
+            }
+
+            return index;
+        }
+
+        private static List<ExtractedResult> Remaining(List<ExtractedResult> results, bool[] matched)
+        {
+            var remaining = new List<ExtractedResult>();
+            for (int i = 0; i < results.Count; ++i)
+            {
+                if (!matched[i]) { remaining.Add(results[i]); }
+            }
+
+            return remaining;
+        }
+    }
+}
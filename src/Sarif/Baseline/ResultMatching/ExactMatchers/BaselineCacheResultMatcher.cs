@@ -0,0 +1,109 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching.ExactMatchers
+{
+    /// <summary>
+    ///  BaselineCacheResultMatcher carries Results in unchanged artifacts forward using a
+    ///  <see cref="BaselineCache"/>. For each artifact content hash and rule id the cache knows,
+    ///  if the current Results for that rule in that content are as many as the cached correlation
+    ///  Guids and every Guid names a baseline Result, they're paired in 'Where' order. Anything
+    ///  else is left for the matchers which follow.
+    /// </summary>
+    internal class BaselineCacheResultMatcher : IResultMatcher
+    {
+        private readonly BaselineCache _cache;
+        private readonly IFileSystem _fileSystem;
+
+        public BaselineCacheResultMatcher(BaselineCache cache, IFileSystem fileSystem = null)
+        {
+            _cache = cache ?? throw new ArgumentNullException(nameof(cache));
+            _fileSystem = fileSystem;
+        }
+
+        public IList<MatchedResults> Match(IList<ExtractedResult> baseline, IList<ExtractedResult> current)
+        {
+            var matchedResults = new List<MatchedResults>();
+            if (_cache.Count == 0 || baseline.Count == 0 || current.Count == 0) { return matchedResults; }
+
+            var baselineByCorrelationGuid = new Dictionary<Guid, ExtractedResult>();
+            foreach (ExtractedResult result in baseline)
+            {
+                Guid? correlationGuid = result.Result.CorrelationGuid ?? result.Result.Guid;
+                if (correlationGuid != null && !baselineByCorrelationGuid.ContainsKey(correlationGuid.Value))
+                {
+                    baselineByCorrelationGuid.Add(correlationGuid.Value, result);
+                }
+            }
+
+            // Each instance is used by one call, as the result matchers may run on several threads.
+            var hashes = new ArtifactContentHashes(_fileSystem);
+            var currentByKey = new Dictionary<string, List<ExtractedResult>>(StringComparer.Ordinal);
+
+            foreach (ExtractedResult result in current)
+            {
+                string key = BaselineCache.GetKey(hashes.GetHash(result.Result, result.OriginalRun), result.RuleId);
+                if (key == null) { continue; }
+
+                if (!currentByKey.TryGetValue(key, out List<ExtractedResult> group))
+                {
+                    group = new List<ExtractedResult>();
+                    currentByKey[key] = group;
+                }
+
+                group.Add(result);
+            }
+
+            var used = new HashSet<ExtractedResult>();
+
+            foreach (KeyValuePair<string, List<ExtractedResult>> group in currentByKey)
+            {
+                if (!_cache.TryGetCorrelationGuids(group.Key, out List<Guid> correlationGuids) ||
+                    correlationGuids.Count != group.Value.Count)
+                {
+                    continue;
+                }
+
+                List<ExtractedResult> previous = FindBaselineResults(correlationGuids, baselineByCorrelationGuid, used, group.Value[0].RuleId);
+                if (previous == null) { continue; }
+
+                int i = 0;
+                foreach (ExtractedResult result in BaselineCache.OrderByWhere(group.Value))
+                {
+                    used.Add(previous[i]);
+                    matchedResults.Add(new MatchedResults(previous[i++], result));
+                }
+            }
+
+            return matchedResults;
+        }
+
+        private static List<ExtractedResult> FindBaselineResults(
+            List<Guid> correlationGuids,
+            Dictionary<Guid, ExtractedResult> baselineByCorrelationGuid,
+            HashSet<ExtractedResult> used,
+            string ruleId)
+        {
+            var previous = new List<ExtractedResult>(correlationGuids.Count);
+
+            foreach (Guid correlationGuid in correlationGuids)
+            {
+                if (!baselineByCorrelationGuid.TryGetValue(correlationGuid, out ExtractedResult result) ||
+                    used.Contains(result) ||
+                    previous.Contains(result) ||
+                    result.RuleId != ruleId)
+                {
+                    return null;
+                }
+
+                previous.Add(result);
+            }
+
+            return previous;
+        }
+    }
+}
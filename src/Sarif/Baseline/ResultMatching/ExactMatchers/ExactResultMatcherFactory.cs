@@ -20,5 +20,13 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching.ExactMatchers
         {
             return new FullFingerprintResultMatcher();
         }
+
+        /// <summary>
+        /// Returns a result matcher that carries results in artifacts whose content hasn't changed forward using a <see cref="BaselineCache"/>.
+        /// </summary>
+        public static IResultMatcher GetBaselineCacheResultMatcher(BaselineCache cache, IFileSystem fileSystem = null)
+        {
+            return new BaselineCacheResultMatcher(cache, fileSystem);
+        }
     }
 }
@@ -0,0 +1,19 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using Newtonsoft.Json;
+
+namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching
+{
+    public interface IStreamingSarifLogMatcher
+    {
+        /// <summary>
+        /// Match the results of a single-run current log against a single-run baseline log, writing
+        /// the baselined log to <paramref name="output"/> one result at a time.
+        /// </summary>
+        /// <param name="previousLog">The baseline log, or null; best loaded with <see cref="SarifLog.LoadDeferred(string)"/>.</param>
+        /// <param name="currentLog">The current log; best loaded with <see cref="SarifLog.LoadDeferred(string)"/>.</param>
+        /// <param name="output">The writer to receive the baselined log.</param>
+        void Match(SarifLog previousLog, SarifLog currentLog, JsonWriter output);
+    }
+}
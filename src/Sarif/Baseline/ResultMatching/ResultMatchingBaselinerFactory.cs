@@ -16,33 +16,96 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching
         /// <returns>A result matching baseliner instance with the default set of strategies.</returns>
         public static ISarifLogMatcher GetDefaultResultMatchingBaseliner(bool oldAlgorithm = false)
         {
+            return GetDefaultResultMatchingBaseliner(oldAlgorithm, partitionByArtifact: false, maxDegreeOfParallelism: 0);
+        }
+
+        /// <summary>
+        /// Get a Result Matching Baseliner that matches results between two groups of Sarif Logs using a sensible default set of rules for matching results.
+        /// </summary>
+        /// <param name="oldAlgorithm">True to use the original exact and partial fingerprint matchers rather than V2ResultMatcher.</param>
+        /// <param name="partitionByArtifact">
+        /// True to baseline each tool's runs in parallel and, within each tool, to have V2ResultMatcher hash 'What'
+        /// properties and match each artifact's results in parallel, for large logs.
+        /// </param>
+        /// <param name="maxDegreeOfParallelism">The maximum number of tools, and of artifacts per tool, to match at once; zero or less for no limit.</param>
+        /// <returns>A result matching baseliner instance with the default set of strategies.</returns>
+        public static ISarifLogMatcher GetDefaultResultMatchingBaseliner(bool oldAlgorithm, bool partitionByArtifact, int maxDegreeOfParallelism)
+        {
+            return GetDefaultResultMatchingBaseliner(oldAlgorithm, partitionByArtifact, maxDegreeOfParallelism, baselineCache: null, fileSystem: null);
+        }
+
+        /// <summary>
+        /// Get a Result Matching Baseliner that matches results between two groups of Sarif Logs using a sensible default set of rules for matching results.
+        /// </summary>
+        /// <param name="oldAlgorithm">True to use the original exact and partial fingerprint matchers rather than V2ResultMatcher.</param>
+        /// <param name="partitionByArtifact">
+        /// True to baseline each tool's runs in parallel and, within each tool, to have V2ResultMatcher hash 'What'
+        /// properties and match each artifact's results in parallel, for large logs.
+        /// </param>
+        /// <param name="maxDegreeOfParallelism">The maximum number of tools, and of artifacts per tool, to match at once; zero or less for no limit.</param>
+        /// <param name="baselineCache">
+        /// A cache built from the previous log, or null. Results in artifacts whose content is unchanged since then
+        /// are carried forward from the cache before any other matcher runs.
+        /// </param>
+        /// <param name="fileSystem">The file system through which to read artifacts to hash them for the baseline cache; null for the real file system.</param>
+        /// <returns>A result matching baseliner instance with the default set of strategies.</returns>
+        public static ISarifLogMatcher GetDefaultResultMatchingBaseliner(bool oldAlgorithm, bool partitionByArtifact, int maxDegreeOfParallelism, BaselineCache baselineCache, IFileSystem fileSystem)
+        {
+            var exactMatchers = new List<IResultMatcher>();
+            if (baselineCache != null)
+            {
+                exactMatchers.Add(ExactResultMatcherFactory.GetBaselineCacheResultMatcher(baselineCache, fileSystem));
+            }
+
             if (oldAlgorithm)
             {
+                // Exact matchers run first, in order.  These should do *no* remapping and offer fast comparisons to filter out
+                // common cases (e.x. identical results).
+                exactMatchers.Add(ExactResultMatcherFactory.GetIdenticalResultMatcher(considerPropertyBagsWhenComparing: true));
+
                 return new SarifLogResultMatcher
                     (
-                        // Exact matchers run first, in order.  These should do *no* remapping and offer fast comparisons to filter out
-                        // common cases (e.x. identical results).
-                        new List<IResultMatcher>()
-                        {
-                            ExactResultMatcherFactory.GetIdenticalResultMatcher(considerPropertyBagsWhenComparing: true)
-                        },
+                        exactMatchers,
                         // Heuristic matchers run in order after the exact matchers.
                         // These can do remapping, and catch the long tail of "changed" results.
                         new List<IResultMatcher>()
                         {
                             HeuristicResultMatcherFactory.GetPartialFingerprintResultMatcher()
-                        }
+                        },
+                        DictionaryMergeBehavior.None,
+                        parallelizeByTool: partitionByArtifact,
+                        maxDegreeOfParallelism
                     );
             }
             else
             {
+                exactMatchers.Add(new V2ResultMatcher(partitionByArtifact, maxDegreeOfParallelism));
+
                 return new SarifLogResultMatcher(
-                    new List<IResultMatcher>() { new V2ResultMatcher() },
-                    new List<IResultMatcher>()
+                    exactMatchers,
+                    new List<IResultMatcher>(),
+                    DictionaryMergeBehavior.None,
+                    parallelizeByTool: partitionByArtifact,
+                    maxDegreeOfParallelism
                 );
             }
         }
 
+        /// <summary>
+        /// Get a Result Matching Baseliner that matches a current log against a baseline log, one run each, and
+        /// streams out the baselined log without holding either log's results in memory.
+        /// </summary>
+        /// <param name="partitionByArtifact">True to have V2ResultMatcher hash 'What' properties and match each artifact's results in parallel, for large logs.</param>
+        /// <param name="maxDegreeOfParallelism">The maximum number of artifacts to match at once; zero or less for no limit.</param>
+        /// <returns>A streaming result matching baseliner instance with the default set of strategies.</returns>
+        public static IStreamingSarifLogMatcher GetStreamingResultMatchingBaseliner(bool partitionByArtifact = false, int maxDegreeOfParallelism = 0)
+        {
+            return new SarifLogResultMatcher(
+                new List<IResultMatcher>() { new V2ResultMatcher(partitionByArtifact, maxDegreeOfParallelism) },
+                new List<IResultMatcher>()
+            );
+        }
+
         /// <summary>
         /// Get a result matching baseliner that matches results between two groups of sarif logs using a
         /// </summary>
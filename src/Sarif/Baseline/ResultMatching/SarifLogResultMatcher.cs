@@ -5,32 +5,60 @@ using System;
 using System.Collections.Generic;
 using System.Diagnostics;
 using System.Linq;
+using System.Threading.Tasks;
 
 using Microsoft.CodeAnalysis.Sarif.Processors;
+using Microsoft.CodeAnalysis.Sarif.Readers;
 using Microsoft.CodeAnalysis.Sarif.Visitors;
+using Microsoft.CodeAnalysis.Sarif.Writers;
+
+using Newtonsoft.Json;
 
 namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching
 {
     /// <summary>
     /// Default Result Matching Baseliner.
     /// </summary>
-    internal class SarifLogResultMatcher : ISarifLogMatcher
+    internal class SarifLogResultMatcher : ISarifLogMatcher, IStreamingSarifLogMatcher
     {
         public const string ResultMatchingResultPropertyName = "ResultMatching";
 
+        // The number of matched pairs whose Results are read back together, in index order, when streaming.
+        internal const int StreamingReadBatchSize = 4096;
+
         public SarifLogResultMatcher(
             IEnumerable<IResultMatcher> exactResultMatchers,
             IEnumerable<IResultMatcher> heuristicMatchers,
             DictionaryMergeBehavior propertyBagMergeBehaviors = DictionaryMergeBehavior.None)
+            : this(exactResultMatchers, heuristicMatchers, propertyBagMergeBehaviors, parallelizeByTool: false, maxDegreeOfParallelism: 0)
+        {
+        }
+
+        /// <param name="parallelizeByTool">
+        /// True to baseline each tool's Runs in parallel. Results are only ever matched against Results
+        /// from the same tool, and each tool's output is merged in the order the tools were first seen,
+        /// so the output is the same as baselining them one at a time.
+        /// </param>
+        /// <param name="maxDegreeOfParallelism">The maximum number of tools to baseline at once; zero or less for no limit.</param>
+        public SarifLogResultMatcher(
+            IEnumerable<IResultMatcher> exactResultMatchers,
+            IEnumerable<IResultMatcher> heuristicMatchers,
+            DictionaryMergeBehavior propertyBagMergeBehaviors,
+            bool parallelizeByTool,
+            int maxDegreeOfParallelism)
         {
             ExactResultMatchers = exactResultMatchers;
             HeuristicMatchers = heuristicMatchers;
             PropertyBagMergeBehavior = propertyBagMergeBehaviors;
+            ParallelizeByTool = parallelizeByTool;
+            MaxDegreeOfParallelism = maxDegreeOfParallelism > 0 ? maxDegreeOfParallelism : -1;
         }
 
         public IEnumerable<IResultMatcher> ExactResultMatchers { get; }
         public IEnumerable<IResultMatcher> HeuristicMatchers { get; }
         public DictionaryMergeBehavior PropertyBagMergeBehavior { get; }
+        public bool ParallelizeByTool { get; }
+        public int MaxDegreeOfParallelism { get; }
 
         /// <summary>
         /// Helper function that accepts a single baseline and current SARIF log and matches them.
@@ -53,13 +81,15 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching
         /// <returns>A SARIF log with the merged set of results.</returns>
         public IEnumerable<SarifLog> Match(IEnumerable<SarifLog> previousLogs, IEnumerable<SarifLog> currentLogs)
         {
-            var resultToolLogs = new List<SarifLog>();
             Dictionary<string, List<Run>> runsByToolCurrent = GetRunsByTool(currentLogs);
             Dictionary<string, List<Run>> runsByToolPrevious = GetRunsByTool(previousLogs);
 
-            foreach (KeyValuePair<string, List<Run>> runByToolCurrent in runsByToolCurrent)
+            var runsByTool = runsByToolCurrent.ToList();
+            var resultToolLogs = new SarifLog[runsByTool.Count];
+
+            void BaselineTool(int i)
             {
-                string key = runByToolCurrent.Key;
+                string key = runsByTool[i].Key;
 
                 IEnumerable<Run> baselineRuns = new Run[0];
                 if (runsByToolPrevious.TryGetValue(key, out List<Run> runs))
@@ -67,13 +97,180 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching
                     baselineRuns = runs;
                 }
 
-                IEnumerable<Run> currentRuns = runByToolCurrent.Value;
-                resultToolLogs.Add(BaselineSarifLogs(baselineRuns, currentRuns));
+                IEnumerable<Run> currentRuns = runsByTool[i].Value;
+                resultToolLogs[i] = BaselineSarifLogs(baselineRuns, currentRuns);
+            }
+
+            if (ParallelizeByTool && runsByTool.Count > 1)
+            {
+                // Each tool's log lands in its own slot, so the merge below sees them in the same order either way.
+                Parallel.For(0, runsByTool.Count, new ParallelOptions { MaxDegreeOfParallelism = MaxDegreeOfParallelism }, BaselineTool);
+            }
+            else
+            {
+                for (int i = 0; i < runsByTool.Count; i++)
+                {
+                    BaselineTool(i);
+                }
             }
 
             return new List<SarifLog> { resultToolLogs.Merge(mergeEmptyLogs: true) };
         }
 
+        /// <summary>
+        /// Match a single-run current log against a single-run baseline log without holding either
+        /// log's Results in memory. Each Result is reduced to a compact projection of the properties
+        /// the matchers compare, the projections are matched, and then each matched Result is read
+        /// back from its log, baselined, and written to <paramref name="output"/>. Results are read
+        /// back a batch of pairs at a time, in index order, so that logs loaded with
+        /// <see cref="SarifLog.LoadDeferred(string)"/> are read forward rather than sought per Result.
+        /// </summary>
+        /// <param name="previousLog">The SARIF log representing the baseline run, or null</param>
+        /// <param name="currentLog">The SARIF log representing the current run</param>
+        /// <param name="output">The writer to receive the SARIF log with the merged set of results.</param>
+        public void Match(SarifLog previousLog, SarifLog currentLog, JsonWriter output)
+        {
+            if (output == null) { throw new ArgumentNullException(nameof(output)); }
+
+            Run currentRun = GetSingleRun(currentLog, nameof(currentLog)) ?? throw new ArgumentNullException(nameof(currentLog));
+            Run previousRun = GetSingleRun(previousLog, nameof(previousLog));
+
+            // As in the non-streaming Match, only Runs from the same tool are compared.
+            if (previousRun != null &&
+                !string.Equals(previousRun.Tool.Driver.Name, currentRun.Tool.Driver.Name, StringComparison.OrdinalIgnoreCase))
+            {
+                previousRun = null;
+            }
+
+            Run[] previousRuns = previousRun == null ? new Run[0] : new[] { previousRun };
+            Run[] currentRuns = new[] { currentRun };
+
+            // ExtractedResult doesn't override Equals, so these map each projection by reference to its Result index.
+            var previousIndices = new Dictionary<ExtractedResult, int>();
+            var currentIndices = new Dictionary<ExtractedResult, int>();
+
+            List<ExtractedResult> baselineResults = ExtractProjectedResults(previousRun, previousIndices);
+            List<ExtractedResult> currentResults = ExtractProjectedResults(currentRun, currentIndices);
+
+            var matchedResults = new List<MatchedResults>();
+            var unmatchedResults = new UnmatchedResults(baselineResults, currentResults);
+
+            CalculateMatches(ExactResultMatchers, unmatchedResults, matchedResults);
+            CalculateMatches(HeuristicMatchers, unmatchedResults, matchedResults);
+            AddUnmatchedResults(unmatchedResults.Baseline, unmatchedResults.Current, matchedResults);
+
+            Run run = CreateBaselinedRun(previousRuns, currentRuns);
+            var visitor = new RunMergingVisitor(retainResults: false);
+
+            using (var writer = new ResultLogJsonWriter(output))
+            {
+                writer.Initialize(run);
+                writer.OpenResults();
+
+                for (int batchStart = 0; batchStart < matchedResults.Count; batchStart += StreamingReadBatchSize)
+                {
+                    int batchEnd = Math.Min(batchStart + StreamingReadBatchSize, matchedResults.Count);
+
+                    Dictionary<int, Result> previousBatch = ReadResultsInIndexOrder(previousRun, matchedResults, batchStart, batchEnd, pair => pair.PreviousResult, previousIndices);
+                    Dictionary<int, Result> currentBatch = ReadResultsInIndexOrder(currentRun, matchedResults, batchStart, batchEnd, pair => pair.CurrentResult, currentIndices);
+
+                    for (int i = batchStart; i < batchEnd; i++)
+                    {
+                        MatchedResults projectedPair = matchedResults[i];
+                        matchedResults[i] = null;
+
+                        ExtractedResult previous = projectedPair.PreviousResult == null
+                            ? null
+                            : new ExtractedResult(previousBatch[previousIndices[projectedPair.PreviousResult]], previousRun);
+
+                        ExtractedResult current = projectedPair.CurrentResult == null
+                            ? null
+                            : new ExtractedResult(currentBatch[currentIndices[projectedPair.CurrentResult]], currentRun);
+
+                        Result result = new MatchedResults(previous, current).CalculateBasedlinedResult(PropertyBagMergeBehavior);
+
+                        visitor.CurrentRun = result.Run;
+                        visitor.VisitResult(result);
+
+                        writer.WriteResult(result);
+                    }
+                }
+
+                writer.CloseResults();
+
+                // The rules, artifacts and logical locations the Results refer to are written after them.
+                visitor.PopulateWithMerged(run);
+                CompleteBaselinedRun(run, previousRuns, currentRuns);
+            }
+        }
+
+        private static Dictionary<int, Result> ReadResultsInIndexOrder(Run run,
+                                                                       List<MatchedResults> matchedResults,
+                                                                       int batchStart,
+                                                                       int batchEnd,
+                                                                       Func<MatchedResults, ExtractedResult> selectProjection,
+                                                                       Dictionary<ExtractedResult, int> indices)
+        {
+            var sortedIndices = new List<int>();
+            for (int i = batchStart; i < batchEnd; i++)
+            {
+                ExtractedResult projection = selectProjection(matchedResults[i]);
+                if (projection != null) { sortedIndices.Add(indices[projection]); }
+            }
+
+            sortedIndices.Sort();
+
+            var results = new Dictionary<int, Result>(sortedIndices.Count);
+            if (sortedIndices.Count == 0) { return results; }
+
+            IEnumerable<Result> readResults = run.Results is DeferredList<Result> deferredResults
+                ? deferredResults.ReadItems(sortedIndices)
+                : sortedIndices.Select(index => run.Results[index]);
+
+            int position = 0;
+            foreach (Result result in readResults)
+            {
+                results[sortedIndices[position++]] = result;
+            }
+
+            return results;
+        }
+
+        private static Run GetSingleRun(SarifLog log, string parameterName)
+        {
+            if (log?.Runs == null || log.Runs.Count == 0) { return null; }
+
+            if (log.Runs.Count > 1)
+            {
+                throw new ArgumentException("Streaming result matching requires logs with a single run.", parameterName);
+            }
+
+            return log.Runs[0];
+        }
+
+        private static List<ExtractedResult> ExtractProjectedResults(Run run, Dictionary<ExtractedResult, int> indices)
+        {
+            var results = new List<ExtractedResult>();
+            if (run?.Results == null) { return results; }
+
+            // Enumerate (rather than index) so that a deferred log is read through once, in order.
+            int index = 0;
+            foreach (Result result in run.Results)
+            {
+                // Include all Results except Absent results
+                if (result.BaselineState != BaselineState.Absent)
+                {
+                    var projected = new ExtractedResult(ResultMatchingProjection.Project(result, run), run);
+                    results.Add(projected);
+                    indices[projected] = index;
+                }
+
+                index++;
+            }
+
+            return results;
+        }
+
         private static Dictionary<string, List<Run>> GetRunsByTool(IEnumerable<SarifLog> sarifLogs)
         {
             var runsByTool = new Dictionary<string, List<Run>>(StringComparer.OrdinalIgnoreCase);
@@ -116,15 +313,16 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching
                 current == null ? new List<ExtractedResult>() : ExtractResultsFromRuns(current);
 
             var matchedResults = new List<MatchedResults>();
+            var unmatchedResults = new UnmatchedResults(baselineResults, currentResults);
 
             // Calculate exact mappings using exactResultMatchers.
-            CalculateMatches(ExactResultMatchers, baselineResults, currentResults, matchedResults);
+            CalculateMatches(ExactResultMatchers, unmatchedResults, matchedResults);
 
             // Use the heuristic matchers to match remaining results.
-            CalculateMatches(HeuristicMatchers, baselineResults, currentResults, matchedResults);
+            CalculateMatches(HeuristicMatchers, unmatchedResults, matchedResults);
 
             // Add unmatched results here.
-            AddUnmatchedResults(baselineResults, currentResults, matchedResults);
+            AddUnmatchedResults(unmatchedResults.Baseline, unmatchedResults.Current, matchedResults);
 
             // Create a combined SARIF log with the total results.
             return ConstructSarifLogFromMatchedResults(matchedResults, previous, current);
@@ -144,17 +342,17 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching
             }
         }
 
-        private void CalculateMatches(IEnumerable<IResultMatcher> matchers, List<ExtractedResult> baselineResults, List<ExtractedResult> currentResults, List<MatchedResults> matchedResults)
+        private void CalculateMatches(IEnumerable<IResultMatcher> matchers, UnmatchedResults unmatchedResults, List<MatchedResults> matchedResults)
         {
             if (matchers != null)
             {
                 foreach (IResultMatcher matcher in matchers)
                 {
-                    IEnumerable<MatchedResults> results = matcher.Match(baselineResults, currentResults);
+                    // Each matcher sees only the Results which earlier matchers left unmatched.
+                    IList<MatchedResults> results = matcher.Match(unmatchedResults.Baseline, unmatchedResults.Current);
                     foreach (MatchedResults result in results)
                     {
-                        baselineResults.Remove(result.PreviousResult);
-                        currentResults.Remove(result.CurrentResult);
+                        unmatchedResults.MarkMatched(result);
                     }
                     matchedResults.AddRange(results);
                 }
@@ -186,6 +384,32 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching
             IEnumerable<MatchedResults> results,
             IEnumerable<Run> previousRuns,
             IEnumerable<Run> currentRuns)
+        {
+            Run run = CreateBaselinedRun(previousRuns, currentRuns);
+
+            var visitor = new RunMergingVisitor();
+
+            foreach (MatchedResults resultPair in results)
+            {
+                Result result = resultPair.CalculateBasedlinedResult(PropertyBagMergeBehavior);
+
+                visitor.CurrentRun = result.Run;
+                visitor.VisitResult(result);
+            }
+
+            visitor.PopulateWithMerged(run);
+
+            CompleteBaselinedRun(run, previousRuns, currentRuns);
+
+            return new SarifLog()
+            {
+                Version = SarifVersion.Current,
+                SchemaUri = new Uri(SarifUtilities.SarifSchemaUri),
+                Runs = new Run[] { run }
+            };
+        }
+
+        private static Run CreateBaselinedRun(IEnumerable<Run> previousRuns, IEnumerable<Run> currentRuns)
         {
             if (currentRuns == null || !currentRuns.Any())
             {
@@ -224,18 +448,11 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching
                 run.BaselineGuid = previousRuns.First().AutomationDetails?.Guid;
             }
 
-            var visitor = new RunMergingVisitor();
-
-            foreach (MatchedResults resultPair in results)
-            {
-                Result result = resultPair.CalculateBasedlinedResult(PropertyBagMergeBehavior);
-
-                visitor.CurrentRun = result.Run;
-                visitor.VisitResult(result);
-            }
-
-            visitor.PopulateWithMerged(run);
+            return run;
+        }
 
+        private void CompleteBaselinedRun(Run run, IEnumerable<Run> previousRuns, IEnumerable<Run> currentRuns)
+        {
             IDictionary<string, SerializedPropertyInfo> properties = null;
             if (PropertyBagMergeBehavior.HasFlag(DictionaryMergeBehavior.InitializeFromOldest))
             {
@@ -297,13 +514,6 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching
             run.Invocations = invocations;
             run.Properties = properties;
             run.VersionControlProvenance = versionControls.Any() ? versionControls : null;
-
-            return new SarifLog()
-            {
-                Version = SarifVersion.Current,
-                SchemaUri = new Uri(SarifUtilities.SarifSchemaUri),
-                Runs = new Run[] { run }
-            };
         }
 
         internal static void MergeDictionaryInto<T, S>(
@@ -3,6 +3,7 @@
 
 using System;
 using System.Collections.Generic;
+using System.Threading.Tasks;
 
 using Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching;
 
@@ -10,9 +11,29 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
 {
     public class V2ResultMatcher : IResultMatcher
     {
+        private readonly bool _partitionByArtifact;
+        private readonly int _maxDegreeOfParallelism;
+
+        public V2ResultMatcher() : this(partitionByArtifact: false)
+        { }
+
+        /// <param name="partitionByArtifact">
+        ///  True to match large batches of Results faster. 'What' properties are compared by 64-bit
+        ///  hash, and the Results for each artifact are matched as an independent bucket, in parallel.
+        ///  Matches can differ from the default only where nearby Results in different artifacts are similar.
+        /// </param>
+        /// <param name="maxDegreeOfParallelism">
+        ///  The maximum number of artifact buckets to match at once; zero or less for no limit.
+        /// </param>
+        public V2ResultMatcher(bool partitionByArtifact, int maxDegreeOfParallelism = 0)
+        {
+            _partitionByArtifact = partitionByArtifact;
+            _maxDegreeOfParallelism = maxDegreeOfParallelism > 0 ? maxDegreeOfParallelism : -1;
+        }
+
         public IList<MatchedResults> Match(IList<ExtractedResult> before, IList<ExtractedResult> after)
         {
-            var state = new StatefulResultMatcher(before, after);
+            var state = new StatefulResultMatcher(before, after, _partitionByArtifact, _maxDegreeOfParallelism);
             return state.Match();
         }
     }
@@ -32,6 +53,9 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
         // Threshold for how many 'nearby' Results are considered after other match phases
         private const int NearnessThreshold = 3;
 
+        private readonly bool _partitionByArtifact;
+        private readonly int _maxDegreeOfParallelism;
+
         // Results in the first set.
         private readonly List<ExtractedResult> _before;
         private readonly TrustMap _beforeTrustMap;
@@ -45,13 +69,20 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
         private readonly int[] _matchingIndexFromAfter;
 
         public StatefulResultMatcher(IList<ExtractedResult> before, IList<ExtractedResult> after)
+            : this(before, after, partitionByArtifact: false, maxDegreeOfParallelism: -1)
+        { }
+
+        public StatefulResultMatcher(IList<ExtractedResult> before, IList<ExtractedResult> after, bool partitionByArtifact, int maxDegreeOfParallelism)
         {
+            _partitionByArtifact = partitionByArtifact;
+            _maxDegreeOfParallelism = maxDegreeOfParallelism;
+
             // Sort results by 'Where', then 'RuleId' for matching
             _before = new List<ExtractedResult>(before);
             _before.Sort(ResultMatchingComparer.Instance);
 
             _beforeTrustMap = new TrustMap();
-            _beforeWhatMap = new WhatMap();
+            _beforeWhatMap = new WhatMap(hashComponents: partitionByArtifact);
 
             _matchingIndexFromBefore = new int[_before.Count];
             Fill(_matchingIndexFromBefore, -1);
@@ -60,7 +91,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
             _after.Sort(ResultMatchingComparer.Instance);
 
             _afterTrustMap = new TrustMap();
-            _afterWhatMap = new WhatMap();
+            _afterWhatMap = new WhatMap(hashComponents: partitionByArtifact);
 
             _matchingIndexFromAfter = new int[_after.Count];
             Fill(_matchingIndexFromAfter, -1);
@@ -80,17 +111,84 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
                     LinkIfSimilar(0, 0);
                 }
             }
+            else if (_partitionByArtifact)
+            {
+                LinkByArtifact();
+            }
             else
             {
-                LinkResultsWithIdenticalWhere();
-                LinkFirstAndLastFromSameArtifact();
+                LinkResultsWithIdenticalWhere(0, _before.Count, 0, _after.Count);
+                LinkFirstAndLastFromSameArtifact(0, _before.Count, 0, _after.Count);
                 LinkResultsWithUniqueIdenticalWhat();
-                LinkNearbySimilarResults();
+                LinkNearbySimilarResults(0, _before.Count, 0, _after.Count);
             }
 
             return BuildMatchList();
         }
 
+        private void LinkByArtifact()
+        {
+            List<ArtifactBucket> buckets = PairArtifactBuckets();
+            var parallelOptions = new ParallelOptions { MaxDegreeOfParallelism = _maxDegreeOfParallelism };
+
+            // Each bucket links only Results within its own ranges, so buckets can be matched concurrently.
+            Parallel.ForEach(buckets, parallelOptions, (bucket) =>
+            {
+                LinkResultsWithIdenticalWhere(bucket.BeforeStart, bucket.BeforeEnd, bucket.AfterStart, bucket.AfterEnd);
+                LinkFirstAndLastFromSameArtifact(bucket.BeforeStart, bucket.BeforeEnd, bucket.AfterStart, bucket.AfterEnd);
+            });
+
+            // Unique 'What' links can cross artifacts (renamed files), so they're found across all Results.
+            LinkResultsWithUniqueIdenticalWhat();
+
+            Parallel.ForEach(buckets, parallelOptions, (bucket) =>
+            {
+                LinkNearbySimilarResults(bucket.BeforeStart, bucket.BeforeEnd, bucket.AfterStart, bucket.AfterEnd);
+            });
+
+            // Finish with one pass over all Results, for neighbors of pairs linked across artifacts.
+            // Almost every neighbor is linked by now, so this pass does little work.
+            LinkNearbySimilarResults(0, _before.Count, 0, _after.Count);
+        }
+
+        /// <summary>
+        ///  Find the ranges of Before and After Results (which are sorted by 'Where') with
+        ///  each first artifact Uri found in both sets.
+        /// </summary>
+        private List<ArtifactBucket> PairArtifactBuckets()
+        {
+            var buckets = new List<ArtifactBucket>();
+
+            int beforeIndex = 0, afterIndex = 0;
+            while (beforeIndex < _before.Count && afterIndex < _after.Count)
+            {
+                int uriCmp = WhereComparer.CompareFirstArtifactUri(_before[beforeIndex], _after[afterIndex]);
+                int beforeEnd = EndOfArtifact(_before, beforeIndex);
+                int afterEnd = EndOfArtifact(_after, afterIndex);
+
+                if (uriCmp == 0)
+                {
+                    buckets.Add(new ArtifactBucket(beforeIndex, beforeEnd, afterIndex, afterEnd));
+                }
+
+                if (uriCmp <= 0) { beforeIndex = beforeEnd; }
+                if (uriCmp >= 0) { afterIndex = afterEnd; }
+            }
+
+            return buckets;
+        }
+
+        private static int EndOfArtifact(List<ExtractedResult> set, int fromIndex)
+        {
+            int end = fromIndex + 1;
+            while (end < set.Count && WhereComparer.CompareFirstArtifactUri(set[fromIndex], set[end]) == 0)
+            {
+                end++;
+            }
+
+            return end;
+        }
+
         private void BuildMaps()
         {
             // Identify all locations used in each log
@@ -101,24 +199,37 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
             _after.ForEach((result) => WhereComparer.AddLocationIdentifiers(result, afterLocationIdentifiers));
 
             // Populate WhatMap and TrustMap to guide subsequent matching
-            BuildMap(_before, _beforeWhatMap, _beforeTrustMap, otherRunLocations: afterLocationIdentifiers);
-            BuildMap(_after, _afterWhatMap, _afterTrustMap, otherRunLocations: beforeLocationIdentifiers);
+            BuildMap(_before, _beforeWhatMap, _beforeTrustMap, otherRunLocations: afterLocationIdentifiers, _partitionByArtifact, _maxDegreeOfParallelism);
+            BuildMap(_after, _afterWhatMap, _afterTrustMap, otherRunLocations: beforeLocationIdentifiers, _partitionByArtifact, _maxDegreeOfParallelism);
 
             // Match the TrustMaps to finish determining trust
             _afterTrustMap.CountMatchesWith(_beforeTrustMap);
         }
 
-        private static void BuildMap(List<ExtractedResult> results, WhatMap whatMap, TrustMap trustMap, HashSet<string> otherRunLocations)
+        private static void BuildMap(List<ExtractedResult> results, WhatMap whatMap, TrustMap trustMap, HashSet<string> otherRunLocations, bool inParallel, int maxDegreeOfParallelism)
         {
+            // Building the components (formatting messages) is the costly part, so it may be done in parallel.
+            // The maps are then populated in Result order, so that they're the same either way.
+            var components = new List<WhatComponent>[results.Count];
+            if (inParallel)
+            {
+                Parallel.For(0, results.Count, new ParallelOptions { MaxDegreeOfParallelism = maxDegreeOfParallelism }, (i) =>
+                {
+                    components[i] = BuildComponents(results[i], otherRunLocations);
+                });
+            }
+            else
+            {
+                for (int i = 0; i < results.Count; ++i)
+                {
+                    components[i] = BuildComponents(results[i], otherRunLocations);
+                }
+            }
+
             // Populate the WhatMap and TrustMap
             for (int i = 0; i < results.Count; ++i)
             {
-                ExtractedResult result = results[i];
-
-                // Find the LocationSpecifier for the Result (the first Uri or FQN also in the other Run)
-                string locationSpecifier = WhereComparer.LocationSpecifier(result, otherRunLocations);
-
-                foreach (WhatComponent component in WhatComparer.WhatProperties(result, locationSpecifier))
+                foreach (WhatComponent component in components[i])
                 {
                     // Add Result attributes used as matching hints in a "bucket" for the Rule x LocationSpecifier x AttributeName
                     whatMap.Add(component, i);
@@ -129,11 +240,19 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
             }
         }
 
-        private void LinkResultsWithIdenticalWhere()
+        private static List<WhatComponent> BuildComponents(ExtractedResult result, HashSet<string> otherRunLocations)
+        {
+            // Find the LocationSpecifier for the Result (the first Uri or FQN also in the other Run)
+            string locationSpecifier = WhereComparer.LocationSpecifier(result, otherRunLocations);
+
+            return new List<WhatComponent>(WhatComparer.WhatProperties(result, locationSpecifier));
+        }
+
+        private void LinkResultsWithIdenticalWhere(int beforeStart, int beforeEnd, int afterStart, int afterEnd)
         {
             // Walk Results sorted by where, linking those with identical positions and a matching category.
-            int beforeIndex = 0, afterIndex = 0;
-            while (beforeIndex < _before.Count && afterIndex < _after.Count)
+            int beforeIndex = beforeStart, afterIndex = afterStart;
+            while (beforeIndex < beforeEnd && afterIndex < afterEnd)
             {
                 ExtractedResult left = _before[beforeIndex];
                 ExtractedResult right = _after[afterIndex];
@@ -164,20 +283,20 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
             }
         }
 
-        private void LinkFirstAndLastFromSameArtifact()
+        private void LinkFirstAndLastFromSameArtifact(int beforeStart, int beforeEnd, int afterStart, int afterEnd)
         {
-            int afterIndex = 0;
-            int beforeIndex = 0;
+            int afterIndex = afterStart;
+            int beforeIndex = beforeStart;
 
             // Walk Before and After once, looking for the first and last results per Uri
             // NOTE: 'beforeIndex' and 'afterIndex' are passed by ref to FirstWithUri and LastWithUri, which move them forward only.
-            while (beforeIndex < _before.Count && afterIndex < _after.Count)
+            while (beforeIndex < beforeEnd && afterIndex < afterEnd)
             {
                 // Get the next After Result (the first for a given Uri)
                 ExtractedResult afterFirstForUri = _after[afterIndex];
 
                 // Look for the first Before Result with the same Uri, if any
-                ExtractedResult beforeFirstForUri = FirstWithUri(afterFirstForUri, _before, ref beforeIndex);
+                ExtractedResult beforeFirstForUri = FirstWithUri(afterFirstForUri, _before, ref beforeIndex, beforeEnd);
 
                 // If there was one...
                 if (beforeFirstForUri != null)
@@ -186,8 +305,8 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
                     LinkIfSimilar(beforeIndex, afterIndex);
 
                     // ... Find the last Before and After result with the same Uri
-                    ExtractedResult beforeLastForUri = LastWithUri(afterFirstForUri, _before, ref beforeIndex);
-                    ExtractedResult afterLastForUri = LastWithUri(afterFirstForUri, _after, ref afterIndex);
+                    ExtractedResult beforeLastForUri = LastWithUri(afterFirstForUri, _before, ref beforeIndex, beforeEnd);
+                    ExtractedResult afterLastForUri = LastWithUri(afterFirstForUri, _after, ref afterIndex, afterEnd);
 
                     // ... Try to link those as well (either may be the first Result if there was only one for that Uri)
                     LinkIfSimilar(beforeIndex, afterIndex);
@@ -195,7 +314,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
                 else
                 {
                     // ... If no Before results for this Uri, skip to the After Result with the next Uri
-                    LastWithUri(afterFirstForUri, _after, ref afterIndex);
+                    LastWithUri(afterFirstForUri, _after, ref afterIndex, afterEnd);
                 }
 
                 // Move to the first Result with the next Uri
@@ -211,13 +330,13 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
             }
         }
 
-        private void LinkNearbySimilarResults()
+        private void LinkNearbySimilarResults(int beforeStart, int beforeEnd, int afterStart, int afterEnd)
         {
             // Walk up, matching similar, previously unlinked Results after already linked pairs.
-            for (int beforeIndex = 0; beforeIndex < _before.Count - 1; ++beforeIndex)
+            for (int beforeIndex = beforeStart; beforeIndex < beforeEnd - 1; ++beforeIndex)
             {
                 int afterIndex = _matchingIndexFromBefore[beforeIndex];
-                if (afterIndex == -1) { continue; }
+                if (afterIndex < afterStart || afterIndex >= afterEnd) { continue; }
 
                 // This is very subtle. At first glance it seems that we only give the result pairs
                 // _immediately_ after previously linked pairs a chance to match. But when we link
@@ -226,20 +345,20 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
                 // and we'll give the next pair a chance to match as well.
                 for (int i = 1; i < NearnessThreshold; ++i)
                 {
-                    if (afterIndex + i >= _after.Count) { break; }
+                    if (afterIndex + i >= afterEnd) { break; }
                     LinkIfSimilar(beforeIndex + 1, afterIndex + i);
                 }
             }
 
             // Walk down, matching similar, previously unlinked Results before already linked pairs.
-            for (int beforeIndex = _before.Count - 1; beforeIndex > 0; --beforeIndex)
+            for (int beforeIndex = beforeEnd - 1; beforeIndex > beforeStart; --beforeIndex)
             {
                 int afterIndex = _matchingIndexFromBefore[beforeIndex];
-                if (afterIndex == -1) { continue; }
+                if (afterIndex < afterStart || afterIndex >= afterEnd) { continue; }
 
                 for (int i = 1; i < NearnessThreshold; ++i)
                 {
-                    if (afterIndex - i < 0) { break; }
+                    if (afterIndex - i < afterStart) { break; }
                     LinkIfSimilar(beforeIndex - 1, afterIndex - i);
                 }
             }
@@ -288,10 +407,10 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
             }
         }
 
-        private ExtractedResult FirstWithUri(ExtractedResult desiredUri, IList<ExtractedResult> set, ref int fromIndex)
+        private ExtractedResult FirstWithUri(ExtractedResult desiredUri, IList<ExtractedResult> set, ref int fromIndex, int endIndex)
         {
             // Find the first Result at fromIndex or later with a Uri *matching* the desired one, or null if there aren't any
-            for (; fromIndex < set.Count; ++fromIndex)
+            for (; fromIndex < endIndex; ++fromIndex)
             {
                 int whereCmp = WhereComparer.CompareFirstArtifactUri(set[fromIndex], desiredUri);
 
@@ -308,12 +427,12 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
             return null;
         }
 
-        private ExtractedResult LastWithUri(ExtractedResult desiredUri, IList<ExtractedResult> set, ref int fromIndex)
+        private ExtractedResult LastWithUri(ExtractedResult desiredUri, IList<ExtractedResult> set, ref int fromIndex, int endIndex)
         {
             ExtractedResult lastMatch = null;
 
             // Find the first Result  at fromIndex or later with a Uri *after* the desired one, saving the last Result that matched as we go
-            for (; fromIndex < set.Count; ++fromIndex)
+            for (; fromIndex < endIndex; ++fromIndex)
             {
                 int whereCmp = WhereComparer.CompareFirstArtifactUri(set[fromIndex], desiredUri);
 
@@ -343,5 +462,21 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
                 array[i] = value;
             }
         }
+
+        private readonly struct ArtifactBucket
+        {
+            public readonly int BeforeStart;
+            public readonly int BeforeEnd;
+            public readonly int AfterStart;
+            public readonly int AfterEnd;
+
+            public ArtifactBucket(int beforeStart, int beforeEnd, int afterStart, int afterEnd)
+            {
+                BeforeStart = beforeStart;
+                BeforeEnd = beforeEnd;
+                AfterStart = afterStart;
+                AfterEnd = afterEnd;
+            }
+        }
     }
 }
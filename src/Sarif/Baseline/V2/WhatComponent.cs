@@ -22,6 +22,40 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
             this.PropertyValue = propertyValue ?? "";
         }
 
+        /// <summary>
+        ///  Return a 64-bit hash of every part of the component. Used in place of the component
+        ///  itself where many components are compared; collisions are vanishingly rare.
+        /// </summary>
+        internal ulong GetKey64()
+        {
+            // FNV-1a, with a separator after each part so that ("ab", "c") and ("a", "bc") differ.
+            ulong hash = 14695981039346656037UL;
+            hash = Append(hash, this.Category);
+            hash = Append(hash, this.Location);
+            hash = Append(hash, this.PropertySet);
+            hash = Append(hash, this.PropertyName);
+            hash = Append(hash, this.PropertyValue);
+            return hash;
+        }
+
+        private static ulong Append(ulong hash, string value)
+        {
+            const ulong Prime = 1099511628211UL;
+
+            unchecked
+            {
+                if (value != null)
+                {
+                    for (int i = 0; i < value.Length; ++i)
+                    {
+                        hash = (hash ^ value[i]) * Prime;
+                    }
+                }
+
+                return (hash ^ 0xFFFF) * Prime;
+            }
+        }
+
         public override string ToString()
         {
             return $"{Category} | {Location} | {PropertySet} | {PropertyName} | {PropertyValue}";
@@ -20,9 +20,26 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
         // The value is the index of the result with that value, if unique, or -1 if in several.
         private readonly Dictionary<WhatComponent, int> _map;
 
-        public WhatMap()
+        // When components are hashed, this dictionary is used instead, keyed by WhatComponent.GetKey64.
+        private readonly Dictionary<ulong, int> _hashedMap;
+
+        public WhatMap() : this(hashComponents: false)
+        { }
+
+        /// <param name="hashComponents">
+        ///  True to key the map by 64-bit hashes of each component rather than the component strings.
+        ///  That's much faster and smaller for large batches of Results.
+        /// </param>
+        public WhatMap(bool hashComponents)
         {
-            _map = new Dictionary<WhatComponent, int>();
+            if (hashComponents)
+            {
+                _hashedMap = new Dictionary<ulong, int>();
+            }
+            else
+            {
+                _map = new Dictionary<WhatComponent, int>();
+            }
         }
 
         private void Add(ExtractedResult result, HashSet<string> otherRunLocations, int index)
@@ -41,15 +58,13 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
         {
             if (component.PropertyValue == null) { return; }
 
-            if (_map.TryGetValue(component, out int existingIndex) && existingIndex != index)
+            if (_hashedMap != null)
             {
-                // If the map has another of this value, set index -1 to indicate non-unique.
-                _map[component] = -1;
+                Add(_hashedMap, component.GetKey64(), index);
             }
             else
             {
-                // Otherwise, point to the result.
-                _map[component] = index;
+                Add(_map, component, index);
             }
         }
 
@@ -61,9 +76,30 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline
         /// <returns>Index of this and Index of other Result where the two have a unique trait in common.</returns>
         public IEnumerable<Tuple<int, int>> UniqueLinks(WhatMap other)
         {
-            foreach (KeyValuePair<WhatComponent, int> entry in _map.Where(entry => entry.Value != -1))
+            return _hashedMap != null
+                ? UniqueLinks(_hashedMap, other._hashedMap)
+                : UniqueLinks(_map, other._map);
+        }
+
+        private static void Add<T>(Dictionary<T, int> map, T key, int index)
+        {
+            if (map.TryGetValue(key, out int existingIndex) && existingIndex != index)
+            {
+                // If the map has another of this value, set index -1 to indicate non-unique.
+                map[key] = -1;
+            }
+            else
+            {
+                // Otherwise, point to the result.
+                map[key] = index;
+            }
+        }
+
+        private static IEnumerable<Tuple<int, int>> UniqueLinks<T>(Dictionary<T, int> map, Dictionary<T, int> otherMap)
+        {
+            foreach (KeyValuePair<T, int> entry in map.Where(entry => entry.Value != -1))
             {
-                if (other._map.TryGetValue(entry.Key, out int otherIndex) && otherIndex != -1)
+                if (otherMap.TryGetValue(entry.Key, out int otherIndex) && otherIndex != -1)
                 {
                     yield return new Tuple<int, int>(entry.Value, otherIndex);
                 }
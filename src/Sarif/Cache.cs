@@ -4,46 +4,123 @@
 using System;
 using System.Collections.Concurrent;
 using System.Collections.Generic;
+using System.Threading;
 
 namespace Microsoft.CodeAnalysis.Sarif
 {
     /// <summary>
-    ///  Cache is a simple LRU (least recently used) collection.
-    ///  The base class libraries don't offer one without an extra dependency.
+    ///  Cache is an approximately LRU (least recently used) collection, bounded by entry count
+    ///  and, optionally, by the total size of its values in bytes.
     /// </summary>
+    /// <remarks>
+    ///  Entries are spread across independently locked shards, each of which evicts with the
+    ///  CLOCK algorithm: a hit only sets the entry's 'referenced' bit, without taking a lock,
+    ///  and eviction sweeps the shard, sparing (and clearing) referenced entries once. Values
+    ///  are built outside of any lock, so concurrent misses on different keys don't serialize;
+    ///  if two threads miss on the same key at once, the first value stored is the one kept.
+    ///
+    ///  The entry count bound is divided among the shards, but the size bound applies to the
+    ///  whole cache, evicting from each shard in turn. The value just stored is always kept,
+    ///  even if it alone is larger than the size bound.
+    /// </remarks>
     /// <typeparam name="TKey">Type of Keys in collection</typeparam>
     /// <typeparam name="TValue">Type of Values being cached in collection</typeparam>
     public class Cache<TKey, TValue> where TKey : IComparable<TKey>
     {
+        // Shards are only worth their approximation once each can hold a reasonable number of entries.
+        private const int MinimumEntriesPerShard = 16;
+
         private readonly Func<TKey, TValue> _builder;
-        private readonly ConcurrentDictionary<TKey, TValue> _cache;
-        private readonly LinkedList<TKey> _keysInUseOrder;
+        private readonly Func<TValue, long> _sizeOf;
+        private readonly ConcurrentDictionary<TKey, Entry> _entries;
+        private readonly Shard[] _shards;
+        private readonly int _shardMask;
+
+        private long _sizeInBytes;
+        private int _nextShardToTrim;
+        private long _evictions;
 
         public const int DefaultCapacity = 100;
+
+        /// <summary>
+        ///  Maximum number of items to keep in cache, zero for no limit.
+        /// </summary>
         public int Capacity { get; }
 
+        /// <summary>
+        ///  Maximum total size, in bytes, of the values kept in cache, zero for no limit.
+        /// </summary>
+        public long MaxSizeInBytes { get; }
+
         /// <summary>
         ///  Construct a new Cache
         /// </summary>
         /// <param name="builder">Method to build a value from a key when it isn't in the cache</param>
         /// <param name="capacity">Maximum number of items to keep in cache, zero for no limit</param>
         public Cache(Func<TKey, TValue> builder, int capacity = DefaultCapacity)
+            : this(builder, capacity, maxSizeInBytes: 0, sizeOf: null)
         {
+        }
+
+        /// <summary>
+        ///  Construct a new Cache bounded by the size of its values
+        /// </summary>
+        /// <param name="builder">Method to build a value from a key when it isn't in the cache</param>
+        /// <param name="capacity">Maximum number of items to keep in cache, zero for no limit</param>
+        /// <param name="maxSizeInBytes">Maximum total size of the values kept in cache, zero for no limit</param>
+        /// <param name="sizeOf">Method to estimate the size of a value in bytes; required if maxSizeInBytes is set</param>
+        public Cache(Func<TKey, TValue> builder, int capacity, long maxSizeInBytes, Func<TValue, long> sizeOf)
+        {
+            if (capacity < 0) { throw new ArgumentOutOfRangeException(nameof(capacity)); }
+            if (maxSizeInBytes < 0) { throw new ArgumentOutOfRangeException(nameof(maxSizeInBytes)); }
+            if (maxSizeInBytes > 0 && sizeOf == null) { throw new ArgumentNullException(nameof(sizeOf)); }
+
             _builder = builder;
-            _cache = new ConcurrentDictionary<TKey, TValue>();
-            _keysInUseOrder = new LinkedList<TKey>();
+            _sizeOf = sizeOf;
+            _entries = new ConcurrentDictionary<TKey, Entry>();
             Capacity = capacity;
+            MaxSizeInBytes = maxSizeInBytes;
+
+            int shardCount = GetShardCount(capacity);
+            _shardMask = shardCount - 1;
+            _shards = new Shard[shardCount];
+
+            for (int i = 0; i < shardCount; i++)
+            {
+                _shards[i] = new Shard(capacity == 0 ? 0 : (capacity + i) / shardCount);
+            }
         }
 
         /// <summary>
         ///  Returns the number of items currently cached
         /// </summary>
-        public int Count => _cache.Count;
+        public int Count => _entries.Count;
 
         /// <summary>
         ///  Returns the keys of items currently cached
         /// </summary>
-        public IEnumerable<TKey> Keys => _cache.Keys;
+        public IEnumerable<TKey> Keys => _entries.Keys;
+
+        /// <summary>
+        ///  Returns the estimated total size, in bytes, of the values currently cached.
+        ///  Always zero unless the cache was constructed with a size estimator.
+        /// </summary>
+        public long SizeInBytes => Interlocked.Read(ref _sizeInBytes);
+
+        /// <summary>
+        ///  Returns the number of lookups satisfied from the cache.
+        /// </summary>
+        public long Hits => SumShards(shard => Interlocked.Read(ref shard.Hits));
+
+        /// <summary>
+        ///  Returns the number of lookups that had to build their value.
+        /// </summary>
+        public long Misses => SumShards(shard => Interlocked.Read(ref shard.Misses));
+
+        /// <summary>
+        ///  Returns the number of items removed to stay within the cache's bounds.
+        /// </summary>
+        public long Evictions => Interlocked.Read(ref _evictions);
 
         /// <summary>
         ///  Return value for a given key, either from the cache or after rebuilding it.
@@ -54,71 +131,234 @@ namespace Microsoft.CodeAnalysis.Sarif
         {
             get
             {
-                TValue value = default;
+                // Lookups are counted per shard, so that threads hitting different shards don't
+                // contend for a single counter.
+                Shard shard = _shards[GetShardIndex(key)];
 
-                lock (_keysInUseOrder)
+                if (_entries.TryGetValue(key, out Entry entry))
                 {
-                    if (!_cache.TryGetValue(key, out value))
-                    {
-                        // Build and add the new item to cache
-                        value = _builder(key);
+                    Interlocked.Increment(ref shard.Hits);
+                    entry.Referenced = true;
+                    return entry.Value;
+                }
+
+                Interlocked.Increment(ref shard.Misses);
+
+                // Build and add the new item to cache
+                TValue value = _builder(key);
+                return SetValue(key, value, replaceExisting: false);
+            }
+            set => SetValue(key, value, replaceExisting: true);
+        }
+
+        /// <summary>
+        ///  Return whether the cache currently includes the value for the given key.
+        /// </summary>
+        /// <param name="key">Key to check cache for</param>
+        /// <returns>True if value in cache, False otherwise</returns>
+        public bool ContainsKey(TKey key)
+        {
+            return _entries.ContainsKey(key);
+        }
 
-                        SetValue(key, value);
+        /// <summary>
+        /// Clear current cache.
+        /// </summary>
+        public void Clear()
+        {
+            foreach (Shard shard in _shards)
+            {
+                lock (shard)
+                {
+                    foreach (Entry entry in shard.Ring)
+                    {
+                        _entries.TryRemove(entry.Key, out _);
+                        Interlocked.Add(ref _sizeInBytes, -entry.Size);
                     }
-                    else
+
+                    shard.Ring.Clear();
+                    shard.Hand = 0;
+                }
+            }
+        }
+
+        private TValue SetValue(TKey key, TValue value, bool replaceExisting)
+        {
+            long size = _sizeOf != null ? Math.Max(0, _sizeOf(value)) : 0;
+            Shard shard = _shards[GetShardIndex(key)];
+            Entry entry;
+
+            lock (shard)
+            {
+                if (_entries.TryGetValue(key, out Entry existing))
+                {
+                    if (!replaceExisting)
                     {
-                        // When an in-cache key is retrieved, move it back to the start of the order used set, if not already most recent
-                        if (Capacity > 0 && key.CompareTo(_keysInUseOrder.First.Value) != 0)
-                        {
-                            _keysInUseOrder.Remove(key);
-                            _keysInUseOrder.AddFirst(key);
-                        }
+                        // Another thread built and stored this key first; keep its value.
+                        existing.Referenced = true;
+                        return existing.Value;
                     }
+
+                    RemoveAt(shard, existing.Slot);
                 }
 
-                return value;
+                while (shard.Capacity > 0 && shard.Ring.Count >= shard.Capacity)
+                {
+                    EvictOne(shard, keep: null);
+                }
+
+                entry = new Entry(key, value, size) { Slot = shard.Ring.Count };
+                shard.Ring.Add(entry);
+                Interlocked.Add(ref _sizeInBytes, size);
+                _entries[key] = entry;
             }
-            set => SetValue(key, value);
+
+            if (MaxSizeInBytes > 0 && Interlocked.Read(ref _sizeInBytes) > MaxSizeInBytes)
+            {
+                TrimToMaxSize(keep: entry);
+            }
+
+            return value;
         }
 
-        private void SetValue(TKey key, TValue value)
+        private void TrimToMaxSize(Entry keep)
         {
-            lock (_keysInUseOrder)
+            // Evict one entry at a time from each shard in turn, holding one shard's lock at a
+            // time, until the cache fits or nothing but the kept entry is left.
+            int shardsWithoutEviction = 0;
+            while (Interlocked.Read(ref _sizeInBytes) > MaxSizeInBytes && shardsWithoutEviction < _shards.Length)
             {
-                // If cache full, remove least recently used item
-                if (Capacity > 0 && _cache.Count >= Capacity)
+                Shard shard = _shards[(Interlocked.Increment(ref _nextShardToTrim) & int.MaxValue) % _shards.Length];
+
+                bool evicted;
+                lock (shard)
                 {
-                    TKey oldest = _keysInUseOrder.Last.Value;
+                    evicted = EvictOne(shard, keep);
+                }
 
-                    _keysInUseOrder.RemoveLast();
-                    _cache.TryRemove(oldest, out _);
+                shardsWithoutEviction = evicted ? 0 : shardsWithoutEviction + 1;
+            }
+        }
+
+        private bool EvictOne(Shard shard, Entry keep)
+        {
+            List<Entry> ring = shard.Ring;
+            if (ring.Count == 0 || (ring.Count == 1 && ring[0] == keep)) { return false; }
+
+            // Sweep the clock hand, giving each referenced entry a second chance.
+            while (true)
+            {
+                if (shard.Hand >= ring.Count) { shard.Hand = 0; }
+
+                Entry candidate = ring[shard.Hand];
+                if (candidate.Referenced || candidate == keep)
+                {
+                    candidate.Referenced = false;
+                    shard.Hand++;
+                    continue;
                 }
 
-                _cache[key] = value;
-                _keysInUseOrder.AddFirst(key);
+                RemoveAt(shard, shard.Hand);
+                Interlocked.Increment(ref _evictions);
+                return true;
             }
         }
 
-        /// <summary>
-        ///  Return whether the cache currently includes the value for the given key.
-        /// </summary>
-        /// <param name="key">Key to check cache for</param>
-        /// <returns>True if value in cache, False otherwise</returns>
-        public bool ContainsKey(TKey key)
+        private void RemoveAt(Shard shard, int slot)
         {
-            return _cache.ContainsKey(key);
+            List<Entry> ring = shard.Ring;
+            Entry removed = ring[slot];
+
+            // Fill the hole with the last entry rather than shifting the ring down.
+            int last = ring.Count - 1;
+            if (slot != last)
+            {
+                ring[slot] = ring[last];
+                ring[slot].Slot = slot;
+            }
+
+            ring.RemoveAt(last);
+            Interlocked.Add(ref _sizeInBytes, -removed.Size);
+            _entries.TryRemove(removed.Key, out _);
         }
 
-        /// <summary>
-        /// Clear current cache.
-        /// </summary>
-        public void Clear()
+        private long SumShards(Func<Shard, long> count)
         {
-            lock (_keysInUseOrder)
+            long sum = 0;
+            foreach (Shard shard in _shards)
             {
-                this._cache.Clear();
-                this._keysInUseOrder.Clear();
+                sum += count(shard);
             }
+
+            return sum;
+        }
+
+        private int GetShardIndex(TKey key)
+        {
+            // Mix the hash so that keys differing only in their high bits still spread across shards.
+            uint hash = (uint)(key?.GetHashCode() ?? 0);
+            hash ^= hash >> 16;
+            hash *= 0x45d9f3b;
+            hash ^= hash >> 16;
+
+            return (int)(hash & (uint)_shardMask);
+        }
+
+        private static int GetShardCount(int capacity)
+        {
+            int maximum = Environment.ProcessorCount;
+            if (capacity > 0)
+            {
+                maximum = Math.Min(maximum, capacity / MinimumEntriesPerShard);
+            }
+
+            // Round down to a power of two so a shard can be selected with a mask.
+            int shardCount = 1;
+            while (shardCount * 2 <= maximum)
+            {
+                shardCount *= 2;
+            }
+
+            return shardCount;
+        }
+
+        private sealed class Entry
+        {
+            public Entry(TKey key, TValue value, long size)
+            {
+                Key = key;
+                Value = value;
+                Size = size;
+            }
+
+            public TKey Key { get; }
+
+            public TValue Value { get; }
+
+            public long Size { get; }
+
+            public int Slot;
+
+            public volatile bool Referenced;
+        }
+
+        private sealed class Shard
+        {
+            public Shard(int capacity)
+            {
+                Capacity = capacity;
+                Ring = new List<Entry>();
+            }
+
+            public int Capacity { get; }
+
+            public List<Entry> Ring { get; }
+
+            public int Hand;
+
+            public long Hits;
+
+            public long Misses;
         }
     }
 }
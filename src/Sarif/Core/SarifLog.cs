@@ -9,6 +9,7 @@ using System.Text;
 using System.Threading.Tasks;
 
 using Microsoft.CodeAnalysis.Sarif.Readers;
+using Microsoft.CodeAnalysis.Sarif.Writers;
 
 using Newtonsoft.Json;
 
@@ -31,6 +32,24 @@ namespace Microsoft.CodeAnalysis.Sarif
             return serializer.Deserialize<SarifLog>(jsonPositionedTextReader);
         }
 
+        /// <summary>
+        ///  Load a memory-mapped SARIF file into a SarifLog object model instance using deferred loading.
+        ///  Deferred collections read items from the shared mapping, making random access to them cheaper.
+        ///  [Less memory use; keep mappedFile undisposed while the SarifLog is in use]
+        /// </summary>
+        /// <param name="mappedFile">Memory-mapped Sarif file to load</param>
+        /// <returns>SarifLog instance for file</returns>
+        public static SarifLog LoadDeferred(MemoryMappedStreamProvider mappedFile)
+        {
+            if (mappedFile == null) { throw new ArgumentNullException(nameof(mappedFile)); }
+
+            var serializer = new JsonSerializer();
+            serializer.ContractResolver = new SarifDeferredContractResolver();
+
+            using var jsonPositionedTextReader = new JsonPositionedTextReader(mappedFile.OpenStream);
+            return serializer.Deserialize<SarifLog>(jsonPositionedTextReader);
+        }
+
         /// <summary>
         ///  Load a SARIF file into a SarifLog object model instance.
         ///  [File is fully loaded; more RAM but faster]
@@ -165,6 +184,28 @@ namespace Microsoft.CodeAnalysis.Sarif
             return await httpClient.PostAsync(postUri.ToString(), streamContent);
         }
 
+        /// <summary>
+        ///  Load a SarifLog written with SaveBinary.
+        /// </summary>
+        /// <param name="source">Seekable stream with the binary log to load</param>
+        /// <returns>SarifLog instance for stream</returns>
+        public static SarifLog LoadBinary(Stream source)
+        {
+            using var reader = new SarifBinaryReader(source, leaveOpen: true);
+            return reader.ReadLog();
+        }
+
+        /// <summary>
+        ///  Write a SARIF log to a destination stream in the binary intermediate format.
+        ///  [For passing logs between pipeline stages without JSON (see SerializationBenchmarks); not SARIF, so not for publishing]
+        /// </summary>
+        /// <param name="stream">Seekable stream to write the binary log to</param>
+        public void SaveBinary(Stream stream)
+        {
+            using var writer = new SarifBinaryWriter(stream, leaveOpen: true);
+            writer.Write(this);
+        }
+
         /// <summary>
         ///  Write a SARIF log to disk as a file.
         /// </summary>
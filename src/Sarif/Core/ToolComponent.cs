@@ -17,14 +17,19 @@ namespace Microsoft.CodeAnalysis.Sarif
 
         private void BuildRuleCaches()
         {
-            _cachedRulesById = new Dictionary<string, ReportingDescriptor>();
-            _cachedRulesByGuid = new Dictionary<Guid, ReportingDescriptor>();
+            // Fill new caches before publishing them, so concurrent lookups (as in parallel query
+            // evaluation) never see a partially built Dictionary.
+            var rulesById = new Dictionary<string, ReportingDescriptor>();
+            var rulesByGuid = new Dictionary<Guid, ReportingDescriptor>();
 
             foreach (ReportingDescriptor r in this.Rules ?? Enumerable.Empty<ReportingDescriptor>())
             {
-                if (r.Id != null) { _cachedRulesById[r.Id] = r; }
-                if (r.Guid != null) { _cachedRulesByGuid[r.Guid.Value] = r; }
+                if (r.Id != null) { rulesById[r.Id] = r; }
+                if (r.Guid != null) { rulesByGuid[r.Guid.Value] = r; }
             }
+
+            _cachedRulesById = rulesById;
+            _cachedRulesByGuid = rulesByGuid;
         }
 
         public ReportingDescriptor GetRuleById(string ruleId)
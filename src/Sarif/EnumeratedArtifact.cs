@@ -12,19 +12,53 @@ namespace Microsoft.CodeAnalysis.Sarif
     public class EnumeratedArtifact(IFileSystem fileSystem) : IEnumeratedArtifact
     {
         private const int BinarySniffingHeaderSizeBytes = 1024;
-        internal byte[] bytes;
-        internal string contents;
+        internal volatile byte[] bytes;
+        internal volatile string contents;
 
+        // Rules analyzing a target in parallel share its artifact, so retrieving its data (which
+        // consumes, and then releases, the stream) is serialized.
+        private readonly object syncRoot = new object();
         private Encoding encoding;
+        private bool hasPreamble;
+        private volatile bool retrievedFromFile;
+        private bool? isBinary;
 
         public Uri Uri { get; set; }
 
+        /// <summary>
+        ///  Gets a value indicating whether the artifact is binary. Unless its contents have
+        ///  already been retrieved, this is determined by sniffing the artifact's header only.
+        /// </summary>
         public bool IsBinary
         {
             get
             {
-                GetArtifactData();
-                return this.contents == null;
+                if (this.contents != null) { return false; }
+                if (this.bytes != null) { return true; }
+
+                if (this.isBinary == null)
+                {
+                    lock (this.syncRoot)
+                    {
+                        if (this.contents != null) { return false; }
+                        if (this.bytes != null) { return true; }
+
+                        if (this.isBinary == null)
+                        {
+                            if (this.Stream != null)
+                            {
+                                this.isBinary = !SniffIsText(out _, out _);
+                            }
+                            else
+                            {
+                                using Stream stream = FileSystem.FileOpenRead(GetFilePath());
+                                this.isBinary = !IsTextHeader(stream, out _, out _);
+                            }
+                        }
+                    }
+                }
+
+                return this.isBinary.Value;
             }
         }
 
@@ -70,24 +104,76 @@ namespace Microsoft.CodeAnalysis.Sarif
                 return (text: null, this.bytes);
             }
 
-            if (Stream == null && this.contents == null && this.bytes == null)
+            lock (this.syncRoot)
             {
-                if (Uri == null ||
-                    !Uri.IsAbsoluteUri ||
-                    (Uri.IsAbsoluteUri && !Uri.IsFile))
+                if (this.contents == null && this.bytes == null)
                 {
-                    throw new InvalidOperationException("An absolute URI pointing to a file location was not available.");
+                    if (Stream == null)
+                    {
+                        // This is our client-side, disk-based file retrieval case.
+                        this.Stream = FileSystem.FileOpenRead(GetFilePath());
+                        this.retrievedFromFile = true;
+                    }
+
+                    RetrieveDataFromStream();
+
+                    this.Stream = null;
                 }
 
-                // This is our client-side, disk-based file retrieval case.
-                this.Stream = FileSystem.FileOpenRead(Uri.OriginalString);
+                return (this.contents, this.bytes);
             }
+        }
 
-            RetrieveDataFromStream();
+        /// <summary>
+        ///  Opens a read-only stream over the artifact's contents. An artifact on disk is always
+        ///  read from the file directly, whether or not its contents have been retrieved, so a
+        ///  caller that only needs part of the artifact (e.g., its header) never loads the whole
+        ///  of it, and every caller sees the file's own bytes.
+        /// </summary>
+        /// <returns>A stream, which the caller is responsible for disposing.</returns>
+        public Stream OpenRead()
+        {
+            string text = this.contents;
+            byte[] data = this.bytes;
 
-            this.Stream = null;
+            if (this.retrievedFromFile || (text == null && data == null && this.Stream == null))
+            {
+                return FileSystem.FileOpenRead(GetFilePath());
+            }
+
+            if (data != null)
+            {
+                return new MemoryStream(data, writable: false);
+            }
 
-            return (this.contents, this.bytes);
+            if (text != null)
+            {
+                // Encoded as it was decoded, if it was, so that the stream reproduces the original bytes.
+                Encoding textEncoding = this.encoding ?? new UTF8Encoding(encoderShouldEmitUTF8Identifier: false);
+                byte[] preamble = this.hasPreamble ? textEncoding.GetPreamble() : Array.Empty<byte>();
+
+                byte[] encoded = new byte[preamble.Length + textEncoding.GetByteCount(text)];
+                Array.Copy(preamble, encoded, preamble.Length);
+                textEncoding.GetBytes(text, 0, text.Length, encoded, preamble.Length);
+
+                return new MemoryStream(encoded, writable: false);
+            }
+
+            // A caller-provided stream can only be consumed once, so its data is retrieved.
+            GetArtifactData();
+            return OpenRead();
+        }
+
+        private string GetFilePath()
+        {
+            if (Uri == null ||
+                !Uri.IsAbsoluteUri ||
+                (Uri.IsAbsoluteUri && !Uri.IsFile))
+            {
+                throw new InvalidOperationException("An absolute URI pointing to a file location was not available.");
+            }
+
+            return Uri.OriginalString;
         }
 
         private bool IsZipHeader(byte[] header, int length)
@@ -108,6 +194,31 @@ namespace Microsoft.CodeAnalysis.Sarif
         }
 
         private void RetrieveDataFromStream()
+        {
+            bool isText = SniffIsText(out byte[] header, out int headerLength);
+
+            if (isText)
+            {
+                using var contentReader = new StreamReader(Stream);
+                string text = contentReader.ReadToEnd();
+
+                // Recorded (before the contents are published) so that OpenRead can encode the
+                // contents of an in-memory artifact back into the bytes they were decoded from.
+                this.encoding = contentReader.CurrentEncoding;
+                this.hasPreamble = StartsWith(header, headerLength, this.encoding.GetPreamble());
+                this.contents = text;
+            }
+            else
+            {
+                // Published only once filled, as other threads read it without taking the lock.
+                byte[] data = new byte[Stream.Length];
+                var memoryStream = new MemoryStream(data);
+                this.Stream.CopyTo(memoryStream);
+                this.bytes = data;
+            }
+        }
+
+        private bool SniffIsText(out byte[] header, out int headerLength)
         {
             // Some streams report CanSeek == true but their Seek re-enters native code that may have
             // released its context (e.g. WebAPI's SeekableBufferedRequestStream over IIS), causing an
@@ -119,10 +230,7 @@ namespace Microsoft.CodeAnalysis.Sarif
                               ?? new PeekableStream(this.Stream, BinarySniffingHeaderSizeBytes);
             }
 
-            byte[] header = new byte[BinarySniffingHeaderSizeBytes];
-            int readLength = this.Stream.Read(header, 0, header.Length);
-
-            bool isText = !IsZipHeader(header, readLength) && FileEncoding.IsTextualData(header, 0, readLength);
+            bool isText = IsTextHeader(this.Stream, out header, out headerLength);
 
             if (this.Stream is PeekableStream peekable)
             {
@@ -133,21 +241,34 @@ namespace Microsoft.CodeAnalysis.Sarif
                 this.Stream.Seek(0, SeekOrigin.Begin);
             }
 
-            if (isText)
+            return isText;
+        }
+
+        private bool IsTextHeader(Stream stream, out byte[] header, out int readLength)
+        {
+            header = new byte[BinarySniffingHeaderSizeBytes];
+            readLength = stream.Read(header, 0, header.Length);
+
+            return !IsZipHeader(header, readLength) && FileEncoding.IsTextualData(header, 0, readLength);
+        }
+
+        private static bool StartsWith(byte[] header, int length, byte[] prefix)
+        {
+            if (prefix.Length == 0 || length < prefix.Length)
             {
-                using var contentReader = new StreamReader(Stream);
-                this.contents = contentReader.ReadToEnd();
+                return false;
             }
-            else
+
+            for (int i = 0; i < prefix.Length; i++)
             {
-                this.bytes = new byte[Stream.Length];
-                var memoryStream = new MemoryStream(this.bytes);
-                this.Stream.CopyTo(memoryStream);
+                if (header[i] != prefix[i]) { return false; }
             }
+
+            return true;
         }
 
         // Allowlist of stream types whose Seek touches only managed in-process state.
-        // Anything else is wrapped in PeekableStream to avoid the AV described in RetrieveDataFromStream.
+        // Anything else is wrapped in PeekableStream to avoid the AV described in SniffIsText.
         private static bool IsSafeToSeek(Stream stream)
         {
             return stream.CanSeek
@@ -175,9 +296,9 @@ namespace Microsoft.CodeAnalysis.Sarif
                 {
                     this.sizeInBytes = (int)this.bytes.Length;
                 }
-                else if (this.Stream != null)
+                else if (this.Stream is Stream stream)
                 {
-                    this.SizeInBytes = (long)this.Stream.Length;
+                    this.SizeInBytes = (long)stream.Length;
                 }
                 else if (Uri != null && Uri.IsAbsoluteUri && Uri.IsFile)
                 {
@@ -1,10 +1,14 @@
 ﻿// Copyright (c) Microsoft. All rights reserved.
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
 using System.Diagnostics;
 using System.Globalization;
 using System.IO;
+using System.Linq;
 using System.Security;
+using System.Threading.Tasks;
 
 namespace Microsoft.CodeAnalysis.Sarif
 {
@@ -14,6 +18,12 @@ namespace Microsoft.CodeAnalysis.Sarif
     public class FileRegionsCache
     {
         public const int DefaultCacheCapacity = 100;
+
+        /// <summary>
+        /// The default bound on the memory held by cached file text and newline indexes.
+        /// Scan targets vary in size too widely for an entry count alone to bound memory.
+        /// </summary>
+        public const long DefaultCacheSizeInBytes = 256L * 1024 * 1024;
         private readonly IFileSystem _fileSystem;
 
         internal readonly Cache<string, string> _fileTextCache;
@@ -53,11 +63,15 @@ namespace Microsoft.CodeAnalysis.Sarif
             _fileSystem = fileSystem ?? Sarif.FileSystem.Instance;
             HashAlgorithms = hashAlgorithms;
 
-            _fileTextCache = new Cache<string, string>(RetrieveTextForFile, capacity);
+            _fileTextCache = new Cache<string, string>(RetrieveTextForFile, capacity, DefaultCacheSizeInBytes, SizeOfText);
             _hashDataCache = new Cache<string, HashData>(BuildHashDataForFile, capacity);
-            _newLineIndexCache = new Cache<string, NewLineIndex>(BuildIndexForFile, capacity);
+            _newLineIndexCache = new Cache<string, NewLineIndex>(BuildIndexForFile, capacity, DefaultCacheSizeInBytes, SizeOfNewLineIndex);
         }
 
+        private static long SizeOfText(string text) => (text?.Length ?? 0) * (long)sizeof(char);
+
+        private static long SizeOfNewLineIndex(NewLineIndex index) => index?.SizeInBytes ?? 0;
+
         /// <summary>
         /// Creates a <see cref="Region"/> object, based on an existing Region, in which all
         /// text-related properties have been populated.
@@ -104,15 +118,114 @@ namespace Microsoft.CodeAnalysis.Sarif
             }
 
             NewLineIndex newLineIndex = GetNewLineIndex(uri, fileText);
+            string indexedText = GetIndexedText(uri, ref newLineIndex);
 
             return PopulateTextRegionProperties(
                 newLineIndex,
                 inputRegion,
-                newLineIndex?.Text,
+                indexedText,
                 populateSnippet,
                 overwriteExistingData);
         }
 
+        /// <summary>
+        /// Populates the text-related properties of each of a set of regions that lie in the
+        /// same artifact, as <see cref="PopulateTextRegionProperties(Region, Uri, bool, string, bool)"/>
+        /// does for one region.
+        /// </summary>
+        /// <remarks>
+        /// The artifact's newline index and text are retrieved once for the whole set, and the
+        /// regions are resolved in order of their position in the artifact, so the cost is
+        /// proportional to the artifact and the number of regions rather than to a cache
+        /// lookup per region.
+        /// </remarks>
+        /// <param name="inputRegions">
+        /// Region objects that form the basis of the returned Region objects.
+        /// </param>
+        /// <param name="uri">
+        /// URI of the artifact in which every one of <paramref name="inputRegions"/> lies.
+        /// </param>
+        /// <param name="populateSnippet">
+        /// Boolean that indicates if each region's Snippet property will be populated.
+        /// </param>
+        /// <param name="overwriteExistingData">
+        /// Controls how an authored region coordinate that diverges from the value computed
+        /// from the source text is reconciled, as for the single-region overload.
+        /// </param>
+        /// <returns>
+        /// The populated regions, in the order of <paramref name="inputRegions"/>. Null and
+        /// binary regions are returned as they are.
+        /// </returns>
+        public IList<Region> PopulateTextRegionPropertiesForArtifact(
+            IList<Region> inputRegions,
+            Uri uri,
+            bool populateSnippet,
+            bool overwriteExistingData = false)
+        {
+            if (inputRegions == null) { throw new ArgumentNullException(nameof(inputRegions)); }
+
+            var regions = new Region[inputRegions.Count];
+            NewLineIndex newLineIndex = inputRegions.Count > 0 ? GetNewLineIndex(uri) : null;
+            string fileText = GetIndexedText(uri, ref newLineIndex);
+
+            foreach (int i in OrderByPosition(inputRegions))
+            {
+                Region inputRegion = inputRegions[i];
+
+                regions[i] = inputRegion == null || inputRegion.IsBinaryRegion
+                    ? inputRegion
+                    : PopulateTextRegionProperties(newLineIndex, inputRegion, fileText, populateSnippet, overwriteExistingData);
+            }
+
+            return regions;
+        }
+
+        /// <summary>
+        /// Constructs a multiline context region for each of a set of regions that lie in the
+        /// same artifact, as <see cref="ConstructMultilineContextSnippet(Region, Uri, string)"/> does for one region,
+        /// retrieving the artifact's newline index and text once for the whole set.
+        /// </summary>
+        /// <returns>
+        /// The context regions, in the order of <paramref name="inputRegions"/>. An entry is
+        /// null where no context region applies.
+        /// </returns>
+        public IList<Region> ConstructMultilineContextSnippetsForArtifact(IList<Region> inputRegions, Uri uri)
+        {
+            if (inputRegions == null) { throw new ArgumentNullException(nameof(inputRegions)); }
+
+            var contextRegions = new Region[inputRegions.Count];
+            NewLineIndex newLineIndex = inputRegions.Count > 0 ? GetNewLineIndex(uri) : null;
+            string fileText = GetIndexedText(uri, ref newLineIndex);
+            if (newLineIndex == null) { return contextRegions; }
+
+            foreach (int i in OrderByPosition(inputRegions))
+            {
+                contextRegions[i] = ConstructMultilineContextSnippet(newLineIndex, inputRegions[i], fileText);
+            }
+
+            return contextRegions;
+        }
+
+        // Returns the indexes of the regions ordered by where they start in the artifact, so that
+        // successive newline index lookups land close to one another.
+        private static int[] OrderByPosition(IList<Region> regions)
+        {
+            int[] order = new int[regions.Count];
+            long[] positions = new long[regions.Count];
+
+            for (int i = 0; i < order.Length; i++)
+            {
+                Region region = regions[i];
+                order[i] = i;
+                positions[i] = region == null
+                    ? long.MaxValue
+                    : region.StartLine > 0 ? ((long)region.StartLine << 32) | (uint)Math.Max(0, region.StartColumn) : region.CharOffset;
+            }
+
+            Array.Sort(positions, order);
+            return order;
+        }
+
         /// <summary>
         /// Clear current cache.
         /// </summary>
@@ -174,14 +287,24 @@ namespace Microsoft.CodeAnalysis.Sarif
             }
 
             NewLineIndex newLineIndex = GetNewLineIndex(uri, fileText);
+            string indexedText = GetIndexedText(uri, ref newLineIndex);
             if (newLineIndex == null)
             {
                 return null;
             }
 
-            fileText ??= newLineIndex.Text;
+            return ConstructMultilineContextSnippet(newLineIndex, inputRegion, indexedText);
+        }
 
-            Region originalRegion = this.PopulateTextRegionProperties(inputRegion, uri, populateSnippet: true, fileText);
+        private static Region ConstructMultilineContextSnippet(NewLineIndex newLineIndex, Region inputRegion, string fileText)
+        {
+            if (inputRegion?.IsBinaryRegion != false)
+            {
+                // Context snippets are relevant only for textual regions.
+                return null;
+            }
+
+            Region originalRegion = PopulateTextRegionProperties(newLineIndex, inputRegion, fileText, populateSnippet: true, overwriteExistingData: false);
 
             if (originalRegion.CharLength >= BIGSNIPPETLENGTH)
             {
@@ -200,7 +323,7 @@ namespace Microsoft.CodeAnalysis.Sarif
                 EndLine = inputRegion.EndLine == maxLineNumber ? maxLineNumber : inputRegion.EndLine + 1
             };
 
-            Region multilineContextSnippet = this.PopulateTextRegionProperties(region, uri, populateSnippet: true, fileText);
+            Region multilineContextSnippet = PopulateTextRegionProperties(newLineIndex, region, fileText, populateSnippet: true, overwriteExistingData: false);
 
             if (originalRegion.CharLength <= multilineContextSnippet.CharLength &&
                 multilineContextSnippet.CharLength <= BIGSNIPPETLENGTH)
@@ -217,7 +340,7 @@ namespace Microsoft.CodeAnalysis.Sarif
 
             region.CharLength = Math.Min(BIGSNIPPETLENGTH, fileText.Length - region.CharOffset);
 
-            multilineContextSnippet = this.PopulateTextRegionProperties(region, uri, populateSnippet: true, fileText);
+            multilineContextSnippet = PopulateTextRegionProperties(newLineIndex, region, fileText, populateSnippet: true, overwriteExistingData: false);
 
             // The capped char-offset window does not always contain the region (a region longer
             // than the window's reach past its start runs off the end). Emit the context region
@@ -384,33 +507,56 @@ namespace Microsoft.CodeAnalysis.Sarif
             if (fileText != null)
             {
                 _fileTextCache[path] = fileText;
+                return fileText;
             }
 
             return _fileTextCache[path];
         }
 
+        /// <summary>
+        /// Computes the rolling line hashes (see <see cref="HashUtilities.RollingHash"/>) of each
+        /// distinct file among <paramref name="uris"/>. Each file is read and hashed once, on the
+        /// thread pool. Text already in the cache is used, but text read here isn't added to it,
+        /// so that hashing a large batch of files doesn't evict everything else.
+        /// </summary>
+        /// <returns>
+        /// A dictionary from file path to the file's line hashes, or to null if it couldn't be read.
+        /// </returns>
+        public IDictionary<string, Dictionary<int, string>> GetRollingHashes(IEnumerable<Uri> uris, int maxDegreeOfParallelism = -1)
+        {
+            var paths = new HashSet<string>(uris.Select(uri => uri.GetFilePath())).ToList();
+            var rollingHashes = new ConcurrentDictionary<string, Dictionary<int, string>>();
+
+            var options = new ParallelOptions { MaxDegreeOfParallelism = maxDegreeOfParallelism > 0 ? maxDegreeOfParallelism : -1 };
+
+            // File sizes vary widely, so hand out one path at a time rather than ranges.
+            Parallel.ForEach(Partitioner.Create(paths, EnumerablePartitionerOptions.NoBuffering), options, path =>
+            {
+                string fileText = _fileTextCache.ContainsKey(path) ? _fileTextCache[path] : RetrieveTextForFile(path);
+                rollingHashes[path] = fileText != null ? HashUtilities.RollingHash(fileText) : null;
+            });
+
+            return rollingHashes;
+        }
+
         public NewLineIndex GetNewLineIndex(Uri uri, string fileText = null)
         {
             string path = uri.GetFilePath();
             if (fileText != null)
             {
                 _fileTextCache[path] = fileText;
-            }
-            fileText = _fileTextCache[path];
 
-            NewLineIndex newLineIndex;
-            if (!_newLineIndexCache.ContainsKey(path) && fileText != null)
-            {
-                newLineIndex = new NewLineIndex(fileText);
+                // Text supplied by the caller can't be read again from disk, so its index keeps it.
+                if (!_newLineIndexCache.ContainsKey(path))
+                {
+                    var newLineIndex = new NewLineIndex(fileText);
 
-                _newLineIndexCache[path] = newLineIndex;
-            }
-            else
-            {
-                newLineIndex = _newLineIndexCache[path];
+                    _newLineIndexCache[path] = newLineIndex;
+                    return newLineIndex;
+                }
             }
 
-            return newLineIndex;
+            return _newLineIndexCache[path];
         }
 
         private string RetrieveTextForFile(string path)
@@ -449,8 +595,29 @@ namespace Microsoft.CodeAnalysis.Sarif
 
         private NewLineIndex BuildIndexForFile(string path)
         {
+            // The index doesn't hold on to the file's text, which is retrieved through the
+            // (size-bounded) text cache only when a caller asks for it.
             string fileText = _fileTextCache[path];
-            return fileText != null ? new NewLineIndex(fileText) : null;
+            return fileText != null ? new NewLineIndex(fileText, () => _fileTextCache[path]) : null;
+        }
+
+        // Returns the text a newline index was built from. If the file changed since it was
+        // indexed (its text was evicted and read again), the file is indexed again, so that the
+        // index and the text returned always agree.
+        private string GetIndexedText(Uri uri, ref NewLineIndex newLineIndex)
+        {
+            string text = newLineIndex?.Text;
+
+            if (newLineIndex != null && text == null)
+            {
+                // The text cache now holds the file's current text, so this doesn't read it again.
+                string path = uri.GetFilePath();
+                newLineIndex = BuildIndexForFile(path);
+                _newLineIndexCache[path] = newLineIndex;
+                text = newLineIndex?.Text;
+            }
+
+            return text;
         }
 
         private static void Assert(bool _)
@@ -75,6 +75,20 @@ namespace Microsoft.CodeAnalysis.Sarif
             return File.Exists(path);
         }
 
+        /// <summary>
+        /// Moves a specified file to a new location, providing the option to specify a new file name.
+        /// </summary>
+        /// <param name="sourceFileName">
+        /// The name of the file to move.
+        /// </param>
+        /// <param name="destFileName">
+        /// The new path and name for the file, which must not already exist.
+        /// </param>
+        public void FileMove(string sourceFileName, string destFileName)
+        {
+            File.Move(sourceFileName, destFileName);
+        }
+
         /// <summary>
         /// Returns an enumerable collection of directory full names in a specified path.
         /// </summary>
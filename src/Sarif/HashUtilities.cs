@@ -10,8 +10,6 @@ using System.Security.Cryptography;
 using System.Text;
 using System.Threading.Tasks;
 
-using Microsoft.CodeAnalysis.Sarif.Numeric;
-
 namespace Microsoft.CodeAnalysis.Sarif
 {
     public static class HashUtilities
@@ -21,8 +19,7 @@ namespace Microsoft.CodeAnalysis.Sarif
         private static readonly int LF = '\n';
         private static readonly int CR = '\r';
         private static readonly int EOF = 65535;
-        private static readonly int BLOCK_SIZE = 100;
-        private static readonly Long MOD = new Long(37, 0, false);
+        private const int BLOCK_SIZE = 100;
 
         public static IDictionary<string, HashData> MultithreadedComputeTargetFileHashes(
             IEnumerable<string> analysisTargets,
@@ -288,138 +285,224 @@ namespace Microsoft.CodeAnalysis.Sarif
             return sha1;
         }
 
+        /// <summary>
+        /// Computes the 'primaryLocationLineHash' partial fingerprint of each line of a file, as
+        /// GitHub's CodeQL action does: a rolling hash of the 100 characters from the start of
+        /// the line (ignoring spaces and tabs, with CR and CRLF read as LF), followed by a count
+        /// of earlier lines with the same hash.
+        /// </summary>
+        /// <returns>A dictionary from line number (starting at 1) to the line's fingerprint.</returns>
         public static Dictionary<int, string> RollingHash(string fileText)
         {
             var rollingHashes = new Dictionary<int, string>();
 
-            // A rolling view into the input
-            int[] window = new int[BLOCK_SIZE];
-
-            int[] lineNumbers = new int[BLOCK_SIZE];
-            for (int i = 0; i < lineNumbers.Length; i++)
+            if (fileText != null)
             {
-                lineNumbers[i] = -1;
+                var hasher = new RollingHasher(rollingHashes);
+                hasher.Process(fileText.AsSpan());
+                hasher.Complete();
             }
 
-            var hashRaw = new Long(0, 0, false);
-            Long firstMod = ComputeFirstMod();
+            return rollingHashes;
+        }
+
+        /// <summary>
+        ///  RollingHasher holds the state of one RollingHash computation. The hash arithmetic is
+        ///  64-bit and wraps, exactly as the JavaScript Long arithmetic of the original does.
+        /// </summary>
+        private sealed class RollingHasher
+        {
+            private const ulong Mod = 37;
+
+            // Mod^BLOCK_SIZE, which removes the character leaving the window from the hash.
+            private static readonly ulong s_firstMod = ComputeFirstMod();
+
+            private readonly Dictionary<int, string> _rollingHashes;
+            private readonly Dictionary<ulong, int> _hashCounts;
+
+            // A rolling view into the input, and the line which starts at each point in it (or -1).
+            private readonly int[] _window;
+            private readonly int[] _lineNumbers;
+
+            // Reused to format each line's 'hash:count' output: 16 hex digits, ':' and an int.
+            private readonly char[] _outputBuffer;
+
+            private ulong _hash;
 
             // The current index in the window, will wrap around to zero when we reach BLOCK_SIZE
-            int index = 0;
+            private int _index;
+
             // The line number of the character we are currently processing from the input
-            int lineNumber = 0;
+            private int _lineNumber;
+
             // Is the next character to be read the start of a new line
-            bool lineStart = true;
-            // Was the previous character a CR (carriage return)
-            bool prevCR = false;
+            private bool _lineStart;
 
-            var hashCounts = new Dictionary<string, int>();
+            // Was the previous character a CR (carriage return)
+            private bool _prevCR;
 
-            // Output the current hash and line number to the cache
-            Action outputHash = () =>
+            public RollingHasher(Dictionary<int, string> rollingHashes)
             {
-                string hashValue = hashRaw.ToUnsigned().ToString(16);
-
-                if (!hashCounts.ContainsKey(hashValue))
+                _rollingHashes = rollingHashes;
+                _hashCounts = new Dictionary<ulong, int>();
+                _window = new int[BLOCK_SIZE];
+                _lineNumbers = new int[BLOCK_SIZE];
+                _outputBuffer = new char[16 + 1 + 10];
+                _lineStart = true;
+
+                for (int i = 0; i < _lineNumbers.Length; i++)
                 {
-                    hashCounts[hashValue] = 0;
+                    _lineNumbers[i] = -1;
                 }
+            }
 
-                hashCounts[hashValue]++;
-                rollingHashes[lineNumbers[index]] = $"{hashValue}:{hashCounts[hashValue]}";
-                lineNumbers[index] = -1;
-            };
-
-            // Update the current hash value and increment the index in the window
-            Action<int> updateHash = (current) =>
+            public void Process(ReadOnlySpan<char> text)
             {
-                int begin = window[index];
-                window[index] = current;
+                while (!text.IsEmpty)
+                {
+                    // Hash the characters up to the next line break; IndexOfAny is vectorized.
+                    int lineBreak = text.IndexOfAny('\r', '\n');
+                    ReadOnlySpan<char> line = lineBreak < 0 ? text : text.Slice(0, lineBreak);
 
-                hashRaw = MOD.Multiply(hashRaw)
-                            .Add(Long.FromInt(current))
-                            .Subtract(firstMod.Multiply(Long.FromInt(begin)));
+                    if (!line.IsEmpty)
+                    {
+                        _prevCR = false;
+                    }
 
-                index = (index + 1) % BLOCK_SIZE;
-            };
+                    for (int i = 0; i < line.Length; i++)
+                    {
+                        char current = line[i];
 
-            // First process every character in the input, updating the hash and lineNumbers
-            // as we go. Once we reach a point in the window again then we've processed
-            // BLOCK_SIZE characters and if the last character at this point in the window
-            // was the start of a line then we should output the hash for that line.
-            Action<int> processCharacter = (current) =>
-            {
-                // Skip tabs, spaces, and line feeds that come directly after a carriage return.
-                if (current == SPACE || current == TAB || (prevCR && current == LF))
-                {
-                    prevCR = false;
-                    return;
+                        // Skip tabs and spaces.
+                        if (current != SPACE && current != TAB)
+                        {
+                            ProcessCharacter(current);
+                        }
+                    }
+
+                    if (lineBreak < 0) { break; }
+
+                    // Replace CR with LF, and skip a LF that comes directly after a CR.
+                    // Note that we do not handle /u2028 (Unicode linefeed)
+                    // or /u2029 (Unicode paragraph feed) characters.
+                    if (text[lineBreak] == CR)
+                    {
+                        ProcessCharacter(LF);
+                        _prevCR = true;
+                    }
+                    else if (_prevCR)
+                    {
+                        _prevCR = false;
+                    }
+                    else
+                    {
+                        ProcessCharacter(LF);
+                    }
+
+                    text = text.Slice(lineBreak + 1);
                 }
-                // Replace CR with LF.
-                // Note that we do not handle /u2028 (Unicode linefeed)
-                // or /u2029 (Unicode paragraph feed) characters.
-                if (current == CR)
+            }
+
+            public void Complete()
+            {
+                ProcessCharacter(EOF);
+
+                // Flush the remaining lines
+                for (int i = 0; i < BLOCK_SIZE; i++)
                 {
-                    current = LF;
-                    prevCR = true;
+                    if (_lineNumbers[_index] != -1)
+                    {
+                        OutputHash();
+                    }
+
+                    UpdateHash(0);
                 }
-                else
+            }
+
+            // Once we reach a point in the window again then we've processed BLOCK_SIZE
+            // characters, and if the character at this point in the window was the start
+            // of a line then we should output the hash for that line.
+            private void ProcessCharacter(int current)
+            {
+                if (_lineNumbers[_index] != -1)
                 {
-                    prevCR = false;
+                    OutputHash();
                 }
-                if (lineNumbers[index] != -1)
+
+                if (_lineStart)
                 {
-                    outputHash();
+                    _lineStart = false;
+                    _lineNumber++;
+                    _lineNumbers[_index] = _lineNumber;
                 }
-                if (lineStart)
+
+                if (current == LF)
                 {
-                    lineStart = false;
-                    lineNumber++;
-                    lineNumbers[index] = lineNumber;
+                    _lineStart = true;
                 }
-                if (current == LF)
+
+                UpdateHash(current);
+            }
+
+            // Update the current hash value and increment the index in the window
+            private void UpdateHash(int current)
+            {
+                int begin = _window[_index];
+                _window[_index] = current;
+
+                _hash = unchecked((Mod * _hash) + (ulong)current - (s_firstMod * (ulong)begin));
+
+                if (++_index == BLOCK_SIZE)
                 {
-                    lineStart = true;
+                    _index = 0;
                 }
-                updateHash(current);
-            };
+            }
 
-            if (fileText != null)
+            // Output the current hash and line number
+            private void OutputHash()
             {
-                for (int i = 0; i < fileText.Length; i++)
+                _hashCounts.TryGetValue(_hash, out int count);
+                _hashCounts[_hash] = ++count;
+
+                // Format '{hash:x}:{count}' right to left into the buffer.
+                char[] buffer = _outputBuffer;
+                int position = buffer.Length;
+
+                do
                 {
-                    processCharacter(fileText[i]);
+                    buffer[--position] = (char)('0' + (count % 10));
+                    count /= 10;
                 }
+                while (count != 0);
 
-                processCharacter(EOF);
+                buffer[--position] = ':';
 
-                // Flush the remaining lines
-                for (int i = 0; i < BLOCK_SIZE; i++)
+                ulong hash = _hash;
+                do
                 {
-                    if (lineNumbers[index] != -1)
-                    {
-                        outputHash();
-                    }
-                    updateHash(0);
+                    int digit = (int)(hash & 0xF);
+                    buffer[--position] = (char)(digit < 10 ? '0' + digit : 'a' + digit - 10);
+                    hash >>= 4;
                 }
+                while (hash != 0);
+
+                _rollingHashes[_lineNumbers[_index]] = new string(buffer, position, buffer.Length - position);
+                _lineNumbers[_index] = -1;
             }
 
-            return rollingHashes;
-        }
+            private static ulong ComputeFirstMod()
+            {
+                ulong firstMod = 1;
 
-        private static Long ComputeFirstMod()
-        {
-            var firstMod = new Long(1, 0, false);
+                for (int i = 0; i < BLOCK_SIZE; i++)
+                {
+                    firstMod = unchecked(firstMod * Mod);
+                }
 
-            for (int i = 0; i < 100; i++)
-            {
-                firstMod = firstMod.Multiply(MOD);
+                return firstMod;
             }
-
-            return firstMod;
         }
 
-
         public static string ComputeSha256HashValue(string value)
         {
             using (var sha = SHA256.Create())
@@ -181,6 +181,17 @@ namespace Microsoft.CodeAnalysis.Sarif
         /// </returns>
         bool FileExists(string path);
 
+        /// <summary>
+        /// Moves a specified file to a new location, providing the option to specify a new file name.
+        /// </summary>
+        /// <param name="sourceFileName">
+        /// The name of the file to move.
+        /// </param>
+        /// <param name="destFileName">
+        /// The new path and name for the file, which must not already exist.
+        /// </param>
+        void FileMove(string sourceFileName, string destFileName);
+
         /// <summary>
         /// Returns the date and time the specified file or directory was last written to.
         /// </summary>
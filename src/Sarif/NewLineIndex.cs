@@ -2,6 +2,7 @@
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
 using System;
+using System.Collections.Generic;
 using System.Collections.Immutable;
 using System.Diagnostics;
 using System.Diagnostics.CodeAnalysis;
@@ -14,10 +15,26 @@ namespace Microsoft.CodeAnalysis.Sarif
     /// </summary>
     public class NewLineIndex
     {
-        // Each index n in this list denotes the halfopen range
-        //      [lineOffsetStarts(n), lineOffsetStarts(n+1))
-        // which is the line in the file at index n.
-        private readonly ImmutableArray<int> _lineOffsetStarts;
+        // Line n (zero-based) is the halfopen range [start(n), start(n+1)). Rather than an int
+        // per line, the starts are stored in blocks of BlockSize lines: the first start of each
+        // block is kept whole in _blockStarts, and the rest of the block as variable-length
+        // (LEB128) deltas from the preceding start, beginning at _blockDeltaOffsets[block] in
+        // _deltas. Typical source lines are shorter than 128 characters, so most lines take a
+        // single byte, and finding a line costs a binary search over the blocks plus a short
+        // walk through one block.
+        private const int BlockSize = 32;
+        private const int BlockShift = 5;
+
+        private readonly int[] _blockStarts;
+        private readonly int[] _blockDeltaOffsets;
+        private readonly byte[] _deltas;
+        private readonly int _lineCount;
+        private readonly int _textLength;
+
+        private readonly string _text;
+        private readonly Func<string> _textProvider;
+        private readonly WeakReference<string> _indexedText;
+        private readonly int _textHashCode;
 
         // Realistically, no IDE create line locations based on the
         // the unicode separators, so we will ignore them.
@@ -36,34 +53,123 @@ namespace Microsoft.CodeAnalysis.Sarif
         /// <param name="textToIndex">The text to add to this <see cref="NewLineIndex"/>.</param>
         [SuppressMessage("Microsoft.Design", "CA1062:Validate arguments of public methods", MessageId = "0")]
         public NewLineIndex(string textToIndex)
+            : this(textToIndex, textProvider: null)
         {
-            Text = textToIndex;
+        }
 
-            ImmutableArray<int>.Builder result = ImmutableArray.CreateBuilder<int>();
-            result.Add(0);
+        /// <summary>Initializes a new instance of the <see cref="NewLineIndex"/> class indexing the
+        /// specified string without holding on to it.</summary>
+        /// <param name="textToIndex">The text to index.</param>
+        /// <param name="textProvider">Retrieves the indexed text again when <see cref="Text"/> is
+        /// requested and the text is no longer in memory. If null, the index keeps
+        /// <paramref name="textToIndex"/> instead.</param>
+        internal NewLineIndex(string textToIndex, Func<string> textProvider)
+        {
+            _textProvider = textProvider;
+            _text = textProvider == null ? textToIndex : null;
+            _textLength = textToIndex.Length;
 
-            int indexLength = textToIndex.Length;
-            for (int charCount = 0; charCount < indexLength; ++charCount)
+            if (textProvider != null)
             {
-                char c = textToIndex[charCount];
-                // Detect \r, \n, \u2028, \u2029, but NOT \r\n
-                // (\r\n gets taken care of on the following loop
-                // iteration and is detected as \n there)
-                if (s_newLineCharSet.Contains(c))
+                _indexedText = new WeakReference<string>(textToIndex);
+                _textHashCode = StringComparer.Ordinal.GetHashCode(textToIndex);
+            }
+
+            var blockStarts = new List<int>();
+            var blockDeltaOffsets = new List<int>();
+            byte[] deltas = new byte[Math.Max(16, textToIndex.Length / 32)];
+            int deltasLength = 0;
+            int previousStart = 0;
+            int lineCount = 0;
+
+            void AddLineStart(int lineStart)
+            {
+                if ((lineCount & (BlockSize - 1)) == 0)
+                {
+                    blockStarts.Add(lineStart);
+                    blockDeltaOffsets.Add(deltasLength);
+                }
+                else
                 {
-                    if (c != '\r' || charCount + 1 >= indexLength || textToIndex[charCount + 1] != '\n')
+                    if (deltasLength + 5 > deltas.Length)
                     {
-                        result.Add(charCount + 1);
+                        Array.Resize(ref deltas, deltas.Length * 2);
                     }
+
+                    uint delta = (uint)(lineStart - previousStart);
+                    while (delta >= 0x80)
+                    {
+                        deltas[deltasLength++] = (byte)(delta | 0x80);
+                        delta >>= 7;
+                    }
+
+                    deltas[deltasLength++] = (byte)delta;
+                }
+
+                previousStart = lineStart;
+                lineCount++;
+            }
+
+            AddLineStart(0);
+
+            ReadOnlySpan<char> text = textToIndex.AsSpan();
+            int position = 0;
+            int newLine;
+            while ((newLine = text.Slice(position).IndexOfAny('\r', '\n')) >= 0)
+            {
+                position += newLine;
+
+                // Detect \r and \n, but NOT \r\n (\r\n gets taken
+                // care of on the next match and is detected as \n there)
+                if (text[position] != '\r' || position + 1 >= text.Length || text[position + 1] != '\n')
+                {
+                    AddLineStart(position + 1);
+                }
+
+                position++;
+            }
+
+            _lineCount = lineCount;
+            _blockStarts = blockStarts.ToArray();
+            _blockDeltaOffsets = blockDeltaOffsets.ToArray();
+
+            Array.Resize(ref deltas, deltasLength);
+            _deltas = deltas;
+        }
+
+        /// <summary>
+        /// Gets the text contents of the file associated with this new-line index, or null if
+        /// the text had to be retrieved again and is no longer the text that was indexed (the
+        /// file changed since), in which case the index no longer describes the file.
+        /// </summary>
+        public string Text
+        {
+            get
+            {
+                if (_textProvider == null) { return _text; }
+
+                // Text still in memory (in a cache, or held by a caller) is the indexed text.
+                if (_indexedText.TryGetTarget(out string text)) { return text; }
+
+                text = _textProvider();
+                if (text == null || text.Length != _textLength || StringComparer.Ordinal.GetHashCode(text) != _textHashCode)
+                {
+                    return null;
                 }
+
+                _indexedText.SetTarget(text);
+                return text;
             }
-            _lineOffsetStarts = result.ToImmutable();
         }
 
         /// <summary>
-        /// Gets the text contents of the file associated with this new-line index.
+        /// Gets an estimate of the memory, in bytes, held by this index, including
+        /// the indexed text if the index keeps it.
         /// </summary>
-        public string Text { get; }
+        internal long SizeInBytes =>
+            ((_blockStarts.Length + _blockDeltaOffsets.Length) * (long)sizeof(int)) +
+            _deltas.Length +
+            ((_text?.Length ?? 0) * (long)sizeof(char));
 
         /// <summary>Gets a <see cref="LineInfo"/> for the line at the specified index.</summary>
         /// <exception cref="ArgumentOutOfRangeException">Thrown when <paramref name="lineNumber"/> is not
@@ -80,10 +186,10 @@ namespace Microsoft.CodeAnalysis.Sarif
 
             if (lineNumber == this.MaximumLineNumber + 1)
             {
-                return new LineInfo(Text.Length, lineNumber);
+                return new LineInfo(_textLength, lineNumber);
             }
 
-            return new LineInfo(_lineOffsetStarts[lineNumber - 1], lineNumber);
+            return new LineInfo(GetLineStart(lineNumber - 1), lineNumber);
         }
 
         /// <summary>Gets the maximum line number.</summary>
@@ -92,7 +198,7 @@ namespace Microsoft.CodeAnalysis.Sarif
         {
             get
             {
-                return _lineOffsetStarts.Length;
+                return _lineCount;
             }
         }
 
@@ -107,18 +213,33 @@ namespace Microsoft.CodeAnalysis.Sarif
                 throw new ArgumentOutOfRangeException(nameof(offset), offset, SdkResources.ValueCannotBeNegative);
             }
 
-            int startLine = _lineOffsetStarts.BinarySearch(offset);
+            int block = Array.BinarySearch(_blockStarts, offset);
 
-            if (startLine < 0)
+            if (block < 0)
             {
                 // If BinarySearch returns negative, returns the bitwise
                 // complement of the next larger index. (upper_bound)
                 // We want the next smaller index, which is where the -1 comes from.
-                startLine = ~startLine - 1;
-                Debug.Assert(startLine >= 0); // Because startLine < 0 if block
+                block = ~block - 1;
+                Debug.Assert(block >= 0); // Because the first block starts at offset 0
+            }
+
+            // Walk forward through the block to the last line starting at or before offset.
+            int line = block << BlockShift;
+            int lineStart = _blockStarts[block];
+            int lastLineInBlock = Math.Min(line + BlockSize, _lineCount) - 1;
+            int position = _blockDeltaOffsets[block];
+
+            while (line < lastLineInBlock)
+            {
+                int nextLineStart = lineStart + ReadDelta(ref position);
+                if (nextLineStart > offset) { break; }
+
+                lineStart = nextLineStart;
+                line++;
             }
 
-            return new LineInfo(_lineOffsetStarts[startLine], startLine + 1);
+            return new LineInfo(lineStart, line + 1);
         }
 
         /// <summary>Gets information for a given offset, such as the line and column numbers.</summary>
@@ -135,5 +256,36 @@ namespace Microsoft.CodeAnalysis.Sarif
             LineInfo lineInfo = this.GetLineInfoForOffset(offset);
             return new OffsetInfo(offset - lineInfo.StartOffset + 1, lineInfo.LineNumber);
         }
+
+        private int GetLineStart(int line)
+        {
+            int block = line >> BlockShift;
+            int lineStart = _blockStarts[block];
+            int position = _blockDeltaOffsets[block];
+
+            for (int i = block << BlockShift; i < line; i++)
+            {
+                lineStart += ReadDelta(ref position);
+            }
+
+            return lineStart;
+        }
+
+        private int ReadDelta(ref int position)
+        {
+            int delta = 0;
+            int shift = 0;
+            byte b;
+
+            do
+            {
+                b = _deltas[position++];
+                delta |= (b & 0x7F) << shift;
+                shift += 7;
+            }
+            while ((b & 0x80) != 0);
+
+            return delta;
+        }
     }
 }
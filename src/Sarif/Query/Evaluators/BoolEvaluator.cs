@@ -22,25 +22,12 @@ namespace Microsoft.CodeAnalysis.Sarif.Query.Evaluators
     public class BoolEvaluator<T> : IExpressionEvaluator<T>
     {
         private readonly Func<T, bool> _getter;
-        private readonly bool _mustEqual;
+        private readonly Func<bool, bool> _match;
 
         public BoolEvaluator(Func<T, bool> getter, TermExpression term)
         {
             _getter = getter;
-
-            if (!bool.TryParse(term.Value, out bool parsedValue)) { throw new QueryParseException($"{term} value {term.Value} was not a valid boolean."); }
-            _mustEqual = parsedValue;
-
-            switch (term.Operator)
-            {
-                case CompareOperator.Equals:
-                    break;
-                case CompareOperator.NotEquals:
-                    _mustEqual = !_mustEqual;
-                    break;
-                default:
-                    throw new QueryParseException($"In {term}, {term.PropertyName} is boolean and only supports equals and not equals, not operator {term.Operator}");
-            }
+            _match = TermMatchers.BoolMatcher(term);
         }
 
         public void Evaluate(ICollection<T> list, BitArray matches)
@@ -48,7 +35,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Query.Evaluators
             int i = 0;
             foreach (T item in list)
             {
-                matches.Set(i, _getter(item) == _mustEqual);
+                matches.Set(i, _match(_getter(item)));
                 i++;
             }
         }
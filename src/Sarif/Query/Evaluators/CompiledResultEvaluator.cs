@@ -0,0 +1,373 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Linq;
+using System.Runtime.CompilerServices;
+using System.Threading;
+
+namespace Microsoft.CodeAnalysis.Sarif.Query.Evaluators
+{
+    /// <summary>
+    ///  CompiledResultEvaluator compiles a whole query expression into a single predicate per
+    ///  Run, rather than evaluating each term over the set in turn. Lookups which depend only on
+    ///  the Run are done once per Run: the match of each rule (by rule index) and of each artifact
+    ///  URI (by artifact index) against the terms is precomputed into tables. Each Result is then
+    ///  matched with table lookups and non-allocating string comparisons, and AND / OR terms
+    ///  short-circuit per Result.
+    ///
+    ///  It supports the same property names as SarifEvaluators.ResultEvaluator and matches the
+    ///  same Results. Build it once per expression and reuse it; it is safe to use from
+    ///  multiple threads.
+    ///
+    ///  Each Run is bound (its tables built) only once, however many sets or chunks (see
+    ///  ParallelEvaluator) its Results are evaluated in, and the bound predicate is shared by
+    ///  them all. The tables are kept for as long as the Run is, so a Run's rules and artifacts
+    ///  mustn't change while the evaluator is in use.
+    /// </summary>
+    public class CompiledResultEvaluator : IExpressionEvaluator<Result>
+    {
+        private readonly List<EvaluatorNode> _evaluatorNodes;
+        private readonly Node _root;
+        private readonly ConditionalWeakTable<Run, Lazy<Predicate>> _predicateByRun;
+        private readonly Lazy<Predicate> _predicateWithoutRun;
+
+        public CompiledResultEvaluator(IExpression expression)
+        {
+            _evaluatorNodes = new List<EvaluatorNode>();
+            _root = Compile(expression ?? throw new ArgumentNullException(nameof(expression)));
+            _predicateByRun = new ConditionalWeakTable<Run, Lazy<Predicate>>();
+            _predicateWithoutRun = new Lazy<Predicate>(() => _root.Bind(null), LazyThreadSafetyMode.ExecutionAndPublication);
+        }
+
+        /// <summary>
+        ///  Predicate matches a Result, given its position in the set being evaluated and the
+        ///  matches of the uncompiled terms over that set.
+        /// </summary>
+        private delegate bool Predicate(Result result, int index, BitArray[] evaluatorMatches);
+
+        public void Evaluate(ICollection<Result> set, BitArray matches)
+        {
+            // Terms which aren't compiled are evaluated over the whole set up front.
+            var evaluatorMatches = new BitArray[_evaluatorNodes.Count];
+            for (int j = 0; j < evaluatorMatches.Length && set.Count > 0; j++)
+            {
+                evaluatorMatches[j] = new BitArray(set.Count);
+                _evaluatorNodes[j].Evaluator.Evaluate(set, evaluatorMatches[j]);
+            }
+
+            Run boundRun = null;
+            Predicate predicate = null;
+
+            int i = 0;
+            foreach (Result result in set)
+            {
+                // Look up the predicate only when the Run changes; a set is almost always from a single Run.
+                if (predicate == null || !ReferenceEquals(result.Run, boundRun))
+                {
+                    boundRun = result.Run;
+                    predicate = GetPredicate(boundRun);
+                }
+
+                matches.Set(i, predicate(result, i, evaluatorMatches));
+                i++;
+            }
+        }
+
+        private Predicate GetPredicate(Run run)
+        {
+            if (run == null) { return _predicateWithoutRun.Value; }
+
+            // Concurrent callers may each create a Lazy, but only one is kept, so the Run is bound once.
+            return _predicateByRun.GetValue(run, r => new Lazy<Predicate>(() => _root.Bind(r), LazyThreadSafetyMode.ExecutionAndPublication)).Value;
+        }
+
+        private Node Compile(IExpression expression)
+        {
+            switch (expression)
+            {
+                case TermExpression term:
+                    return CompileTerm(term);
+                case AndExpression and:
+                    return new AndNode(and.Terms.Select(Compile).ToArray());
+                case OrExpression or:
+                    return new OrNode(or.Terms.Select(Compile).ToArray());
+                case NotExpression not:
+                    return new NotNode(Compile(not.Inner));
+                case AllExpression _:
+                    return new ResultNode(r => true);
+                case NoneExpression _:
+                    return new ResultNode(r => false);
+                default:
+                    throw new NotImplementedException($"{nameof(CompiledResultEvaluator)} not implemented for {expression.GetType().Name}");
+            }
+        }
+
+        private Node CompileTerm(TermExpression term)
+        {
+            switch (term.PropertyName.ToLowerInvariant())
+            {
+                case "baselinestate":
+                    Func<BaselineState, bool> baselineState = TermMatchers.EnumMatcher<BaselineState>(term);
+                    return new ResultNode(r => baselineState(r.BaselineState));
+                case "correlationguid":
+                    Func<string, bool> correlationGuid = TermMatchers.StringMatcher(term, StringComparison.OrdinalIgnoreCase);
+                    return new ResultNode(r => correlationGuid(r.CorrelationGuid?.ToString(SarifConstants.GuidFormat)));
+                case "guid":
+                    Func<string, bool> guid = TermMatchers.StringMatcher(term, StringComparison.OrdinalIgnoreCase);
+                    return new ResultNode(r => guid(r.Guid?.ToString(SarifConstants.GuidFormat)));
+                case "hostedvieweruri":
+                    Func<string, bool> hostedViewerUri = TermMatchers.StringMatcher(term, StringComparison.OrdinalIgnoreCase);
+                    return new ResultNode(r => hostedViewerUri(r.HostedViewerUri?.ToString()));
+                case "kind":
+                    Func<ResultKind, bool> kind = TermMatchers.EnumMatcher<ResultKind>(term);
+                    return new ResultNode(r => kind(r.Kind));
+                case "level":
+                    Func<FailureLevel, bool> level = TermMatchers.EnumMatcher<FailureLevel>(term);
+                    return new ResultNode(r => level(r.Level));
+                case "message.text":
+                    Func<string, bool> messageText = TermMatchers.StringMatcher(term, StringComparison.OrdinalIgnoreCase);
+                    return new ResultNode(r => messageText(r.Message?.Text));
+                case "occurrencecount":
+                    Func<long, bool> occurrenceCount = TermMatchers.LongMatcher(term, out _);
+                    return new ResultNode(r => occurrenceCount(r.OccurrenceCount));
+                case "rank":
+                    Func<double, bool> rank = TermMatchers.DoubleMatcher(term);
+                    return new ResultNode(r => rank(r.Rank));
+                case "issuppressed":
+                    Func<bool, bool> isSuppressed = TermMatchers.BoolMatcher(term);
+                    return new ResultNode(r => isSuppressed(r.TryIsSuppressed(out bool suppressed) && suppressed));
+                case "ruleid":
+                    return new RuleIdNode(TermMatchers.StringMatcher(term, StringComparison.OrdinalIgnoreCase));
+                case "uri":
+                    return new UriNode(TermMatchers.StringMatcher(term, StringComparison.OrdinalIgnoreCase));
+
+                default:
+                    // Property bag terms (and any errors for unknown names) come from the per-term evaluator.
+                    var evaluatorNode = new EvaluatorNode(SarifEvaluators.ResultEvaluator(term), _evaluatorNodes.Count);
+                    _evaluatorNodes.Add(evaluatorNode);
+                    return evaluatorNode;
+            }
+        }
+
+        /// <summary>
+        ///  Node is a compiled part of the expression. Bind returns the predicate for the Results
+        ///  of one Run; it is read-only, so it may be shared by concurrent evaluations.
+        /// </summary>
+        private abstract class Node
+        {
+            public abstract Predicate Bind(Run run);
+        }
+
+        private class AndNode : Node
+        {
+            private readonly Node[] _terms;
+
+            public AndNode(Node[] terms)
+            {
+                _terms = terms;
+            }
+
+            public override Predicate Bind(Run run)
+            {
+                Predicate[] terms = _terms.Select(t => t.Bind(run)).ToArray();
+
+                return (r, i, m) =>
+                {
+                    foreach (Predicate term in terms)
+                    {
+                        if (!term(r, i, m)) { return false; }
+                    }
+
+                    return true;
+                };
+            }
+        }
+
+        private class OrNode : Node
+        {
+            private readonly Node[] _terms;
+
+            public OrNode(Node[] terms)
+            {
+                _terms = terms;
+            }
+
+            public override Predicate Bind(Run run)
+            {
+                Predicate[] terms = _terms.Select(t => t.Bind(run)).ToArray();
+
+                return (r, i, m) =>
+                {
+                    foreach (Predicate term in terms)
+                    {
+                        if (term(r, i, m)) { return true; }
+                    }
+
+                    return false;
+                };
+            }
+        }
+
+        private class NotNode : Node
+        {
+            private readonly Node _inner;
+
+            public NotNode(Node inner)
+            {
+                _inner = inner;
+            }
+
+            public override Predicate Bind(Run run)
+            {
+                Predicate inner = _inner.Bind(run);
+                return (r, i, m) => !inner(r, i, m);
+            }
+        }
+
+        private class ResultNode : Node
+        {
+            private readonly Func<Result, bool> _predicate;
+
+            public ResultNode(Func<Result, bool> predicate)
+            {
+                _predicate = predicate;
+            }
+
+            public override Predicate Bind(Run run)
+            {
+                return (r, i, m) => _predicate(r);
+            }
+        }
+
+        /// <summary>
+        ///  RuleIdNode matches the id of each rule in the Run's driver once, so that Results
+        ///  which refer to their rule by index are matched with a table lookup.
+        /// </summary>
+        private class RuleIdNode : Node
+        {
+            private readonly Func<string, bool> _match;
+
+            public RuleIdNode(Func<string, bool> match)
+            {
+                _match = match;
+            }
+
+            public override Predicate Bind(Run run)
+            {
+                if (run == null)
+                {
+                    // Throws the same error as the per-term evaluator.
+                    return (r, i, m) => _match(r.GetRule(r.Run).Id);
+                }
+
+                IList<ReportingDescriptor> rules = run.Tool?.Driver?.Rules;
+                bool[] matchByRuleIndex = rules?.Select(rule => _match(rule?.Id)).ToArray() ?? Array.Empty<bool>();
+
+                return (r, i, m) =>
+                {
+                    if (r.Rule?.ToolComponent == null)
+                    {
+                        int ruleIndex = r.RuleIndex >= 0 ? r.RuleIndex : (r.Rule?.Index ?? -1);
+
+                        if (ruleIndex >= 0 && ruleIndex < matchByRuleIndex.Length)
+                        {
+                            return matchByRuleIndex[ruleIndex];
+                        }
+
+                        // Without an index or Guid, the rule found (if any) has the Result's own rule id.
+                        if (ruleIndex < 0 && r.Rule?.Guid == null)
+                        {
+                            return _match(r.RuleId ?? r.Rule?.Id);
+                        }
+                    }
+
+                    return _match(r.GetRule(run).Id);
+                };
+            }
+        }
+
+        /// <summary>
+        ///  UriNode matches the URI of each artifact in the Run once (on first use), so that
+        ///  locations which refer to an artifact by index are matched with a table lookup.
+        ///  A Result matches if the URI of any of its Locations matches.
+        /// </summary>
+        private class UriNode : Node
+        {
+            private readonly Func<string, bool> _match;
+
+            public UriNode(Func<string, bool> match)
+            {
+                _match = match;
+            }
+
+            public override Predicate Bind(Run run)
+            {
+                if (run == null)
+                {
+                    return (r, i, m) =>
+                    {
+                        // Throws the same error as the per-term evaluator.
+                        r.EnsureRunProvided();
+                        return false;
+                    };
+                }
+
+                IList<Artifact> artifacts = run.Artifacts;
+                bool[] matchByArtifactIndex = null;
+
+                return (r, i, m) =>
+                {
+                    if (r.Locations == null) { return false; }
+
+                    foreach (Location location in r.Locations)
+                    {
+                        ArtifactLocation artifactLocation = location?.PhysicalLocation?.ArtifactLocation;
+                        int artifactIndex = artifactLocation?.Index ?? -1;
+
+                        bool isMatch;
+                        if (artifactIndex >= 0 && artifactIndex < artifacts?.Count)
+                        {
+                            isMatch = LazyInitializer.EnsureInitialized(
+                                ref matchByArtifactIndex,
+                                () => artifacts.Select(a => _match(a?.Location?.Uri?.ToString())).ToArray())[artifactIndex];
+                        }
+                        else
+                        {
+                            isMatch = _match(artifactLocation?.Uri?.ToString());
+                        }
+
+                        if (isMatch) { return true; }
+                    }
+
+                    return false;
+                };
+            }
+        }
+
+        /// <summary>
+        ///  EvaluatorNode looks up each Result's match, by position, in the matches of a per-term
+        ///  IExpressionEvaluator, which Evaluate runs over the whole set once, for terms which
+        ///  aren't compiled.
+        /// </summary>
+        private class EvaluatorNode : Node
+        {
+            private readonly int _slot;
+
+            public EvaluatorNode(IExpressionEvaluator<Result> evaluator, int slot)
+            {
+                Evaluator = evaluator;
+                _slot = slot;
+            }
+
+            public IExpressionEvaluator<Result> Evaluator { get; }
+
+            public override Predicate Bind(Run run)
+            {
+                return (r, i, m) => m[_slot][i];
+            }
+        }
+    }
+}
@@ -22,101 +22,20 @@ namespace Microsoft.CodeAnalysis.Sarif.Query.Evaluators
     public class DoubleEvaluator<T> : IExpressionEvaluator<T>
     {
         private readonly Func<T, double> _getter;
-        private readonly double _value;
-        private readonly Action<ICollection<T>, BitArray> _evaluateSet;
+        private readonly Func<double, bool> _match;
 
         public DoubleEvaluator(Func<T, double> getter, TermExpression term)
         {
             _getter = getter;
-
-            if (!double.TryParse(term.Value, out double parsedValue)) { throw new QueryParseException($"{term} value {term.Value} was not a valid floating point number."); }
-            _value = parsedValue;
-
-            _evaluateSet = Comparer(term);
+            _match = TermMatchers.DoubleMatcher(term);
         }
 
         public void Evaluate(ICollection<T> list, BitArray matches)
-        {
-            _evaluateSet(list, matches);
-        }
-
-        private Action<ICollection<T>, BitArray> Comparer(TermExpression term)
-        {
-            switch (term.Operator)
-            {
-                case CompareOperator.Equals:
-                    return EvaluateEquals;
-                case CompareOperator.NotEquals:
-                    return EvaluateNotEquals;
-                case CompareOperator.LessThan:
-                    return EvaluateLessThan;
-                case CompareOperator.LessThanOrEquals:
-                    return EvaluateLessThanOrEquals;
-                case CompareOperator.GreaterThan:
-                    return EvaluateGreaterThan;
-                case CompareOperator.GreaterThanOrEquals:
-                    return EvaluateGreaterThanOrEquals;
-                default:
-                    throw new QueryParseException($"{term} does not support operator {term.Operator}");
-            }
-        }
-
-        private void EvaluateEquals(ICollection<T> list, BitArray matches)
-        {
-            int i = 0;
-            foreach (T item in list)
-            {
-                matches.Set(i, _getter(item) == _value);
-                i++;
-            }
-        }
-
-        private void EvaluateNotEquals(ICollection<T> list, BitArray matches)
-        {
-            int i = 0;
-            foreach (T item in list)
-            {
-                matches.Set(i, _getter(item) != _value);
-                i++;
-            }
-        }
-
-        private void EvaluateLessThan(ICollection<T> list, BitArray matches)
-        {
-            int i = 0;
-            foreach (T item in list)
-            {
-                matches.Set(i, _getter(item) < _value);
-                i++;
-            }
-        }
-
-        private void EvaluateLessThanOrEquals(ICollection<T> list, BitArray matches)
-        {
-            int i = 0;
-            foreach (T item in list)
-            {
-                matches.Set(i, _getter(item) <= _value);
-                i++;
-            }
-        }
-
-        private void EvaluateGreaterThan(ICollection<T> list, BitArray matches)
-        {
-            int i = 0;
-            foreach (T item in list)
-            {
-                matches.Set(i, _getter(item) > _value);
-                i++;
-            }
-        }
-
-        private void EvaluateGreaterThanOrEquals(ICollection<T> list, BitArray matches)
         {
             int i = 0;
             foreach (T item in list)
             {
-                matches.Set(i, _getter(item) >= _value);
+                matches.Set(i, _match(_getter(item)));
                 i++;
             }
         }
@@ -23,53 +23,20 @@ namespace Microsoft.CodeAnalysis.Sarif.Query.Evaluators
     public class EnumEvaluator<T, EnumType> : IExpressionEvaluator<T> where EnumType : struct, Enum
     {
         private readonly Func<T, EnumType> _getter;
-        private readonly EnumType _value;
-        private readonly Action<ICollection<T>, BitArray> _evaluateSet;
+        private readonly Func<EnumType, bool> _match;
 
         public EnumEvaluator(Func<T, EnumType> getter, TermExpression term)
         {
             _getter = getter;
-
-            if (!Enum.TryParse<EnumType>(term.Value, out EnumType parsedValue)) { throw new QueryParseException($"{term} value {term.Value} was not a valid {typeof(EnumType).Name}."); }
-            _value = parsedValue;
-
-            _evaluateSet = Comparer(term);
+            _match = TermMatchers.EnumMatcher<EnumType>(term);
         }
 
         public void Evaluate(ICollection<T> list, BitArray matches)
-        {
-            _evaluateSet(list, matches);
-        }
-
-        private Action<ICollection<T>, BitArray> Comparer(TermExpression term)
-        {
-            switch (term.Operator)
-            {
-                case CompareOperator.Equals:
-                    return EvaluateEquals;
-                case CompareOperator.NotEquals:
-                    return EvaluateNotEquals;
-                default:
-                    throw new QueryParseException($"In {term}, {term.PropertyName} only supports equals and not equals, not operator {term.Operator}");
-            }
-        }
-
-        private void EvaluateEquals(ICollection<T> list, BitArray matches)
-        {
-            int i = 0;
-            foreach (T item in list)
-            {
-                matches.Set(i, _getter(item).Equals(_value));
-                i++;
-            }
-        }
-
-        private void EvaluateNotEquals(ICollection<T> list, BitArray matches)
         {
             int i = 0;
             foreach (T item in list)
             {
-                matches.Set(i, !_getter(item).Equals(_value));
+                matches.Set(i, _match(_getter(item)));
                 i++;
             }
         }
@@ -22,102 +22,23 @@ namespace Microsoft.CodeAnalysis.Sarif.Query.Evaluators
     public class LongEvaluator<T> : IExpressionEvaluator<T>
     {
         private readonly Func<T, long> _getter;
-        private readonly Action<ICollection<T>, BitArray> _evaluateSet;
+        private readonly Func<long, bool> _match;
 
         public long Value { get; }
 
         public LongEvaluator(Func<T, long> getter, TermExpression term)
         {
             _getter = getter;
-
-            if (!long.TryParse(term.Value, out long parsedValue)) { throw new QueryParseException($"{term} value {term.Value} was not a valid number."); }
+            _match = TermMatchers.LongMatcher(term, out long parsedValue);
             Value = parsedValue;
-
-            _evaluateSet = Comparer(term);
         }
 
         public void Evaluate(ICollection<T> list, BitArray matches)
-        {
-            _evaluateSet(list, matches);
-        }
-
-        private Action<ICollection<T>, BitArray> Comparer(TermExpression term)
-        {
-            switch (term.Operator)
-            {
-                case CompareOperator.Equals:
-                    return EvaluateEquals;
-                case CompareOperator.NotEquals:
-                    return EvaluateNotEquals;
-                case CompareOperator.LessThan:
-                    return EvaluateLessThan;
-                case CompareOperator.LessThanOrEquals:
-                    return EvaluateLessThanOrEquals;
-                case CompareOperator.GreaterThan:
-                    return EvaluateGreaterThan;
-                case CompareOperator.GreaterThanOrEquals:
-                    return EvaluateGreaterThanOrEquals;
-                default:
-                    throw new QueryParseException($"{term} does not support operator {term.Operator}");
-            }
-        }
-
-        private void EvaluateEquals(ICollection<T> list, BitArray matches)
-        {
-            int i = 0;
-            foreach (T item in list)
-            {
-                matches.Set(i, _getter(item) == Value);
-                i++;
-            }
-        }
-
-        private void EvaluateNotEquals(ICollection<T> list, BitArray matches)
-        {
-            int i = 0;
-            foreach (T item in list)
-            {
-                matches.Set(i, _getter(item) != Value);
-                i++;
-            }
-        }
-
-        private void EvaluateLessThan(ICollection<T> list, BitArray matches)
-        {
-            int i = 0;
-            foreach (T item in list)
-            {
-                matches.Set(i, _getter(item) < Value);
-                i++;
-            }
-        }
-
-        private void EvaluateLessThanOrEquals(ICollection<T> list, BitArray matches)
-        {
-            int i = 0;
-            foreach (T item in list)
-            {
-                matches.Set(i, _getter(item) <= Value);
-                i++;
-            }
-        }
-
-        private void EvaluateGreaterThan(ICollection<T> list, BitArray matches)
-        {
-            int i = 0;
-            foreach (T item in list)
-            {
-                matches.Set(i, _getter(item) > Value);
-                i++;
-            }
-        }
-
-        private void EvaluateGreaterThanOrEquals(ICollection<T> list, BitArray matches)
         {
             int i = 0;
             foreach (T item in list)
             {
-                matches.Set(i, _getter(item) >= Value);
+                matches.Set(i, _match(_getter(item)));
                 i++;
             }
         }
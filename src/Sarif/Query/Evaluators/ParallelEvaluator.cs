@@ -0,0 +1,146 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading.Tasks;
+
+using Microsoft.CodeAnalysis.Sarif.Readers;
+
+namespace Microsoft.CodeAnalysis.Sarif.Query.Evaluators
+{
+    /// <summary>
+    ///  ParallelEvaluator runs another evaluator over a large set on several threads.
+    ///  The set is split into chunks small enough to stay in cache, the inner evaluator
+    ///  runs on each chunk independently, and the per-chunk matches are combined.
+    /// </summary>
+    /// <remarks>
+    ///  Because each chunk is evaluated separately, an AndEvaluator inside stops evaluating
+    ///  later terms for any chunk with no remaining matches, and an OrEvaluator stops once
+    ///  every item in the chunk matches.
+    ///
+    ///  The inner evaluator and the getters it uses must be safe to call from multiple threads.
+    /// </remarks>
+    /// <typeparam name="T">Type of items being evaluated</typeparam>
+    public class ParallelEvaluator<T> : IExpressionEvaluator<T>
+    {
+        public const int DefaultChunkSize = 4096;
+
+        private readonly IExpressionEvaluator<T> _inner;
+        private readonly int _chunkSize;
+        private readonly int _maxDegreeOfParallelism;
+
+        /// <summary>
+        ///  Build a ParallelEvaluator.
+        /// </summary>
+        /// <param name="inner">Evaluator to run on each chunk</param>
+        /// <param name="maxDegreeOfParallelism">Maximum threads to use; zero or less for one per processor</param>
+        /// <param name="chunkSize">Number of items to evaluate together on one thread</param>
+        public ParallelEvaluator(IExpressionEvaluator<T> inner, int maxDegreeOfParallelism = 0, int chunkSize = DefaultChunkSize)
+        {
+            if (chunkSize <= 0) { throw new ArgumentOutOfRangeException(nameof(chunkSize)); }
+
+            _inner = inner ?? throw new ArgumentNullException(nameof(inner));
+            _chunkSize = chunkSize;
+            _maxDegreeOfParallelism = maxDegreeOfParallelism > 0 ? maxDegreeOfParallelism : Environment.ProcessorCount;
+        }
+
+        public void Evaluate(ICollection<T> set, BitArray matches)
+        {
+            // Small sets aren't worth the overhead of splitting up.
+            if (set.Count <= _chunkSize || _maxDegreeOfParallelism == 1)
+            {
+                _inner.Evaluate(set, matches);
+                return;
+            }
+
+            // Chunks need concurrent random access. DeferredList seeks a shared stream on each access, so read it once instead.
+            IList<T> list = (set is IList<T> l && !(set is DeferredList<T>)) ? l : set.ToList();
+
+            int chunkCount = (list.Count + _chunkSize - 1) / _chunkSize;
+            var chunkMatches = new BitArray[chunkCount];
+
+            Parallel.For(0, chunkCount, new ParallelOptions { MaxDegreeOfParallelism = _maxDegreeOfParallelism }, (chunkIndex) =>
+            {
+                var chunk = new ListSegment<T>(list, chunkIndex * _chunkSize, Math.Min(_chunkSize, list.Count - (chunkIndex * _chunkSize)));
+                var chunkResult = new BitArray(chunk.Count);
+                _inner.Evaluate(chunk, chunkResult);
+                chunkMatches[chunkIndex] = chunkResult;
+            });
+
+            // Combine on one thread; BitArray isn't safe for concurrent writes to nearby bits.
+            for (int chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+            {
+                BitArray chunkResult = chunkMatches[chunkIndex];
+                int offset = chunkIndex * _chunkSize;
+
+                for (int i = 0; i < chunkResult.Count; ++i)
+                {
+                    if (chunkResult[i]) { matches[offset + i] = true; }
+                }
+            }
+        }
+
+        /// <summary>
+        ///  ListSegment is a read-only view of a range of an IList, passed to the inner
+        ///  evaluator for each chunk without copying the items.
+        /// </summary>
+        private class ListSegment<U> : ICollection<U>
+        {
+            private readonly IList<U> _list;
+            private readonly int _offset;
+
+            public ListSegment(IList<U> list, int offset, int count)
+            {
+                _list = list;
+                _offset = offset;
+                Count = count;
+            }
+
+            public int Count { get; }
+
+            public bool IsReadOnly => true;
+
+            public IEnumerator<U> GetEnumerator()
+            {
+                for (int i = 0; i < Count; ++i)
+                {
+                    yield return _list[_offset + i];
+                }
+            }
+
+            IEnumerator IEnumerable.GetEnumerator()
+            {
+                return GetEnumerator();
+            }
+
+            public bool Contains(U item)
+            {
+                EqualityComparer<U> comparer = EqualityComparer<U>.Default;
+
+                for (int i = 0; i < Count; ++i)
+                {
+                    if (comparer.Equals(_list[_offset + i], item)) { return true; }
+                }
+
+                return false;
+            }
+
+            public void CopyTo(U[] array, int arrayIndex)
+            {
+                for (int i = 0; i < Count; ++i)
+                {
+                    array[arrayIndex + i] = _list[_offset + i];
+                }
+            }
+
+            public void Add(U item) => throw new NotSupportedException();
+
+            public void Clear() => throw new NotSupportedException();
+
+            public bool Remove(U item) => throw new NotSupportedException();
+        }
+    }
+}
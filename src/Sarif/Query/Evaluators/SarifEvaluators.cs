@@ -2,6 +2,7 @@
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
 using System;
+using System.Collections.Generic;
 using System.Globalization;
 using System.Linq;
 
@@ -9,6 +10,12 @@ namespace Microsoft.CodeAnalysis.Sarif.Query.Evaluators
 {
     public static class SarifEvaluators
     {
+        // The Result properties kept in a ResultIndex.
+        private static readonly HashSet<string> s_indexedPropertyNames = new HashSet<string>
+        {
+            "baselinestate", "kind", "level", "rank", "ruleid", "issuppressed", "uri"
+        };
+
         public static IExpressionEvaluator<Result> ResultEvaluator(TermExpression term)
         {
             string propertyNameLower = term.PropertyName.ToLowerInvariant();
@@ -60,5 +67,58 @@ namespace Microsoft.CodeAnalysis.Sarif.Query.Evaluators
                             term.PropertyName));
             }
         }
+
+        /// <summary>
+        ///  Build an evaluator for a term against the rows of a ResultIndex.
+        ///  Only the properties in the index may be used; see CanEvaluateFromIndex.
+        /// </summary>
+        public static IExpressionEvaluator<ResultIndexRow> ResultIndexRowEvaluator(TermExpression term)
+        {
+            switch (term.PropertyName.ToLowerInvariant())
+            {
+                case "baselinestate":
+                    return new EnumEvaluator<ResultIndexRow, BaselineState>(r => r.BaselineState, term);
+                case "kind":
+                    return new EnumEvaluator<ResultIndexRow, ResultKind>(r => r.Kind, term);
+                case "level":
+                    return new EnumEvaluator<ResultIndexRow, FailureLevel>(r => r.Level, term);
+                case "rank":
+                    return new DoubleEvaluator<ResultIndexRow>(r => r.Rank, term);
+                case "ruleid":
+                    return new StringEvaluator<ResultIndexRow>(r => r.RuleId, term, StringComparison.OrdinalIgnoreCase);
+                case "issuppressed":
+                    return new BoolEvaluator<ResultIndexRow>(r => r.IsSuppressed, term);
+                case "uri":
+                    return new SetEvaluator<ResultIndexRow, string>(r => r.Uris, term);
+
+                default:
+                    throw new QueryParseException(
+                        string.Format(
+                            CultureInfo.CurrentCulture,
+                            SdkResources.ErrorInvalidQueryPropertyName,
+                            term.PropertyName));
+            }
+        }
+
+        /// <summary>
+        ///  Return whether every term in an expression refers to a property kept in a ResultIndex,
+        ///  so that the expression can be evaluated with ResultIndexRowEvaluator.
+        /// </summary>
+        public static bool CanEvaluateFromIndex(IExpression expression)
+        {
+            switch (expression)
+            {
+                case TermExpression term:
+                    return s_indexedPropertyNames.Contains(term.PropertyName.ToLowerInvariant());
+                case AndExpression and:
+                    return and.Terms.All(CanEvaluateFromIndex);
+                case OrExpression or:
+                    return or.Terms.All(CanEvaluateFromIndex);
+                case NotExpression not:
+                    return CanEvaluateFromIndex(not.Inner);
+                default:
+                    return expression is AllExpression || expression is NoneExpression;
+            }
+        }
     }
 }
@@ -0,0 +1,122 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+
+namespace Microsoft.CodeAnalysis.Sarif.Query.Evaluators
+{
+    /// <summary>
+    ///  TermMatchers build the predicate which matches a single value against a term, so that the
+    ///  per-term evaluators and CompiledResultEvaluator parse terms, compare values and report
+    ///  unsupported operators the same way.
+    /// </summary>
+    internal static class TermMatchers
+    {
+        public static Func<string, bool> StringMatcher(TermExpression term, StringComparison comparison)
+        {
+            string value = term.Value;
+
+            switch (term.Operator)
+            {
+                case CompareOperator.Equals:
+                    return s => string.Equals(s ?? "", value, comparison);
+                case CompareOperator.NotEquals:
+                    return s => !string.Equals(s ?? "", value, comparison);
+                case CompareOperator.LessThan:
+                    return s => string.Compare(s ?? "", value, comparison) < 0;
+                case CompareOperator.LessThanOrEquals:
+                    return s => string.Compare(s ?? "", value, comparison) <= 0;
+                case CompareOperator.GreaterThan:
+                    return s => string.Compare(s ?? "", value, comparison) > 0;
+                case CompareOperator.GreaterThanOrEquals:
+                    return s => string.Compare(s ?? "", value, comparison) >= 0;
+                case CompareOperator.StartsWith:
+                    return s => (s ?? "").StartsWith(value, comparison);
+                case CompareOperator.Contains:
+                    return s => (s ?? "").IndexOf(value, comparison) != -1;
+                case CompareOperator.EndsWith:
+                    return s => (s ?? "").EndsWith(value, comparison);
+
+                default:
+                    throw new QueryParseException($"{term} does not support operator {term.Operator}");
+            }
+        }
+
+        public static Func<E, bool> EnumMatcher<E>(TermExpression term) where E : struct, Enum
+        {
+            if (!Enum.TryParse<E>(term.Value, out E value)) { throw new QueryParseException($"{term} value {term.Value} was not a valid {typeof(E).Name}."); }
+
+            switch (term.Operator)
+            {
+                case CompareOperator.Equals:
+                    return e => e.Equals(value);
+                case CompareOperator.NotEquals:
+                    return e => !e.Equals(value);
+                default:
+                    throw new QueryParseException($"In {term}, {term.PropertyName} only supports equals and not equals, not operator {term.Operator}");
+            }
+        }
+
+        public static Func<double, bool> DoubleMatcher(TermExpression term)
+        {
+            if (!double.TryParse(term.Value, out double value)) { throw new QueryParseException($"{term} value {term.Value} was not a valid floating point number."); }
+
+            switch (term.Operator)
+            {
+                case CompareOperator.Equals:
+                    return d => d == value;
+                case CompareOperator.NotEquals:
+                    return d => d != value;
+                case CompareOperator.LessThan:
+                    return d => d < value;
+                case CompareOperator.LessThanOrEquals:
+                    return d => d <= value;
+                case CompareOperator.GreaterThan:
+                    return d => d > value;
+                case CompareOperator.GreaterThanOrEquals:
+                    return d => d >= value;
+                default:
+                    throw new QueryParseException($"{term} does not support operator {term.Operator}");
+            }
+        }
+
+        public static Func<long, bool> LongMatcher(TermExpression term, out long value)
+        {
+            if (!long.TryParse(term.Value, out value)) { throw new QueryParseException($"{term} value {term.Value} was not a valid number."); }
+            long parsedValue = value;
+
+            switch (term.Operator)
+            {
+                case CompareOperator.Equals:
+                    return l => l == parsedValue;
+                case CompareOperator.NotEquals:
+                    return l => l != parsedValue;
+                case CompareOperator.LessThan:
+                    return l => l < parsedValue;
+                case CompareOperator.LessThanOrEquals:
+                    return l => l <= parsedValue;
+                case CompareOperator.GreaterThan:
+                    return l => l > parsedValue;
+                case CompareOperator.GreaterThanOrEquals:
+                    return l => l >= parsedValue;
+                default:
+                    throw new QueryParseException($"{term} does not support operator {term.Operator}");
+            }
+        }
+
+        public static Func<bool, bool> BoolMatcher(TermExpression term)
+        {
+            if (!bool.TryParse(term.Value, out bool value)) { throw new QueryParseException($"{term} value {term.Value} was not a valid boolean."); }
+
+            switch (term.Operator)
+            {
+                case CompareOperator.Equals:
+                    return b => b == value;
+                case CompareOperator.NotEquals:
+                    return b => b != value;
+                default:
+                    throw new QueryParseException($"In {term}, {term.PropertyName} is boolean and only supports equals and not equals, not operator {term.Operator}");
+            }
+        }
+    }
+}
@@ -0,0 +1,44 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System.Collections.Generic;
+
+using Newtonsoft.Json;
+
+namespace Microsoft.CodeAnalysis.Sarif.Query
+{
+    /// <summary>
+    ///  ResultIndex is a compact, columnar summary of the Results in a SARIF log: the values
+    ///  of the commonly queried Result properties, plus the byte offset of each Result in the
+    ///  log. It's persisted beside the log so that repeated queries can be answered without
+    ///  deserializing the log, reading only the Results which match.
+    /// </summary>
+    public class ResultIndex
+    {
+        /// <summary>
+        ///  The version of the index format. Indices with any other version are rebuilt.
+        /// </summary>
+        public const int CurrentVersion = 1;
+
+        [JsonProperty("version")]
+        public int Version { get; set; }
+
+        /// <summary>
+        ///  The length, in bytes, of the log the index was built from.
+        /// </summary>
+        [JsonProperty("sourceLength")]
+        public long SourceLength { get; set; }
+
+        /// <summary>
+        ///  The index of the Results in each Run, in the order of Runs in the log.
+        /// </summary>
+        [JsonProperty("runs")]
+        public List<ResultIndexRun> Runs { get; set; }
+
+        /// <summary>
+        ///  The log with the Results removed from each Run, used to write out matching Results.
+        /// </summary>
+        [JsonProperty("log")]
+        public SarifLog Log { get; set; }
+    }
+}
@@ -0,0 +1,135 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections.Generic;
+using System.IO;
+
+using Microsoft.CodeAnalysis.Sarif.Readers;
+
+using Newtonsoft.Json;
+
+namespace Microsoft.CodeAnalysis.Sarif.Query
+{
+    /// <summary>
+    ///  ResultIndexBuilder builds a ResultIndex for a SARIF log, and reads individual Results
+    ///  back out of the log using the offsets recorded in the index.
+    /// </summary>
+    public static class ResultIndexBuilder
+    {
+        private static readonly JsonSerializer s_resultSerializer = new JsonSerializer();
+
+        /// <summary>
+        ///  Build a ResultIndex for the log in a stream.
+        /// </summary>
+        /// <param name="streamProvider">A function which opens the log stream; called more than once</param>
+        /// <returns>ResultIndex for the log</returns>
+        public static ResultIndex Build(Func<Stream> streamProvider)
+        {
+            var index = new ResultIndex { Version = ResultIndex.CurrentVersion, Runs = new List<ResultIndexRun>() };
+
+            using (Stream stream = streamProvider())
+            {
+                index.SourceLength = stream.Length;
+            }
+
+            var serializer = new JsonSerializer { ContractResolver = SarifDeferredContractResolver.Instance };
+
+            SarifLog log;
+            using (var reader = new JsonPositionedTextReader(streamProvider))
+            {
+                log = serializer.Deserialize<SarifLog>(reader);
+            }
+
+            if (log?.Runs != null)
+            {
+                foreach (Run run in log.Runs)
+                {
+                    index.Runs.Add(BuildRun(run));
+
+                    // The index keeps everything but the Results, so that matches can be written without reading the Runs again.
+                    if (run != null) { run.Results = null; }
+                }
+            }
+
+            index.Log = log;
+            return index;
+        }
+
+        /// <summary>
+        ///  Read the Result which starts at the given offset in a log stream.
+        /// </summary>
+        /// <param name="stream">Seekable stream over the log</param>
+        /// <param name="position">Absolute byte offset of the Result, from ResultIndexRun.ResultStarts</param>
+        /// <returns>Result at the offset</returns>
+        public static Result ReadResult(Stream stream, long position)
+        {
+            stream.Seek(position, SeekOrigin.Begin);
+
+            using (var reader = new JsonInnerTextReader(new StreamReader(stream)))
+            {
+                reader.CloseInput = false;
+                reader.Read();
+
+                return s_resultSerializer.Deserialize<Result>(reader);
+            }
+        }
+
+        private static ResultIndexRun BuildRun(Run run)
+        {
+            var indexRun = new ResultIndexRun();
+            if (run?.Results == null) { return indexRun; }
+
+            var stringIndices = new Dictionary<string, int>(StringComparer.Ordinal);
+
+            foreach (Result result in run.Results)
+            {
+                // Deferred enumeration doesn't apply transformers, so set the Run here for rule and artifact lookups.
+                result.Run = run;
+
+                indexRun.RuleIds.Add(AddString(indexRun, stringIndices, result.GetRule(run)?.Id));
+                indexRun.Levels.Add(result.Level);
+                indexRun.Kinds.Add(result.Kind);
+                indexRun.BaselineStates.Add(result.BaselineState);
+                indexRun.Ranks.Add(result.Rank);
+                indexRun.IsSuppressed.Add(result.TryIsSuppressed(out bool suppressed) && suppressed);
+
+                int[] uris = null;
+                if (result.Locations != null)
+                {
+                    uris = new int[result.Locations.Count];
+                    for (int i = 0; i < uris.Length; ++i)
+                    {
+                        string uri = result.Locations[i]?.PhysicalLocation?.ArtifactLocation?.Resolve(run)?.Uri?.ToString() ?? "";
+                        uris[i] = AddString(indexRun, stringIndices, uri);
+                    }
+                }
+
+                indexRun.Uris.Add(uris);
+            }
+
+            indexRun.Count = indexRun.RuleIds.Count;
+
+            if (run.Results is DeferredList<Result> deferredResults)
+            {
+                indexRun.ResultStarts.AddRange(deferredResults.ItemPositions);
+            }
+
+            return indexRun;
+        }
+
+        private static int AddString(ResultIndexRun run, Dictionary<string, int> stringIndices, string value)
+        {
+            if (value == null) { return -1; }
+
+            if (!stringIndices.TryGetValue(value, out int index))
+            {
+                index = run.Strings.Count;
+                run.Strings.Add(value);
+                stringIndices[value] = index;
+            }
+
+            return index;
+        }
+    }
+}
@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System.Collections.Generic;
+
+namespace Microsoft.CodeAnalysis.Sarif.Query
+{
+    /// <summary>
+    ///  ResultIndexRow is the view of a single Result in a ResultIndexRun, used to evaluate
+    ///  query expressions against the index rather than against deserialized Results.
+    /// </summary>
+    public readonly struct ResultIndexRow
+    {
+        private readonly ResultIndexRun _run;
+        private readonly int _index;
+
+        public ResultIndexRow(ResultIndexRun run, int index)
+        {
+            _run = run;
+            _index = index;
+        }
+
+        public string RuleId => GetString(_run.RuleIds[_index]);
+
+        public FailureLevel Level => _run.Levels[_index];
+
+        public ResultKind Kind => _run.Kinds[_index];
+
+        public BaselineState BaselineState => _run.BaselineStates[_index];
+
+        public double Rank => _run.Ranks[_index];
+
+        public bool IsSuppressed => _run.IsSuppressed[_index];
+
+        public IEnumerable<string> Uris
+        {
+            get
+            {
+                int[] uris = _run.Uris[_index];
+                if (uris == null) { yield break; }
+
+                foreach (int uri in uris)
+                {
+                    yield return GetString(uri);
+                }
+            }
+        }
+
+        /// <summary>
+        ///  Return a row for each Result in the given ResultIndexRun.
+        /// </summary>
+        public static List<ResultIndexRow> ForRun(ResultIndexRun run)
+        {
+            var rows = new List<ResultIndexRow>(run.Count);
+
+            for (int i = 0; i < run.Count; ++i)
+            {
+                rows.Add(new ResultIndexRow(run, i));
+            }
+
+            return rows;
+        }
+
+        private string GetString(int index)
+        {
+            return index < 0 ? null : _run.Strings[index];
+        }
+    }
+}
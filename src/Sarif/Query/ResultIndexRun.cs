@@ -0,0 +1,67 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System.Collections.Generic;
+
+using Microsoft.CodeAnalysis.Sarif.Map;
+
+using Newtonsoft.Json;
+
+namespace Microsoft.CodeAnalysis.Sarif.Query
+{
+    /// <summary>
+    ///  ResultIndexRun holds the indexed values for the Results of one Run. Each property is a
+    ///  column with one entry per Result. Strings (rule ids and URIs) are stored once each in
+    ///  'Strings' and referred to by position, since the same few values repeat across Results.
+    /// </summary>
+    public class ResultIndexRun
+    {
+        /// <summary>
+        ///  The number of Results in the Run.
+        /// </summary>
+        [JsonProperty("count")]
+        public int Count { get; set; }
+
+        /// <summary>
+        ///  The distinct rule ids and URIs of the Results in the Run.
+        /// </summary>
+        [JsonProperty("strings")]
+        public List<string> Strings { get; set; } = new List<string>();
+
+        /// <summary>
+        ///  For each Result, the position in 'Strings' of the id of its rule.
+        /// </summary>
+        [JsonProperty("ruleIds")]
+        public List<int> RuleIds { get; set; } = new List<int>();
+
+        [JsonProperty("levels")]
+        public List<FailureLevel> Levels { get; set; } = new List<FailureLevel>();
+
+        [JsonProperty("kinds")]
+        public List<ResultKind> Kinds { get; set; } = new List<ResultKind>();
+
+        [JsonProperty("baselineStates")]
+        public List<BaselineState> BaselineStates { get; set; } = new List<BaselineState>();
+
+        [JsonProperty("ranks")]
+        public List<double> Ranks { get; set; } = new List<double>();
+
+        [JsonProperty("isSuppressed")]
+        public List<bool> IsSuppressed { get; set; } = new List<bool>();
+
+        /// <summary>
+        ///  For each Result, the positions in 'Strings' of the URI of each of its Locations.
+        ///  (null if the Result has no Locations).
+        /// </summary>
+        [JsonProperty("uris")]
+        public List<int[]> Uris { get; set; } = new List<int[]>();
+
+        /// <summary>
+        ///  For each Result, the absolute byte offset of its start (the '{') in the log.
+        ///  Values are delta-encoded in JSON, but have been decoded as absolute offsets here.
+        /// </summary>
+        [JsonProperty("resultStarts")]
+        [JsonConverter(typeof(LongArrayDeltaConverter))]
+        public List<long> ResultStarts { get; set; } = new List<long>();
+    }
+}
@@ -5,6 +5,7 @@ using System;
 using System.Collections;
 using System.Collections.Generic;
 using System.IO;
+using System.Threading.Tasks;
 
 using Newtonsoft.Json;
 
@@ -30,6 +31,11 @@ namespace Microsoft.CodeAnalysis.Sarif.Readers
     /// <typeparam name="T">Type of items in list</typeparam>
     public class DeferredList<T> : IList<T>, IDisposable
     {
+        public const int DefaultParallelBatchSize = 1024;
+
+        // Items closer together than this are skipped over by one reader rather than sought.
+        private const long MaximumSkipDistanceInBytes = 64 * 1024;
+
         private readonly JsonSerializer _jsonSerializer;
         private readonly Func<Stream> _streamProvider;
         private readonly long _start;
@@ -133,6 +139,18 @@ namespace Microsoft.CodeAnalysis.Sarif.Readers
             }
         }
 
+        /// <summary>
+        ///  The absolute byte offset of the start of each item in the stream.
+        /// </summary>
+        internal long[] ItemPositions
+        {
+            get
+            {
+                EnsurePositionsBuilt();
+                return _itemPositions;
+            }
+        }
+
         public int Count
         {
             get
@@ -235,6 +253,161 @@ namespace Microsoft.CodeAnalysis.Sarif.Readers
         }
         #endregion
 
+        /// <summary>
+        ///  Enumerate the items, deserializing them on several threads. Each worker reads a range of
+        ///  items with its own stream from the stream provider, seeking directly to the range using
+        ///  the item positions. Transformers are applied to each item, as for List[index].
+        /// </summary>
+        /// <remarks>
+        ///  At most two batches per worker are read ahead of the caller, so memory use is bounded
+        ///  by the batch size rather than the list size. The JsonSerializer and transformers must be
+        ///  safe to use from multiple threads, and the stream provider must return independent streams
+        ///  (as for a file path or MemoryMappedStreamProvider, but not JsonPositionedTextReader.FromStream).
+        /// </remarks>
+        /// <param name="maxDegreeOfParallelism">Maximum threads to use; zero or less for one per processor</param>
+        /// <param name="preserveOrder">True to return items in list order; false to return each batch as soon as it is read</param>
+        /// <param name="batchSize">Number of consecutive items each worker reads at a time</param>
+        /// <returns>IEnumerable of the items</returns>
+        public IEnumerable<T> EnumerateInParallel(int maxDegreeOfParallelism = 0, bool preserveOrder = true, int batchSize = DefaultParallelBatchSize)
+        {
+            if (batchSize <= 0) { throw new ArgumentOutOfRangeException(nameof(batchSize)); }
+
+            EnsurePositionsBuilt();
+
+            int workerCount = maxDegreeOfParallelism > 0 ? maxDegreeOfParallelism : Environment.ProcessorCount;
+            return ReadBatchesInParallel(workerCount, preserveOrder, batchSize);
+        }
+
+        private IEnumerable<T> ReadBatchesInParallel(int workerCount, bool preserveOrder, int batchSize)
+        {
+            int batchCount = (_itemPositions.Length + batchSize - 1) / batchSize;
+            int nextBatch = 0;
+            var pending = new List<Task<T[]>>();
+
+            while (nextBatch < batchCount || pending.Count > 0)
+            {
+                // Keep the workers busy, without reading too far ahead of the caller
+                while (pending.Count < workerCount * 2 && nextBatch < batchCount)
+                {
+                    int start = nextBatch * batchSize;
+                    int count = Math.Min(batchSize, _itemPositions.Length - start);
+                    pending.Add(Task.Run(() => ReadRange(start, count)));
+                    nextBatch++;
+                }
+
+                // Take the oldest batch if order matters, or whichever finishes first otherwise
+                Task<T[]> batch = preserveOrder ? pending[0] : Task.WhenAny(pending).GetAwaiter().GetResult();
+                pending.Remove(batch);
+
+                foreach (T item in batch.GetAwaiter().GetResult())
+                {
+                    yield return item;
+                }
+            }
+        }
+
+        private T[] ReadRange(int start, int count)
+        {
+            var items = new T[count];
+
+            using (Stream stream = _streamProvider())
+            {
+                stream.Seek(_itemPositions[start], SeekOrigin.Begin);
+
+                // The reader starts inside the array, so it sees the items as a sequence of root values.
+                using (var reader = new JsonInnerTextReader(new StreamReader(stream)) { SupportMultipleContent = true })
+                {
+                    // StartObject of first item
+                    reader.Read();
+
+                    for (int i = 0; i < count; ++i)
+                    {
+                        T item = _jsonSerializer.Deserialize<T>(reader);
+                        if (_transformer != null) { item = _transformer(item); }
+                        items[i] = item;
+
+                        // Read EndObject, next is StartObject of next item. The reader can't read
+                        // the array's ']' (there is no array as far as it knows), so stop at the last.
+                        if (i < count - 1) { reader.Read(); }
+                    }
+                }
+            }
+
+            return items;
+        }
+
+        /// <summary>
+        ///  Read the items at the specified indices, which must be in ascending order. Unlike
+        ///  List[index], which seeks and builds a new reader for every item, this reads forward
+        ///  through one stream, skipping over unrequested items that lie between nearby requested
+        ///  ones and seeking only across larger gaps. Transformers are applied, as for List[index].
+        /// </summary>
+        /// <param name="indices">Ascending indices of the items to read</param>
+        /// <returns>IEnumerable of the items, in the order of indices</returns>
+        internal IEnumerable<T> ReadItems(IEnumerable<int> indices)
+        {
+            if (indices == null) { throw new ArgumentNullException(nameof(indices)); }
+
+            EnsurePositionsBuilt();
+            return ReadItemsInOrder(indices);
+        }
+
+        private IEnumerable<T> ReadItemsInOrder(IEnumerable<int> indices)
+        {
+            using (Stream stream = _streamProvider())
+            {
+                JsonInnerTextReader reader = null;
+
+                // The index of the item whose EndObject the reader is positioned on.
+                int readerIndex = -1;
+
+                try
+                {
+                    foreach (int index in indices)
+                    {
+                        if (index < 0 || index >= _itemPositions.Length) { throw new ArgumentOutOfRangeException(nameof(indices)); }
+
+                        if (reader != null &&
+                            index > readerIndex &&
+                            _itemPositions[index] - _itemPositions[readerIndex] <= MaximumSkipDistanceInBytes)
+                        {
+                            // Skip the items in between; the reader never reads past a requested item,
+                            // as it can't read the array's ']' (there is no array as far as it knows).
+                            for (int skipped = readerIndex + 1; skipped < index; skipped++)
+                            {
+                                reader.Read();
+                                reader.Skip();
+                            }
+
+                            // StartObject of the item
+                            reader.Read();
+                        }
+                        else
+                        {
+                            reader?.Close();
+                            stream.Seek(_itemPositions[index], SeekOrigin.Begin);
+
+                            // The reader starts inside the array, so it sees the items as a sequence of root values.
+                            reader = new JsonInnerTextReader(new StreamReader(stream)) { CloseInput = false, SupportMultipleContent = true };
+
+                            // StartObject of the item
+                            reader.Read();
+                        }
+
+                        T item = _jsonSerializer.Deserialize<T>(reader);
+                        if (_transformer != null) { item = _transformer(item); }
+                        readerIndex = index;
+
+                        yield return item;
+                    }
+                }
+                finally
+                {
+                    reader?.Close();
+                }
+            }
+        }
+
         public IEnumerator<T> GetEnumerator()
         {
             return new JsonDeferredListEnumerator<T>(_jsonSerializer, _streamProvider, _start);
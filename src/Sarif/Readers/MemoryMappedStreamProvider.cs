@@ -0,0 +1,101 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.IO;
+using System.IO.MemoryMappedFiles;
+
+namespace Microsoft.CodeAnalysis.Sarif.Readers
+{
+    /// <summary>
+    ///  MemoryMappedStreamProvider maps a file into memory once and hands out streams over the
+    ///  single mapping. Pass OpenStream as the stream provider of a JsonPositionedTextReader so
+    ///  that every deferred collection read from it shares the mapping: indexing into a
+    ///  DeferredList or DeferredDictionary then reads directly from the mapped pages rather than
+    ///  opening the file and refilling a FileStream buffer on each access.
+    ///
+    ///  Usage:
+    ///    using (var mappedFile = new MemoryMappedStreamProvider(filePath))
+    ///    using (var reader = new JsonPositionedTextReader(mappedFile.OpenStream))
+    ///    {
+    ///        SarifLog log = serializer.Deserialize&lt;SarifLog&gt;(reader);
+    ///        ...
+    ///    }
+    /// </summary>
+    /// <remarks>
+    ///  Deferred collections keep the provider alive; dispose it only once they're no longer in use.
+    ///  Streams returned by OpenStream are cheap views and may be used concurrently.
+    ///
+    ///  The file is opened through an IFileSystem. If that doesn't open it as a file on disk (as a
+    ///  test double wouldn't), nothing is mapped, and OpenStream opens the file through it instead.
+    /// </remarks>
+    public sealed class MemoryMappedStreamProvider : IDisposable
+    {
+        private readonly IFileSystem _fileSystem;
+        private readonly string _filePath;
+        private MemoryMappedFile _file;
+        private MemoryMappedViewAccessor _view;
+
+        public MemoryMappedStreamProvider(string filePath)
+            : this(filePath, FileSystem.Instance)
+        {
+        }
+
+        public MemoryMappedStreamProvider(string filePath, IFileSystem fileSystem)
+        {
+            if (filePath == null) { throw new ArgumentNullException(nameof(filePath)); }
+            if (fileSystem == null) { throw new ArgumentNullException(nameof(fileSystem)); }
+
+            Stream stream = fileSystem.FileOpenRead(filePath);
+            Length = stream.Length;
+
+            if (!(stream is FileStream fileStream))
+            {
+                stream.Dispose();
+                _fileSystem = fileSystem;
+                _filePath = filePath;
+                return;
+            }
+
+            // Empty files can't be mapped; OpenStream returns empty streams for them.
+            if (Length == 0)
+            {
+                fileStream.Dispose();
+                return;
+            }
+
+#if NETFRAMEWORK
+            _file = MemoryMappedFile.CreateFromFile(fileStream, null, 0, MemoryMappedFileAccess.Read, null, HandleInheritability.None, leaveOpen: false);
+#else
+            _file = MemoryMappedFile.CreateFromFile(fileStream, null, 0, MemoryMappedFileAccess.Read, HandleInheritability.None, leaveOpen: false);
+#endif
+            _view = _file.CreateViewAccessor(0, 0, MemoryMappedFileAccess.Read);
+        }
+
+        /// <summary>
+        ///  The length, in bytes, of the mapped file.
+        /// </summary>
+        public long Length { get; }
+
+        /// <summary>
+        ///  Return a new, read-only stream over the whole mapped file.
+        /// </summary>
+        public Stream OpenStream()
+        {
+            if (_fileSystem != null) { return _fileSystem.FileOpenRead(_filePath); }
+            if (Length == 0) { return new MemoryStream(Array.Empty<byte>(), writable: false); }
+
+            MemoryMappedViewAccessor view = _view ?? throw new ObjectDisposedException(nameof(MemoryMappedStreamProvider));
+            return new UnmanagedMemoryStream(view.SafeMemoryMappedViewHandle, 0, Length, FileAccess.Read);
+        }
+
+        public void Dispose()
+        {
+            _view?.Dispose();
+            _view = null;
+
+            _file?.Dispose();
+            _file = null;
+        }
+    }
+}
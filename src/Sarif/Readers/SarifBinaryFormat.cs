@@ -0,0 +1,157 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections.Concurrent;
+using System.Globalization;
+using System.Linq;
+using System.Numerics;
+
+using Newtonsoft.Json.Serialization;
+
+namespace Microsoft.CodeAnalysis.Sarif.Readers
+{
+    /// <summary>
+    ///  Constants describing the binary SARIF format written by SarifBinaryWriter and read by SarifBinaryReader.
+    /// </summary>
+    /// <remarks>
+    ///  Layout (all values little-endian, strings length-prefixed UTF-8 as written by BinaryWriter):
+    ///    Header:     "SARB", int32 version
+    ///    Sections:   one after another, in any order
+    ///    Directory:  int32 count, then (string name, int64 offset, int64 length) per section
+    ///    Footer:     int64 offset of the directory
+    ///
+    ///  Sections:
+    ///    "log"                       the log as a record, with the Results of every Run omitted
+    ///    "strings"                   int32 count, then the distinct strings referenced by the records
+    ///    "runs"                      int32 run count, then int32 result count per Run (-1 if Run.Results is null)
+    ///    "runs/{i}/{column}"         a column of the Results of Run i (see the Column* constants)
+    ///
+    ///  Records write an object's serialized properties natively, in contract order, with no JSON:
+    ///  strings (and Uris, as serialized) as an int32 index into "strings" (-1 for null), enums and
+    ///  ints as int32, longs as int64, DateTimes as int64 (DateTime.ToBinary), Guids as 16 bytes,
+    ///  Nullables and objects behind a bool 'present' flag, lists and dictionaries as an int32 count
+    ///  (-1 for null) followed by the items (or key index and value pairs).
+    ///
+    ///  String columns intern their values: int32 distinct count, the distinct strings, then an
+    ///  int32 index per Result (-1 for null). These columns are self-contained, so reading one
+    ///  reads only that column's bytes. The "locations.uri" column is the exception: the Uris are
+    ///  already in "strings" (the Result records hold them), so it refers to them there.
+    /// </remarks>
+    internal static class SarifBinaryFormat
+    {
+        /// <summary>
+        ///  How a value of a given type is written in a record.
+        /// </summary>
+        public enum ValueKind
+        {
+            Unsupported,
+            String,
+            Uri,
+            Nullable,
+            Enum,
+            Boolean,
+            Int32,
+            Int64,
+            Double,
+            DateTime,
+            Guid,
+            BigInteger,
+            PropertyInfo,
+            Json,
+            List,
+            Dictionary,
+            Record,
+        }
+
+        public const string Magic = "SARB";
+        public const string FileExtension = ".sarifb";
+        public const int Version = 3;
+
+        public const string LogSection = "log";
+        public const string StringsSection = "strings";
+        public const string RunsSection = "runs";
+
+        // Each Result as a record, without the properties stored in the other columns; then its Message, without 'text' and 'id'.
+        public const string ColumnResults = "results";
+
+        // String columns.
+        public const string ColumnRuleId = "ruleId";
+        public const string ColumnMessageText = "message.text";
+        public const string ColumnMessageId = "message.id";
+
+        // Int32 columns.
+        public const string ColumnRuleIndex = "ruleIndex";
+        public const string ColumnKind = "kind";
+        public const string ColumnLevel = "level";
+        public const string ColumnBaselineState = "baselineState";
+
+        // Double column.
+        public const string ColumnRank = "rank";
+
+        // The 'uri' of each Location's artifactLocation: per Result an int32 Location count (-1 if
+        // Locations is null) followed by an index into "strings" per Location.
+        public const string ColumnLocationUris = "locations.uri";
+
+        // Properties which are not part of a record, because they're written elsewhere.
+        public static readonly string[] OmittedLogProperties = new[] { "runs" };
+        public static readonly string[] OmittedRunProperties = new[] { "results" };
+        public static readonly string[] OmittedResultProperties = new[] { "ruleId", "ruleIndex", "kind", "level", "baselineState", "rank", "message" };
+        public static readonly string[] OmittedMessageProperties = new[] { "text", "id" };
+
+        private static readonly DefaultContractResolver s_contractResolver = new DefaultContractResolver();
+        private static readonly ConcurrentDictionary<Type, JsonProperty[]> s_propertiesByType = new ConcurrentDictionary<Type, JsonProperty[]>();
+        private static readonly ConcurrentDictionary<Type, ValueKind> s_valueKindsByType = new ConcurrentDictionary<Type, ValueKind>();
+
+        public static string RunSection(int runIndex, string column)
+        {
+            return string.Format(CultureInfo.InvariantCulture, "runs/{0}/{1}", runIndex, column);
+        }
+
+        public static JsonContract GetContract(Type type)
+        {
+            return s_contractResolver.ResolveContract(type);
+        }
+
+        /// <summary>
+        ///  Return the properties of a type which are written to a record: those Json.NET serializes, in the same order.
+        /// </summary>
+        public static JsonProperty[] GetRecordProperties(Type type)
+        {
+            return s_propertiesByType.GetOrAdd(type, t =>
+                ((JsonObjectContract)GetContract(t)).Properties
+                    .Where(p => !p.Ignored && p.Readable && p.Writable)
+                    .ToArray());
+        }
+
+        public static ValueKind GetValueKind(Type type)
+        {
+            return s_valueKindsByType.GetOrAdd(type, t =>
+            {
+                if (t == typeof(string)) { return ValueKind.String; }
+                if (t == typeof(Uri)) { return ValueKind.Uri; }
+                if (Nullable.GetUnderlyingType(t) != null) { return ValueKind.Nullable; }
+                if (t.IsEnum) { return ValueKind.Enum; }
+                if (t == typeof(bool)) { return ValueKind.Boolean; }
+                if (t == typeof(int)) { return ValueKind.Int32; }
+                if (t == typeof(long)) { return ValueKind.Int64; }
+                if (t == typeof(double)) { return ValueKind.Double; }
+                if (t == typeof(DateTime)) { return ValueKind.DateTime; }
+                if (t == typeof(Guid)) { return ValueKind.Guid; }
+                if (t == typeof(BigInteger)) { return ValueKind.BigInteger; }
+                if (t == typeof(SerializedPropertyInfo)) { return ValueKind.PropertyInfo; }
+
+                // Untyped properties (such as ThreadFlow.InitialState) hold whatever Json.NET read, so they're kept as JSON.
+                if (t == typeof(object)) { return ValueKind.Json; }
+
+                switch (GetContract(t))
+                {
+                    case JsonArrayContract _: return ValueKind.List;
+                    case JsonDictionaryContract _: return ValueKind.Dictionary;
+                    case JsonObjectContract _: return ValueKind.Record;
+                    default: return ValueKind.Unsupported;
+                }
+            });
+        }
+    }
+}
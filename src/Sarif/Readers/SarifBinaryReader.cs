@@ -0,0 +1,411 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+using System.Linq;
+using System.Numerics;
+using System.Text;
+
+using Newtonsoft.Json.Linq;
+using Newtonsoft.Json.Serialization;
+
+namespace Microsoft.CodeAnalysis.Sarif.Readers
+{
+    /// <summary>
+    ///  SarifBinaryReader reads logs written by SarifBinaryWriter. ReadLog returns the whole
+    ///  SarifLog; the Read[Column] methods read a single column of the Results of a Run, for
+    ///  stages which need only a few Result properties.
+    /// </summary>
+    /// <remarks>
+    ///  The reader seeks within the stream for each read, so it must not be used from more than one thread at a time.
+    /// </remarks>
+    public sealed class SarifBinaryReader : IDisposable
+    {
+        private readonly Stream _stream;
+        private readonly BinaryReader _reader;
+        private readonly Dictionary<string, long> _sectionOffsets;
+        private readonly int[] _resultCounts;
+        private string[] _strings;
+
+        /// <summary>Initializes a new instance of the <see cref="SarifBinaryReader"/> class.</summary>
+        /// <param name="stream">The stream to read from. It must be seekable.</param>
+        /// <param name="leaveOpen">True to leave the stream open when the reader is disposed.</param>
+        public SarifBinaryReader(Stream stream, bool leaveOpen = false)
+        {
+            _stream = stream ?? throw new ArgumentNullException(nameof(stream));
+            if (!stream.CanSeek) { throw new ArgumentException("The stream should be seekable.", nameof(stream)); }
+
+            _reader = new BinaryReader(stream, Encoding.UTF8, leaveOpen);
+
+            _stream.Seek(0, SeekOrigin.Begin);
+            string magic = Encoding.ASCII.GetString(_reader.ReadBytes(SarifBinaryFormat.Magic.Length));
+            if (magic != SarifBinaryFormat.Magic) { throw new InvalidDataException("The stream does not contain a binary SARIF log."); }
+
+            int version = _reader.ReadInt32();
+            if (version != SarifBinaryFormat.Version) { throw new InvalidDataException($"Binary SARIF version {version} is not supported; only version {SarifBinaryFormat.Version} can be read."); }
+
+            _stream.Seek(-sizeof(long), SeekOrigin.End);
+            _stream.Seek(_reader.ReadInt64(), SeekOrigin.Begin);
+
+            int sectionCount = _reader.ReadInt32();
+            _sectionOffsets = new Dictionary<string, long>(sectionCount, StringComparer.Ordinal);
+            for (int i = 0; i < sectionCount; ++i)
+            {
+                string name = _reader.ReadString();
+                _sectionOffsets[name] = _reader.ReadInt64();
+                _reader.ReadInt64();
+            }
+
+            SeekToSection(SarifBinaryFormat.RunsSection);
+            _resultCounts = new int[_reader.ReadInt32()];
+            for (int i = 0; i < _resultCounts.Length; ++i)
+            {
+                _resultCounts[i] = _reader.ReadInt32();
+            }
+        }
+
+        /// <summary>
+        ///  Return whether a stream holds a binary SARIF log, leaving its position unchanged.
+        /// </summary>
+        /// <param name="stream">The stream to check. A stream which is not seekable is never treated as binary.</param>
+        public static bool IsBinaryLog(Stream stream)
+        {
+            if (stream?.CanSeek != true) { return false; }
+
+            long position = stream.Position;
+            var magic = new byte[SarifBinaryFormat.Magic.Length];
+            int length = stream.Read(magic, 0, magic.Length);
+            stream.Seek(position, SeekOrigin.Begin);
+
+            return length == magic.Length && Encoding.ASCII.GetString(magic) == SarifBinaryFormat.Magic;
+        }
+
+        /// <summary>
+        ///  The number of Runs in the log.
+        /// </summary>
+        public int RunCount => _resultCounts.Length;
+
+        /// <summary>
+        ///  Return the number of Results in a Run, or -1 if the Run's Results are null.
+        /// </summary>
+        public int GetResultCount(int runIndex) => _resultCounts[runIndex];
+
+        /// <summary>
+        ///  Read the whole log.
+        /// </summary>
+        public SarifLog ReadLog()
+        {
+            SarifLog log = ReadLogWithoutResults();
+
+            for (int runIndex = 0; runIndex < RunCount; ++runIndex)
+            {
+                if (log.Runs[runIndex] != null && _resultCounts[runIndex] >= 0)
+                {
+                    log.Runs[runIndex].Results = ReadResults(runIndex).ToList();
+                }
+            }
+
+            return log;
+        }
+
+        /// <summary>
+        ///  Read the log with the Results of every Run left null.
+        /// </summary>
+        public SarifLog ReadLogWithoutResults()
+        {
+            ReadStrings();
+            SeekToSection(SarifBinaryFormat.LogSection);
+
+            var log = (SarifLog)ReadRecord(typeof(SarifLog), SarifBinaryFormat.OmittedLogProperties);
+
+            int runCount = _reader.ReadInt32();
+            if (runCount >= 0)
+            {
+                log.Runs = new List<Run>(runCount);
+                for (int i = 0; i < runCount; ++i)
+                {
+                    log.Runs.Add((Run)ReadRecord(typeof(Run), SarifBinaryFormat.OmittedRunProperties));
+                }
+            }
+
+            return log;
+        }
+
+        /// <summary>
+        ///  Read the Results of a Run, one at a time.
+        /// </summary>
+        public IEnumerable<Result> ReadResults(int runIndex)
+        {
+            int count = _resultCounts[runIndex];
+            if (count <= 0) { return Enumerable.Empty<Result>(); }
+
+            return ReadResults(runIndex, count);
+        }
+
+        public IList<string> ReadRuleIds(int runIndex) => ReadStringColumn(runIndex, SarifBinaryFormat.ColumnRuleId);
+
+        public IList<string> ReadMessageTexts(int runIndex) => ReadStringColumn(runIndex, SarifBinaryFormat.ColumnMessageText);
+
+        public IList<string> ReadMessageIds(int runIndex) => ReadStringColumn(runIndex, SarifBinaryFormat.ColumnMessageId);
+
+        public IList<int> ReadRuleIndices(int runIndex) => ReadInt32Column(runIndex, SarifBinaryFormat.ColumnRuleIndex);
+
+        public IList<ResultKind> ReadKinds(int runIndex) => ReadInt32Column(runIndex, SarifBinaryFormat.ColumnKind).Select(k => (ResultKind)k).ToArray();
+
+        public IList<FailureLevel> ReadLevels(int runIndex) => ReadInt32Column(runIndex, SarifBinaryFormat.ColumnLevel).Select(l => (FailureLevel)l).ToArray();
+
+        public IList<BaselineState> ReadBaselineStates(int runIndex) => ReadInt32Column(runIndex, SarifBinaryFormat.ColumnBaselineState).Select(b => (BaselineState)b).ToArray();
+
+        public IList<double> ReadRanks(int runIndex)
+        {
+            var ranks = new double[Math.Max(0, _resultCounts[runIndex])];
+            if (ranks.Length == 0) { return ranks; }
+
+            SeekToSection(SarifBinaryFormat.RunSection(runIndex, SarifBinaryFormat.ColumnRank));
+            for (int i = 0; i < ranks.Length; ++i)
+            {
+                ranks[i] = _reader.ReadDouble();
+            }
+
+            return ranks;
+        }
+
+        /// <summary>
+        ///  Read the artifact URI of each Location of each Result in a Run, as written in JSON.
+        ///  The list for a Result is null if its Locations are null.
+        /// </summary>
+        public IList<IList<string>> ReadLocationUris(int runIndex)
+        {
+            var uris = new IList<string>[Math.Max(0, _resultCounts[runIndex])];
+            if (uris.Length == 0) { return uris; }
+
+            // The column refers to the log's strings, which the Result records share.
+            ReadStrings();
+            SeekToSection(SarifBinaryFormat.RunSection(runIndex, SarifBinaryFormat.ColumnLocationUris));
+
+            for (int i = 0; i < uris.Length; ++i)
+            {
+                int locationCount = _reader.ReadInt32();
+                if (locationCount < 0) { continue; }
+
+                var resultUris = new string[locationCount];
+                for (int j = 0; j < locationCount; ++j)
+                {
+                    resultUris[j] = ReadString();
+                }
+
+                uris[i] = resultUris;
+            }
+
+            return uris;
+        }
+
+        public void Dispose()
+        {
+            _reader.Dispose();
+        }
+
+        private IEnumerable<Result> ReadResults(int runIndex, int count)
+        {
+            // Read the (small) columns up front, then each Result's record as it's requested.
+            IList<string> ruleIds = ReadRuleIds(runIndex);
+            IList<string> messageTexts = ReadMessageTexts(runIndex);
+            IList<string> messageIds = ReadMessageIds(runIndex);
+            IList<int> ruleIndices = ReadRuleIndices(runIndex);
+            IList<ResultKind> kinds = ReadKinds(runIndex);
+            IList<FailureLevel> levels = ReadLevels(runIndex);
+            IList<BaselineState> baselineStates = ReadBaselineStates(runIndex);
+            IList<double> ranks = ReadRanks(runIndex);
+            ReadStrings();
+
+            // Track our position in the records, since other reads may seek in between.
+            long position = _sectionOffsets[SarifBinaryFormat.RunSection(runIndex, SarifBinaryFormat.ColumnResults)];
+
+            for (int i = 0; i < count; ++i)
+            {
+                _stream.Seek(position, SeekOrigin.Begin);
+                var result = (Result)ReadRecord(typeof(Result), SarifBinaryFormat.OmittedResultProperties);
+                var message = (Message)ReadRecord(typeof(Message), SarifBinaryFormat.OmittedMessageProperties);
+                position = _stream.Position;
+
+                if (result == null)
+                {
+                    yield return null;
+                    continue;
+                }
+
+                result.RuleId = ruleIds[i];
+                result.RuleIndex = ruleIndices[i];
+                result.Kind = kinds[i];
+                result.Level = levels[i];
+                result.BaselineState = baselineStates[i];
+                result.Rank = ranks[i];
+                result.Message = message;
+
+                if (message != null)
+                {
+                    message.Text = messageTexts[i];
+                    message.Id = messageIds[i];
+                }
+
+                yield return result;
+            }
+        }
+
+        /// <summary>
+        ///  Read a record written by SarifBinaryWriter.WriteRecord. Omitted properties keep the values the constructor gives them.
+        /// </summary>
+        private object ReadRecord(Type type, IList<string> omittedProperties = null)
+        {
+            if (!_reader.ReadBoolean()) { return null; }
+
+            object value = SarifBinaryFormat.GetContract(type).DefaultCreator();
+
+            foreach (JsonProperty property in SarifBinaryFormat.GetRecordProperties(type))
+            {
+                if (omittedProperties?.Contains(property.PropertyName) == true) { continue; }
+
+                property.ValueProvider.SetValue(value, ReadValue(property.PropertyType));
+            }
+
+            return value;
+        }
+
+        private object ReadValue(Type type)
+        {
+            switch (SarifBinaryFormat.GetValueKind(type))
+            {
+                case SarifBinaryFormat.ValueKind.String:
+                    return ReadString();
+
+                case SarifBinaryFormat.ValueKind.Uri:
+                    string uri = ReadString();
+                    return uri == null ? null : new Uri(uri, UriKind.RelativeOrAbsolute);
+
+                case SarifBinaryFormat.ValueKind.Nullable:
+                    return _reader.ReadBoolean() ? ReadValue(Nullable.GetUnderlyingType(type)) : null;
+
+                case SarifBinaryFormat.ValueKind.Enum: return Enum.ToObject(type, _reader.ReadInt32());
+                case SarifBinaryFormat.ValueKind.Boolean: return _reader.ReadBoolean();
+                case SarifBinaryFormat.ValueKind.Int32: return _reader.ReadInt32();
+                case SarifBinaryFormat.ValueKind.Int64: return _reader.ReadInt64();
+                case SarifBinaryFormat.ValueKind.Double: return _reader.ReadDouble();
+                case SarifBinaryFormat.ValueKind.DateTime: return DateTime.FromBinary(_reader.ReadInt64());
+                case SarifBinaryFormat.ValueKind.Guid: return new Guid(_reader.ReadBytes(16));
+                case SarifBinaryFormat.ValueKind.BigInteger: return BigInteger.Parse(ReadString(), CultureInfo.InvariantCulture);
+
+                case SarifBinaryFormat.ValueKind.PropertyInfo:
+                    string serializedValue = ReadString();
+                    bool isString = _reader.ReadBoolean();
+                    return serializedValue == null ? null : new SerializedPropertyInfo(serializedValue, isString);
+
+                case SarifBinaryFormat.ValueKind.Json:
+                    string json = ReadString();
+                    return json == null ? null : JToken.Parse(json);
+
+                case SarifBinaryFormat.ValueKind.List:
+                {
+                    int count = _reader.ReadInt32();
+                    if (count < 0) { return null; }
+
+                    var contract = (JsonArrayContract)SarifBinaryFormat.GetContract(type);
+                    var list = (IList)contract.DefaultCreator();
+                    for (int i = 0; i < count; ++i)
+                    {
+                        list.Add(ReadValue(contract.CollectionItemType));
+                    }
+
+                    return list;
+                }
+
+                case SarifBinaryFormat.ValueKind.Dictionary:
+                {
+                    int count = _reader.ReadInt32();
+                    if (count < 0) { return null; }
+
+                    var contract = (JsonDictionaryContract)SarifBinaryFormat.GetContract(type);
+                    var dictionary = (IDictionary)contract.DefaultCreator();
+                    for (int i = 0; i < count; ++i)
+                    {
+                        string key = ReadString();
+                        dictionary[key] = ReadValue(contract.DictionaryValueType);
+                    }
+
+                    return dictionary;
+                }
+
+                case SarifBinaryFormat.ValueKind.Record:
+                    return ReadRecord(type);
+            }
+
+            throw new NotSupportedException($"{nameof(SarifBinaryReader)} cannot read values of type '{type}'.");
+        }
+
+        private string ReadString()
+        {
+            int index = _reader.ReadInt32();
+            return index < 0 ? null : _strings[index];
+        }
+
+        private void ReadStrings()
+        {
+            if (_strings != null) { return; }
+
+            SeekToSection(SarifBinaryFormat.StringsSection);
+            _strings = ReadStringValues();
+        }
+
+        private IList<string> ReadStringColumn(int runIndex, string column)
+        {
+            var strings = new string[Math.Max(0, _resultCounts[runIndex])];
+            if (strings.Length == 0) { return strings; }
+
+            SeekToSection(SarifBinaryFormat.RunSection(runIndex, column));
+            string[] values = ReadStringValues();
+
+            for (int i = 0; i < strings.Length; ++i)
+            {
+                int index = _reader.ReadInt32();
+                strings[i] = index < 0 ? null : values[index];
+            }
+
+            return strings;
+        }
+
+        private int[] ReadInt32Column(int runIndex, string column)
+        {
+            var values = new int[Math.Max(0, _resultCounts[runIndex])];
+            if (values.Length == 0) { return values; }
+
+            SeekToSection(SarifBinaryFormat.RunSection(runIndex, column));
+            for (int i = 0; i < values.Length; ++i)
+            {
+                values[i] = _reader.ReadInt32();
+            }
+
+            return values;
+        }
+
+        private string[] ReadStringValues()
+        {
+            var values = new string[_reader.ReadInt32()];
+            for (int i = 0; i < values.Length; ++i)
+            {
+                values[i] = _reader.ReadString();
+            }
+
+            return values;
+        }
+
+        private void SeekToSection(string name)
+        {
+            if (!_sectionOffsets.TryGetValue(name, out long offset)) { throw new InvalidDataException($"Binary SARIF log has no '{name}' section."); }
+
+            _stream.Seek(offset, SeekOrigin.Begin);
+        }
+    }
+}
@@ -45,24 +45,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Readers
             var uri = value as Uri;
             if (uri != null && !string.IsNullOrWhiteSpace(uri.OriginalString))
             {
-                // Absolute file-scheme URIs need special treatment. OriginalString might be a file
-                // system path such as "C:\test\file.c", which is not a valid URI. In that case we
-                // must instead serialize "file:///C:/test/file.c", which we can get from AbsoluteUri.
-                //
-                // However, if OriginalString starts with "file:", we do want to serialize it. It
-                // might (for example) be "file:///C:/dir1/dir2/..", in which case AbsolutePath would
-                // be "file:///C:/dir1". We don't want to lose the dot-dot segment when round-tripping
-                // the URI, if for no other reason than that we might want to run the SARIF validator
-                // on the result of the round trip, and we don't want to lose the warning that you
-                // shouldn't use dot-dot segments!
-                bool useAbsoluteUri =
-                    uri.IsAbsoluteUri &&
-                    uri.Scheme.Equals(UriUtilities.FileScheme, StringComparison.Ordinal) &&
-                    !uri.OriginalString.StartsWith(UriUtilities.FileScheme.WithColon(), StringComparison.Ordinal);
-
-                string serializedValue = useAbsoluteUri ? uri.AbsoluteUri : uri.OriginalString;
-
-                writer.WriteValue(serializedValue);
+                writer.WriteValue(GetSerializedValue(uri));
                 return;
             }
 
@@ -75,5 +58,28 @@ namespace Microsoft.CodeAnalysis.Sarif.Readers
 
             serializer.Serialize(writer, value, typeof(IDictionary<string, Uri>));
         }
+
+        /// <summary>
+        ///  Return the string a Uri is written as in JSON.
+        /// </summary>
+        internal static string GetSerializedValue(Uri uri)
+        {
+            // Absolute file-scheme URIs need special treatment. OriginalString might be a file
+            // system path such as "C:\test\file.c", which is not a valid URI. In that case we
+            // must instead serialize "file:///C:/test/file.c", which we can get from AbsoluteUri.
+            //
+            // However, if OriginalString starts with "file:", we do want to serialize it. It
+            // might (for example) be "file:///C:/dir1/dir2/..", in which case AbsolutePath would
+            // be "file:///C:/dir1". We don't want to lose the dot-dot segment when round-tripping
+            // the URI, if for no other reason than that we might want to run the SARIF validator
+            // on the result of the round trip, and we don't want to lose the warning that you
+            // shouldn't use dot-dot segments!
+            bool useAbsoluteUri =
+                uri.IsAbsoluteUri &&
+                uri.Scheme.Equals(UriUtilities.FileScheme, StringComparison.Ordinal) &&
+                !uri.OriginalString.StartsWith(UriUtilities.FileScheme.WithColon(), StringComparison.Ordinal);
+
+            return useAbsoluteUri ? uri.AbsoluteUri : uri.OriginalString;
+        }
     }
 }
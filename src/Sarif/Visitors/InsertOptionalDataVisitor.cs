@@ -28,6 +28,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Visitors
         private int _ruleIndex = -1;
         private readonly IEnumerable<string> _insertProperties = insertProperties ?? new List<string>();
         private readonly Dictionary<string, Dictionary<int, string>> _rollingHashesByPath = new Dictionary<string, Dictionary<int, string>>();
+        private readonly HashSet<PhysicalLocation> _regionsPopulated = new HashSet<PhysicalLocation>();
 
         private const string Name = nameof(Name);
         private const string Email = nameof(Email);
@@ -53,6 +54,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Visitors
             _gitHelper = new GitHelper(_fileSystem, processRunner);
             _repoRootUris = new HashSet<Uri>();
             _rollingHashesByPath.Clear();
+            _regionsPopulated.Clear();
 
             if (originalUriBaseIds != null)
             {
@@ -76,7 +78,18 @@ namespace Microsoft.CodeAnalysis.Sarif.Visitors
                 visitor.VisitRun(node);
             }
 
+            if (dataToInsert.HasFlag(OptionallyEmittedData.RollingHashPartialFingerprints) && FileRegionsCache != null)
+            {
+                PrecomputeRollingHashes(node);
+            }
+
+            if (NeedsTextRegionProperties() && FileRegionsCache != null)
+            {
+                PopulateTextRegionsByArtifact(node);
+            }
+
             Run visited = base.VisitRun(node);
+            _regionsPopulated.Clear();
 
             // After all the ArtifactLocations have been visited,
             if (_run.VersionControlProvenance == null && dataToInsert.HasFlag(OptionallyEmittedData.VersionControlDetails))
@@ -89,41 +102,123 @@ namespace Microsoft.CodeAnalysis.Sarif.Visitors
 
         public override PhysicalLocation VisitPhysicalLocation(PhysicalLocation node)
         {
-            if (node.Region == null || node.Region.IsBinaryRegion)
+            if (node.Region == null || node.Region.IsBinaryRegion || _regionsPopulated.Contains(node))
             {
                 goto Exit;
             }
 
-            bool insertRegionSnippets = dataToInsert.HasFlag(OptionallyEmittedData.RegionSnippets);
-            bool overwriteExistingData = dataToInsert.HasFlag(OptionallyEmittedData.OverwriteExistingData);
-            bool insertContextCodeSnippets = dataToInsert.HasFlag(OptionallyEmittedData.ContextRegionSnippets);
-            bool populateRegionProperties = dataToInsert.HasFlag(OptionallyEmittedData.ComprehensiveRegionProperties);
-
-            if (insertRegionSnippets || populateRegionProperties || insertContextCodeSnippets)
+            if (NeedsTextRegionProperties())
             {
                 Uri resolvedUri = GetResolvedArtifactLocationUri(node.ArtifactLocation);
 
+                bool insertRegionSnippets = dataToInsert.HasFlag(OptionallyEmittedData.RegionSnippets);
+                bool overwriteExistingData = dataToInsert.HasFlag(OptionallyEmittedData.OverwriteExistingData);
+
                 Region expandedRegion = FileRegionsCache.PopulateTextRegionProperties(node.Region, resolvedUri, populateSnippet: insertRegionSnippets, fileText: null, overwriteExistingData: overwriteExistingData);
 
-                ArtifactContent originalSnippet = node.Region.Snippet;
+                Region contextRegion = NeedsContextRegion(node)
+                    ? FileRegionsCache.ConstructMultilineContextSnippet(expandedRegion, resolvedUri)
+                    : null;
+
+                ApplyTextRegionProperties(node, expandedRegion, contextRegion);
+            }
+
+        Exit:
+            return base.VisitPhysicalLocation(node);
+        }
+
+        private bool NeedsTextRegionProperties()
+        {
+            return dataToInsert.HasFlag(OptionallyEmittedData.RegionSnippets) ||
+                   dataToInsert.HasFlag(OptionallyEmittedData.ComprehensiveRegionProperties) ||
+                   dataToInsert.HasFlag(OptionallyEmittedData.ContextRegionSnippets);
+        }
+
+        private bool NeedsContextRegion(PhysicalLocation node)
+        {
+            return dataToInsert.HasFlag(OptionallyEmittedData.ContextRegionSnippets) &&
+                   (node.ContextRegion == null || dataToInsert.HasFlag(OptionallyEmittedData.OverwriteExistingData));
+        }
+
+        private void ApplyTextRegionProperties(PhysicalLocation node, Region expandedRegion, Region contextRegion)
+        {
+            bool needsContextRegion = NeedsContextRegion(node);
+            bool overwriteExistingData = dataToInsert.HasFlag(OptionallyEmittedData.OverwriteExistingData);
+
+            ArtifactContent originalSnippet = node.Region.Snippet;
+
+            if (dataToInsert.HasFlag(OptionallyEmittedData.ComprehensiveRegionProperties))
+            {
+                node.Region = expandedRegion;
+            }
+
+            node.Region.Snippet = originalSnippet == null || overwriteExistingData
+                ? expandedRegion.Snippet
+                : originalSnippet;
+
+            if (needsContextRegion)
+            {
+                node.ContextRegion = contextRegion;
+            }
+        }
+
+        // Populates the regions of the run's physical locations one artifact at a time, so that
+        // each artifact's newline index and text are retrieved once rather than once per location.
+        // Locations whose artifact can't be resolved are left for VisitPhysicalLocation.
+        private void PopulateTextRegionsByArtifact(Run run)
+        {
+            var collector = new PhysicalLocationCollector();
+            collector.VisitRun(run);
+
+            var locationsByPath = new Dictionary<string, List<PhysicalLocation>>();
+            var urisByPath = new Dictionary<string, Uri>();
+
+            foreach (PhysicalLocation location in collector.PhysicalLocations)
+            {
+                if (location.Region == null || location.Region.IsBinaryRegion || location.ArtifactLocation == null) { continue; }
+
+                Uri resolvedUri = GetResolvedArtifactLocationUri(location.ArtifactLocation);
+                if (resolvedUri == null) { continue; }
 
-                if (populateRegionProperties)
+                string path = resolvedUri.GetFilePath();
+                if (!locationsByPath.TryGetValue(path, out List<PhysicalLocation> locations))
                 {
-                    node.Region = expandedRegion;
+                    locations = new List<PhysicalLocation>();
+                    locationsByPath[path] = locations;
+                    urisByPath[path] = resolvedUri;
                 }
 
-                node.Region.Snippet = originalSnippet == null || overwriteExistingData
-                    ? expandedRegion.Snippet
-                    : originalSnippet;
+                locations.Add(location);
+            }
+
+            bool insertRegionSnippets = dataToInsert.HasFlag(OptionallyEmittedData.RegionSnippets);
+            bool overwriteExistingData = dataToInsert.HasFlag(OptionallyEmittedData.OverwriteExistingData);
+
+            foreach (KeyValuePair<string, List<PhysicalLocation>> pair in locationsByPath)
+            {
+                List<PhysicalLocation> locations = pair.Value;
+                Uri resolvedUri = urisByPath[pair.Key];
 
-                if (insertContextCodeSnippets && (node.ContextRegion == null || overwriteExistingData))
+                IList<Region> expandedRegions = FileRegionsCache.PopulateTextRegionPropertiesForArtifact(
+                    locations.Select(location => location.Region).ToList(),
+                    resolvedUri,
+                    populateSnippet: insertRegionSnippets,
+                    overwriteExistingData: overwriteExistingData);
+
+                IList<Region> contextRegions = null;
+                if (dataToInsert.HasFlag(OptionallyEmittedData.ContextRegionSnippets))
                 {
-                    node.ContextRegion = FileRegionsCache.ConstructMultilineContextSnippet(expandedRegion, resolvedUri);
+                    contextRegions = FileRegionsCache.ConstructMultilineContextSnippetsForArtifact(
+                        locations.Select((location, i) => NeedsContextRegion(location) ? expandedRegions[i] : null).ToList(),
+                        resolvedUri);
                 }
-            }
 
-        Exit:
-            return base.VisitPhysicalLocation(node);
+                for (int i = 0; i < locations.Count; i++)
+                {
+                    ApplyTextRegionProperties(locations[i], expandedRegions[i], contextRegions?[i]);
+                    _regionsPopulated.Add(locations[i]);
+                }
+            }
         }
 
         public override Artifact VisitArtifact(Artifact node)
@@ -259,10 +354,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Visitors
                 }
             }
 
-            if (dataToInsert.HasFlag(OptionallyEmittedData.RollingHashPartialFingerprints) &&
-                (node.PartialFingerprints == null ||
-                 !node.PartialFingerprints.ContainsKey(PrimaryLocationLineHash) ||
-                 dataToInsert.HasFlag(OptionallyEmittedData.OverwriteExistingData)))
+            if (NeedsRollingHashPartialFingerprint(node))
             {
                 Location primaryLocation = node.Locations?.FirstOrDefault();
                 PhysicalLocation physicalLocation = primaryLocation?.PhysicalLocation;
@@ -451,6 +543,40 @@ namespace Microsoft.CodeAnalysis.Sarif.Visitors
             return resolvedUri;
         }
 
+        private bool NeedsRollingHashPartialFingerprint(Result node)
+        {
+            return dataToInsert.HasFlag(OptionallyEmittedData.RollingHashPartialFingerprints) &&
+                   (node.PartialFingerprints == null ||
+                    !node.PartialFingerprints.ContainsKey(PrimaryLocationLineHash) ||
+                    dataToInsert.HasFlag(OptionallyEmittedData.OverwriteExistingData));
+        }
+
+        // Reads and hashes each file that the run's results need a rolling hash from once, in
+        // parallel, so that fingerprinting the results as they're visited is only a lookup.
+        private void PrecomputeRollingHashes(Run run)
+        {
+            if (run.Results == null) { return; }
+
+            var uris = new List<Uri>();
+
+            foreach (Result result in run.Results)
+            {
+                ArtifactLocation artifactLocation = result?.Locations?.FirstOrDefault()?.PhysicalLocation?.ArtifactLocation;
+                if (artifactLocation == null || !NeedsRollingHashPartialFingerprint(result)) { continue; }
+
+                Uri resolvedUri = GetResolvedArtifactLocationUri(artifactLocation);
+                if (resolvedUri != null && resolvedUri.IsAbsoluteUri)
+                {
+                    uris.Add(resolvedUri);
+                }
+            }
+
+            foreach (KeyValuePair<string, Dictionary<int, string>> pair in FileRegionsCache.GetRollingHashes(uris))
+            {
+                _rollingHashesByPath[pair.Key] = pair.Value;
+            }
+        }
+
         // Computes the CodeQL rolling line hashes for the file at the supplied URI, memoizing the
         // result per file so a file shared by many results is read and hashed only once per run.
         private Dictionary<int, string> GetRollingHashes(Uri resolvedUri)
@@ -483,5 +609,16 @@ namespace Microsoft.CodeAnalysis.Sarif.Visitors
             => i == 0
             ? RepoRootUriBaseIdStem
             : $"{RepoRootUriBaseIdStem}_{i + 1}";
+
+        private class PhysicalLocationCollector : SarifRewritingVisitor
+        {
+            public List<PhysicalLocation> PhysicalLocations { get; } = new List<PhysicalLocation>();
+
+            public override PhysicalLocation VisitPhysicalLocation(PhysicalLocation node)
+            {
+                PhysicalLocations.Add(node);
+                return base.VisitPhysicalLocation(node);
+            }
+        }
     }
 }
@@ -37,10 +37,22 @@ namespace Microsoft.CodeAnalysis.Sarif.Visitors
         private Dictionary<OrderSensitiveValueComparisonList<Artifact>, int> ArtifactToIndex { get; }
         private Dictionary<Run, int> InvocationBaseIndexByRun { get; }
 
+        private readonly bool _retainResults;
+
         public Run CurrentRun { get; set; }
 
-        public RunMergingVisitor()
+        public RunMergingVisitor() : this(retainResults: true)
         {
+        }
+
+        /// <param name="retainResults">
+        /// False to only remap the visited Results, leaving run.results empty in PopulateWithMerged.
+        /// Used by callers which write each Result out as it is visited.
+        /// </param>
+        public RunMergingVisitor(bool retainResults)
+        {
+            _retainResults = retainResults;
+
             Results = new List<Result>();
             Artifacts = new List<Artifact>();
             LogicalLocations = new List<LogicalLocation>();
@@ -117,7 +129,12 @@ namespace Microsoft.CodeAnalysis.Sarif.Visitors
             RemapInvocationIndex(node);
 
             Result result = base.VisitResult(node);
-            Results.Add(result);
+
+            if (_retainResults)
+            {
+                Results.Add(result);
+            }
+
             return result;
         }
 
@@ -12,6 +12,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Writers
     /// Data cached this way can subsequently be replayed into other IAnalysisLogger
     /// instances. The driver framework uses this mechanism to merge results
     /// produced by a multi-threaded analysis into a single output file.
+    /// Results and notifications may be logged from multiple threads at once.
     /// </summary>
     public class CachingLogger : BaseLogger, IAnalysisLogger
     {
@@ -36,6 +37,9 @@ namespace Microsoft.CodeAnalysis.Sarif.Writers
 
         private readonly SemaphoreSlim _semaphore;
 
+        // Serializes writes to Results, ConfigurationNotifications and ToolNotifications.
+        private readonly object _syncRoot = new object();
+
         public FileRegionsCache FileRegionsCache { get; set; }
 
         public void AnalysisStarted()
@@ -85,13 +89,10 @@ namespace Microsoft.CodeAnalysis.Sarif.Writers
                 throw new ArgumentException($"rule.Id is not equal to result.RuleId ({rule.Id} != {result.RuleId})");
             }
 
-            Results ??= new Dictionary<ReportingDescriptor, IList<Tuple<Result, int?>>>();
-
-            if (!Results.TryGetValue(rule, out IList<Tuple<Result, int?>> results))
+            lock (_syncRoot)
             {
-                results = Results[rule] = new List<Tuple<Result, int?>>();
+                AddResult(rule, new Tuple<Result, int?>(result, extensionIndex));
             }
-            results.Add(new Tuple<Result, int?>(result, extensionIndex));
         }
 
         public void LogConfigurationNotification(Notification notification)
@@ -101,8 +102,11 @@ namespace Microsoft.CodeAnalysis.Sarif.Writers
                 return;
             }
 
-            ConfigurationNotifications ??= new List<Notification>();
-            ConfigurationNotifications.Add(notification);
+            lock (_syncRoot)
+            {
+                ConfigurationNotifications ??= new List<Notification>();
+                ConfigurationNotifications.Add(notification);
+            }
         }
 
         public void LogToolNotification(Notification notification, ReportingDescriptor associatedRule)
@@ -112,8 +116,66 @@ namespace Microsoft.CodeAnalysis.Sarif.Writers
                 return;
             }
 
-            ToolNotifications ??= new List<Tuple<Notification, ReportingDescriptor>>();
-            ToolNotifications.Add(new Tuple<Notification, ReportingDescriptor>(notification, associatedRule));
+            lock (_syncRoot)
+            {
+                ToolNotifications ??= new List<Tuple<Notification, ReportingDescriptor>>();
+                ToolNotifications.Add(new Tuple<Notification, ReportingDescriptor>(notification, associatedRule));
+            }
+        }
+
+        /// <summary>
+        /// Appends everything cached by another logger (which must filter what it
+        /// caches as this one does) to the data cached by this one.
+        /// </summary>
+        internal void Append(CachingLogger other)
+        {
+            if (other == null)
+            {
+                throw new ArgumentNullException(nameof(other));
+            }
+
+            lock (_syncRoot)
+            {
+                if (other.Results != null)
+                {
+                    foreach (KeyValuePair<ReportingDescriptor, IList<Tuple<Result, int?>>> kv in other.Results)
+                    {
+                        foreach (Tuple<Result, int?> tuple in kv.Value)
+                        {
+                            AddResult(kv.Key, tuple);
+                        }
+                    }
+                }
+
+                if (other.ConfigurationNotifications != null)
+                {
+                    ConfigurationNotifications ??= new List<Notification>();
+                    foreach (Notification notification in other.ConfigurationNotifications)
+                    {
+                        ConfigurationNotifications.Add(notification);
+                    }
+                }
+
+                if (other.ToolNotifications != null)
+                {
+                    ToolNotifications ??= new List<Tuple<Notification, ReportingDescriptor>>();
+                    foreach (Tuple<Notification, ReportingDescriptor> tuple in other.ToolNotifications)
+                    {
+                        ToolNotifications.Add(tuple);
+                    }
+                }
+            }
+        }
+
+        private void AddResult(ReportingDescriptor rule, Tuple<Result, int?> tuple)
+        {
+            Results ??= new Dictionary<ReportingDescriptor, IList<Tuple<Result, int?>>>();
+
+            if (!Results.TryGetValue(rule, out IList<Tuple<Result, int?>> results))
+            {
+                results = Results[rule] = new List<Tuple<Result, int?>>();
+            }
+            results.Add(tuple);
         }
     }
 }
@@ -286,10 +286,55 @@ namespace Microsoft.CodeAnalysis.Sarif.Writers
             _jsonWriter.Flush();
         }
 
+        /// <summary>
+        /// Completes the run currently being written and begins another in the same log, so
+        /// that a log with several runs can be streamed. If the log hasn't been initialized
+        /// yet, this is equivalent to <see cref="Initialize(Run)"/>.
+        /// </summary>
+        /// <param name="run">
+        /// The run to begin. Properties not explicitly written are emitted from this run
+        /// when it is completed.
+        /// </param>
+        public void InitializeNextRun(Run run)
+        {
+            if (run == null)
+            {
+                throw new ArgumentNullException(nameof(run));
+            }
+
+            if (_writeConditions == Conditions.None)
+            {
+                Initialize(run);
+                return;
+            }
+
+            EnsureStateNotAlreadySet(Conditions.Disposed | Conditions.RunCompleted);
+
+            WriteRunRemainder();
+
+            _run = run;
+            _writeConditions = Conditions.RunInitialized;
+
+            _jsonWriter.WriteStartObject(); // Begin: run
+            _jsonWriter.Flush();
+        }
+
         public void CompleteRun()
         {
             if (_writeConditions.HasFlag(Conditions.RunCompleted)) { return; }
 
+            WriteRunRemainder();
+
+            // Log complete. Write the end object.
+            _jsonWriter.WriteEndArray();  // End: runs
+            _jsonWriter.WriteEndObject(); // End: sarifLog
+
+            _writeConditions |= Conditions.RunCompleted;
+            _jsonWriter.Flush();
+        }
+
+        private void WriteRunRemainder()
+        {
             if ((_writeConditions & Conditions.ResultsInitialized) == Conditions.ResultsInitialized &&
                 (_writeConditions & Conditions.ResultsClosed) != Conditions.ResultsClosed)
             {
@@ -364,13 +409,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Writers
             SerializeIfNotNull(_run.SpecialLocations, "specialLocations");
             SerializeIfNotNull(_run.Properties, "properties");
 
-            // Log complete. Write the end object.
             _jsonWriter.WriteEndObject(); // End: run
-            _jsonWriter.WriteEndArray();  // End: runs
-            _jsonWriter.WriteEndObject(); // End: sarifLog
-
-            _writeConditions |= Conditions.RunCompleted;
-            _jsonWriter.Flush();
         }
 
         /// <summary>Writes the log footer and closes the underlying <see cref="JsonWriter"/>.</summary>
@@ -0,0 +1,362 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+using System.Numerics;
+using System.Text;
+
+using Microsoft.CodeAnalysis.Sarif.Readers;
+
+using Newtonsoft.Json;
+using Newtonsoft.Json.Linq;
+using Newtonsoft.Json.Serialization;
+
+namespace Microsoft.CodeAnalysis.Sarif.Writers
+{
+    /// <summary>
+    ///  SarifBinaryWriter writes a SarifLog in a compact binary format, for passing logs between
+    ///  the stages of a pipeline without formatting and parsing JSON. The commonly used Result
+    ///  properties are written as columns (with strings interned per column), so a stage can read
+    ///  only the columns it needs; everything else is written as native records, with every string
+    ///  interned once per log. SarifBinaryReader reads the format back into an identical SarifLog.
+    /// </summary>
+    public sealed class SarifBinaryWriter : IDisposable
+    {
+        private readonly Stream _stream;
+        private readonly BinaryWriter _writer;
+        private readonly List<(string Name, long Offset, long Length)> _sections;
+        private readonly StringColumn _strings;
+        private bool _written;
+
+        /// <summary>Initializes a new instance of the <see cref="SarifBinaryWriter"/> class.</summary>
+        /// <param name="stream">The stream to write to. It must support Position.</param>
+        /// <param name="leaveOpen">True to leave the stream open when the writer is disposed.</param>
+        public SarifBinaryWriter(Stream stream, bool leaveOpen = false)
+        {
+            _stream = stream ?? throw new ArgumentNullException(nameof(stream));
+            _writer = new BinaryWriter(stream, Encoding.UTF8, leaveOpen);
+            _sections = new List<(string, long, long)>();
+            _strings = new StringColumn(0);
+        }
+
+        /// <summary>
+        ///  Write a SarifLog. A writer writes exactly one log.
+        /// </summary>
+        /// <param name="log">SarifLog to write</param>
+        public void Write(SarifLog log)
+        {
+            if (log == null) { throw new ArgumentNullException(nameof(log)); }
+            if (_written) { throw new InvalidOperationException($"{nameof(SarifBinaryWriter)} can write only one log."); }
+            _written = true;
+
+            _writer.Write(Encoding.ASCII.GetBytes(SarifBinaryFormat.Magic));
+            _writer.Write(SarifBinaryFormat.Version);
+
+            IList<Run> runs = log.Runs ?? Array.Empty<Run>();
+
+            // Everything but the Results
+            BeginSection(SarifBinaryFormat.LogSection);
+            WriteRecord(log, typeof(SarifLog), SarifBinaryFormat.OmittedLogProperties);
+            _writer.Write(log.Runs?.Count ?? -1);
+            foreach (Run run in runs)
+            {
+                WriteRecord(run, typeof(Run), SarifBinaryFormat.OmittedRunProperties);
+            }
+            EndSection();
+
+            BeginSection(SarifBinaryFormat.RunsSection);
+            _writer.Write(runs.Count);
+            foreach (Run run in runs)
+            {
+                _writer.Write(run?.Results?.Count ?? -1);
+            }
+            EndSection();
+
+            for (int runIndex = 0; runIndex < runs.Count; ++runIndex)
+            {
+                if (runs[runIndex]?.Results != null)
+                {
+                    WriteResults(runIndex, runs[runIndex].Results);
+                }
+            }
+
+            // The strings are written last, so that the records could be written as the log was enumerated.
+            BeginSection(SarifBinaryFormat.StringsSection);
+            _strings.WriteValues(_writer);
+            EndSection();
+
+            // Directory and footer
+            long directoryOffset = _stream.Position;
+            _writer.Write(_sections.Count);
+            foreach ((string name, long offset, long length) in _sections)
+            {
+                _writer.Write(name);
+                _writer.Write(offset);
+                _writer.Write(length);
+            }
+
+            _writer.Write(directoryOffset);
+            _writer.Flush();
+        }
+
+        public void Dispose()
+        {
+            _writer.Dispose();
+        }
+
+        private void WriteResults(int runIndex, IList<Result> results)
+        {
+            var ruleIds = new StringColumn(results.Count);
+            var messageTexts = new StringColumn(results.Count);
+            var messageIds = new StringColumn(results.Count);
+            var locationUris = new List<int>(results.Count);
+            var locationCounts = new List<int>(results.Count);
+            var ruleIndices = new List<int>(results.Count);
+            var kinds = new List<int>(results.Count);
+            var levels = new List<int>(results.Count);
+            var baselineStates = new List<int>(results.Count);
+            var ranks = new List<double>(results.Count);
+
+            // Write the record for each Result as it's read (so a DeferredList is read once), collecting the columns.
+            BeginSection(SarifBinaryFormat.RunSection(runIndex, SarifBinaryFormat.ColumnResults));
+
+            foreach (Result result in results)
+            {
+                WriteRecord(result, typeof(Result), SarifBinaryFormat.OmittedResultProperties);
+                WriteRecord(result?.Message, typeof(Message), SarifBinaryFormat.OmittedMessageProperties);
+
+                if (result?.Locations != null)
+                {
+                    locationCounts.Add(result.Locations.Count);
+
+                    foreach (Location location in result.Locations)
+                    {
+                        // The record has already interned the Uri; the column refers to the same string.
+                        Uri uri = location?.PhysicalLocation?.ArtifactLocation?.Uri;
+                        locationUris.Add(_strings.Intern(uri == null ? null : UriConverter.GetSerializedValue(uri)));
+                    }
+                }
+                else
+                {
+                    locationCounts.Add(-1);
+                }
+
+                ruleIds.Add(result?.RuleId);
+                messageTexts.Add(result?.Message?.Text);
+                messageIds.Add(result?.Message?.Id);
+                ruleIndices.Add(result?.RuleIndex ?? -1);
+                kinds.Add((int)(result?.Kind ?? 0));
+                levels.Add((int)(result?.Level ?? 0));
+                baselineStates.Add((int)(result?.BaselineState ?? 0));
+                ranks.Add(result?.Rank ?? 0);
+            }
+
+            EndSection();
+
+            WriteColumn(runIndex, SarifBinaryFormat.ColumnRuleId, ruleIds);
+            WriteColumn(runIndex, SarifBinaryFormat.ColumnMessageText, messageTexts);
+            WriteColumn(runIndex, SarifBinaryFormat.ColumnMessageId, messageIds);
+            WriteColumn(runIndex, SarifBinaryFormat.ColumnRuleIndex, ruleIndices);
+            WriteColumn(runIndex, SarifBinaryFormat.ColumnKind, kinds);
+            WriteColumn(runIndex, SarifBinaryFormat.ColumnLevel, levels);
+            WriteColumn(runIndex, SarifBinaryFormat.ColumnBaselineState, baselineStates);
+
+            BeginSection(SarifBinaryFormat.RunSection(runIndex, SarifBinaryFormat.ColumnRank));
+            foreach (double rank in ranks)
+            {
+                _writer.Write(rank);
+            }
+            EndSection();
+
+            BeginSection(SarifBinaryFormat.RunSection(runIndex, SarifBinaryFormat.ColumnLocationUris));
+
+            int uriIndex = 0;
+            foreach (int count in locationCounts)
+            {
+                _writer.Write(count);
+
+                for (int i = 0; i < count; ++i)
+                {
+                    _writer.Write(locationUris[uriIndex++]);
+                }
+            }
+            EndSection();
+        }
+
+        /// <summary>
+        ///  Write an object as a record: a 'present' flag, then each of its properties Json.NET would serialize, except those omitted.
+        /// </summary>
+        private void WriteRecord(object value, Type type, IList<string> omittedProperties = null)
+        {
+            _writer.Write(value != null);
+            if (value == null) { return; }
+
+            foreach (JsonProperty property in SarifBinaryFormat.GetRecordProperties(type))
+            {
+                if (omittedProperties?.Contains(property.PropertyName) == true) { continue; }
+
+                WriteValue(property.ValueProvider.GetValue(value), property.PropertyType);
+            }
+        }
+
+        private void WriteValue(object value, Type type)
+        {
+            switch (SarifBinaryFormat.GetValueKind(type))
+            {
+                case SarifBinaryFormat.ValueKind.String:
+                    WriteString((string)value);
+                    return;
+
+                case SarifBinaryFormat.ValueKind.Uri:
+                    WriteString(value == null ? null : UriConverter.GetSerializedValue((Uri)value));
+                    return;
+
+                case SarifBinaryFormat.ValueKind.Nullable:
+                    _writer.Write(value != null);
+                    if (value != null) { WriteValue(value, Nullable.GetUnderlyingType(type)); }
+                    return;
+
+                case SarifBinaryFormat.ValueKind.Enum: _writer.Write(Convert.ToInt32(value, CultureInfo.InvariantCulture)); return;
+                case SarifBinaryFormat.ValueKind.Boolean: _writer.Write((bool)value); return;
+                case SarifBinaryFormat.ValueKind.Int32: _writer.Write((int)value); return;
+                case SarifBinaryFormat.ValueKind.Int64: _writer.Write((long)value); return;
+                case SarifBinaryFormat.ValueKind.Double: _writer.Write((double)value); return;
+                case SarifBinaryFormat.ValueKind.DateTime: _writer.Write(((DateTime)value).ToBinary()); return;
+                case SarifBinaryFormat.ValueKind.Guid: _writer.Write(((Guid)value).ToByteArray()); return;
+                case SarifBinaryFormat.ValueKind.BigInteger: WriteString(((BigInteger)value).ToString(CultureInfo.InvariantCulture)); return;
+
+                case SarifBinaryFormat.ValueKind.PropertyInfo:
+                    var propertyInfo = (SerializedPropertyInfo)value;
+                    WriteString(propertyInfo?.SerializedValue);
+                    _writer.Write(propertyInfo?.IsString == true);
+                    return;
+
+                case SarifBinaryFormat.ValueKind.Json:
+                    WriteString(value == null ? null : JToken.FromObject(value).ToString(Formatting.None));
+                    return;
+
+                case SarifBinaryFormat.ValueKind.List:
+                    var list = (IList)value;
+                    _writer.Write(list?.Count ?? -1);
+                    if (list == null) { return; }
+
+                    Type itemType = ((JsonArrayContract)SarifBinaryFormat.GetContract(type)).CollectionItemType;
+                    foreach (object item in list)
+                    {
+                        WriteValue(item, itemType);
+                    }
+
+                    return;
+
+                case SarifBinaryFormat.ValueKind.Dictionary:
+                    var dictionary = (IDictionary)value;
+                    _writer.Write(dictionary?.Count ?? -1);
+                    if (dictionary == null) { return; }
+
+                    Type valueType = ((JsonDictionaryContract)SarifBinaryFormat.GetContract(type)).DictionaryValueType;
+                    foreach (DictionaryEntry entry in dictionary)
+                    {
+                        WriteString((string)entry.Key);
+                        WriteValue(entry.Value, valueType);
+                    }
+
+                    return;
+
+                case SarifBinaryFormat.ValueKind.Record:
+                    WriteRecord(value, type);
+                    return;
+            }
+
+            throw new NotSupportedException($"{nameof(SarifBinaryWriter)} cannot write values of type '{type}'.");
+        }
+
+        private void WriteString(string value)
+        {
+            _writer.Write(_strings.Intern(value));
+        }
+
+        private void WriteColumn(int runIndex, string column, StringColumn values)
+        {
+            BeginSection(SarifBinaryFormat.RunSection(runIndex, column));
+            values.WriteValues(_writer);
+
+            foreach (int index in values.Indices)
+            {
+                _writer.Write(index);
+            }
+            EndSection();
+        }
+
+        private void WriteColumn(int runIndex, string column, List<int> values)
+        {
+            BeginSection(SarifBinaryFormat.RunSection(runIndex, column));
+            foreach (int value in values)
+            {
+                _writer.Write(value);
+            }
+            EndSection();
+        }
+
+        private void BeginSection(string name)
+        {
+            _writer.Flush();
+            _sections.Add((name, _stream.Position, -1));
+        }
+
+        private void EndSection()
+        {
+            _writer.Flush();
+
+            (string name, long offset, long _) = _sections[_sections.Count - 1];
+            _sections[_sections.Count - 1] = (name, offset, _stream.Position - offset);
+        }
+
+        /// <summary>
+        ///  StringColumn interns the values of a string column, keeping the index of each value.
+        /// </summary>
+        private class StringColumn
+        {
+            private readonly Dictionary<string, int> _indexByValue = new Dictionary<string, int>(StringComparer.Ordinal);
+            private readonly List<string> _values = new List<string>();
+
+            public StringColumn(int capacity)
+            {
+                Indices = new List<int>(capacity);
+            }
+
+            public List<int> Indices { get; }
+
+            public void Add(string value)
+            {
+                Indices.Add(Intern(value));
+            }
+
+            public int Intern(string value)
+            {
+                int index = -1;
+
+                if (value != null && !_indexByValue.TryGetValue(value, out index))
+                {
+                    index = _values.Count;
+                    _values.Add(value);
+                    _indexByValue[value] = index;
+                }
+
+                return index;
+            }
+
+            public void WriteValues(BinaryWriter writer)
+            {
+                writer.Write(_values.Count);
+                foreach (string value in _values)
+                {
+                    writer.Write(value);
+                }
+            }
+        }
+    }
+}
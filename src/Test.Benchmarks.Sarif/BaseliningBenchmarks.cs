@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System.Collections.Generic;
+using System.Linq;
+
+using BenchmarkDotNet.Attributes;
+
+using Microsoft.CodeAnalysis.Sarif;
+using Microsoft.CodeAnalysis.Sarif.Baseline;
+using Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching;
+
+namespace Test.Benchmarks.Sarif
+{
+    /// <summary>
+    ///  Measures matching a log against the previous log in its series, both with V2ResultMatcher
+    ///  alone and through the default baseliner.
+    /// </summary>
+    public class BaseliningBenchmarks
+    {
+        private SarifLog _previousLog;
+        private SarifLog _currentLog;
+        private SarifLog _previousLogCopy;
+        private SarifLog _currentLogCopy;
+
+        [Params(1000, 5000)]
+        public int ResultCount { get; set; }
+
+        [GlobalSetup]
+        public void GlobalSetup()
+        {
+            _previousLog = SyntheticSarifLogGenerator.Generate(new SyntheticLogShape { ResultCount = ResultCount });
+            _currentLog = SyntheticSarifLogGenerator.GenerateNextVersion(_previousLog, seed: SyntheticLogShape.DefaultSeed + 1);
+        }
+
+        // Baselining annotates the Results it's given, so each iteration gets fresh copies.
+        [IterationSetup]
+        public void IterationSetup()
+        {
+            _previousLogCopy = _previousLog.DeepClone();
+            _currentLogCopy = _currentLog.DeepClone();
+        }
+
+        [Benchmark]
+        public int V2ResultMatcherMatch()
+        {
+            IList<ExtractedResult> before = Extract(_previousLogCopy);
+            IList<ExtractedResult> after = Extract(_currentLogCopy);
+
+            return new V2ResultMatcher().Match(before, after).Count;
+        }
+
+        [Benchmark]
+        public int DefaultBaseliner()
+        {
+            ISarifLogMatcher matcher = ResultMatchingBaselinerFactory.GetDefaultResultMatchingBaseliner();
+            SarifLog output = matcher.Match(new[] { _previousLogCopy }, new[] { _currentLogCopy }).First();
+
+            return output.Runs[0].Results.Count;
+        }
+
+        private static IList<ExtractedResult> Extract(SarifLog log)
+        {
+            Run run = log.Runs[0];
+            return run.Results.Select(result => new ExtractedResult(result, run)).ToList();
+        }
+    }
+}
@@ -0,0 +1,61 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System.Globalization;
+using System.IO;
+
+using BenchmarkDotNet.Attributes;
+
+using Microsoft.CodeAnalysis.Sarif;
+using Microsoft.CodeAnalysis.Sarif.Multitool;
+
+namespace Test.Benchmarks.Sarif
+{
+    /// <summary>
+    ///  Measures the 'merge' command end to end, over logs on disk.
+    /// </summary>
+    public class MultitoolBenchmarks
+    {
+        private const int MergedLogCount = 8;
+
+        private string _directory;
+        private string _inputDirectory;
+
+        [Params(1000, 10000)]
+        public int ResultCount { get; set; }
+
+        [GlobalSetup]
+        public void GlobalSetup()
+        {
+            _directory = Path.Combine(Path.GetTempPath(), "Test.Benchmarks.Sarif", Path.GetRandomFileName());
+            _inputDirectory = Path.Combine(_directory, "input");
+            Directory.CreateDirectory(_inputDirectory);
+
+            for (int i = 0; i < MergedLogCount; i++)
+            {
+                var shape = new SyntheticLogShape { ResultCount = ResultCount / MergedLogCount, Seed = SyntheticLogShape.DefaultSeed + i };
+                SyntheticSarifLogGenerator.Generate(shape).Save(Path.Combine(_inputDirectory, "log" + i.ToString(CultureInfo.InvariantCulture) + ".sarif"));
+            }
+        }
+
+        [GlobalCleanup]
+        public void GlobalCleanup()
+        {
+            Directory.Delete(_directory, recursive: true);
+        }
+
+        [Benchmark]
+        public int Merge()
+        {
+            var options = new MergeOptions
+            {
+                TargetFileSpecifiers = new[] { Path.Combine(_inputDirectory, "*.sarif") },
+                OutputDirectoryPath = _directory,
+                OutputFileName = "merged.sarif",
+                OutputFileOptions = new[] { FilePersistenceOptions.ForceOverwrite },
+            };
+
+            return new MergeCommand().Run(options);
+        }
+    }
+}
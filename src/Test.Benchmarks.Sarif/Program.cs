@@ -0,0 +1,42 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using BenchmarkDotNet.Columns;
+using BenchmarkDotNet.Configs;
+using BenchmarkDotNet.Diagnosers;
+using BenchmarkDotNet.Exporters.Json;
+using BenchmarkDotNet.Running;
+
+namespace Test.Benchmarks.Sarif
+{
+    /// <summary>
+    ///  Test.Benchmarks.Sarif measures the throughput and allocations of the SDK's hot paths over
+    ///  synthetic logs, so that regressions can be caught before a new SDK version is adopted.
+    ///  Logs are generated from a fixed seed (see SyntheticSarifLogGenerator), so every run of a
+    ///  benchmark sees the same input.
+    ///
+    ///  Usage
+    ///  =====
+    ///   Benchmarks must be run from a Release build:
+    ///   "dotnet run -c Release --project src\Test.Benchmarks.Sarif -- --filter *"
+    ///
+    ///   Run one group of benchmarks:
+    ///   "dotnet run -c Release --project src\Test.Benchmarks.Sarif -- --filter *BaseliningBenchmarks*"
+    ///
+    ///   Compare two SDK versions:
+    ///   Run the same filter on each version and compare the '*-report-full.json' files written
+    ///   to BenchmarkDotNet.Artifacts\results; the Mean, Op/s and Allocated columns are the ones to watch.
+    /// </summary>
+    internal class Program
+    {
+        private static void Main(string[] args)
+        {
+            IConfig config = DefaultConfig.Instance
+                .AddDiagnoser(MemoryDiagnoser.Default)
+                .AddColumn(StatisticColumn.OperationsPerSecond)
+                .AddExporter(JsonExporter.Full);
+
+            BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run(args, config);
+        }
+    }
+}
@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System.IO;
+
+using BenchmarkDotNet.Attributes;
+
+using Microsoft.CodeAnalysis.Sarif.Multitool;
+
+namespace Test.Benchmarks.Sarif
+{
+    /// <summary>
+    ///  Measures the 'query' command end to end, over a log on disk, with and without the result index.
+    /// </summary>
+    public class QueryBenchmarks
+    {
+        private string _directory;
+        private string _queryLogPath;
+
+        [Params(1000, 10000)]
+        public int ResultCount { get; set; }
+
+        [Params(false, true)]
+        public bool UseIndex { get; set; }
+
+        [GlobalSetup]
+        public void GlobalSetup()
+        {
+            _directory = Path.Combine(Path.GetTempPath(), "Test.Benchmarks.Sarif", Path.GetRandomFileName());
+            Directory.CreateDirectory(_directory);
+
+            _queryLogPath = Path.Combine(_directory, "query.sarif");
+            SyntheticSarifLogGenerator.Generate(new SyntheticLogShape { ResultCount = ResultCount, LocationsPerResult = 2 }).Save(_queryLogPath);
+        }
+
+        [GlobalCleanup]
+        public void GlobalCleanup()
+        {
+            Directory.Delete(_directory, recursive: true);
+        }
+
+        [Benchmark]
+        public int Query()
+        {
+            var options = new QueryOptions
+            {
+                InputFilePath = _queryLogPath,
+                Expression = "RuleId = SYN0007 || (Level = error && Uri : dir3/)",
+                ReturnCount = true,
+                UseIndex = UseIndex,
+            };
+
+            return new QueryCommand().RunWithoutCatch(options);
+        }
+    }
+}
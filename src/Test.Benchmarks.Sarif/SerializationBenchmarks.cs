@@ -0,0 +1,122 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System.IO;
+using System.Linq;
+using System.Text;
+
+using BenchmarkDotNet.Attributes;
+
+using Microsoft.CodeAnalysis.Sarif;
+using Microsoft.CodeAnalysis.Sarif.Readers;
+
+using Newtonsoft.Json;
+
+namespace Test.Benchmarks.Sarif
+{
+    /// <summary>
+    ///  Measures reading and writing logs with SarifContractResolver and with
+    ///  SarifDeferredContractResolver (which reads Results only as they're enumerated),
+    ///  against the binary format written by SarifLog.SaveBinary.
+    /// </summary>
+    public class SerializationBenchmarks
+    {
+        private SarifLog _log;
+        private byte[] _logBytes;
+        private byte[] _binaryLogBytes;
+        private string _logFilePath;
+
+        [Params(1000, 10000)]
+        public int ResultCount { get; set; }
+
+        [Params(0, 2)]
+        public int CodeFlowsPerResult { get; set; }
+
+        [Params(0, 10)]
+        public int PropertiesPerResult { get; set; }
+
+        [GlobalSetup]
+        public void GlobalSetup()
+        {
+            _log = SyntheticSarifLogGenerator.Generate(new SyntheticLogShape
+            {
+                ResultCount = ResultCount,
+                LocationsPerResult = 2,
+                CodeFlowsPerResult = CodeFlowsPerResult,
+                PropertiesPerResult = PropertiesPerResult,
+            });
+
+            using var stream = new MemoryStream();
+            _log.Save(stream);
+            _logBytes = stream.ToArray();
+
+            using var binaryStream = new MemoryStream();
+            _log.SaveBinary(binaryStream);
+            _binaryLogBytes = binaryStream.ToArray();
+
+            _logFilePath = Path.GetTempFileName();
+            File.WriteAllBytes(_logFilePath, _logBytes);
+        }
+
+        [GlobalCleanup]
+        public void GlobalCleanup()
+        {
+            File.Delete(_logFilePath);
+        }
+
+        [Benchmark]
+        public SarifLog Deserialize()
+        {
+            var serializer = new JsonSerializer { ContractResolver = SarifContractResolver.Instance };
+
+            using var reader = new JsonTextReader(new StreamReader(new MemoryStream(_logBytes), Encoding.UTF8));
+            return serializer.Deserialize<SarifLog>(reader);
+        }
+
+        [Benchmark]
+        public int DeserializeDeferredAndEnumerate()
+        {
+            var serializer = new JsonSerializer { ContractResolver = SarifDeferredContractResolver.Instance };
+
+            using var reader = new JsonPositionedTextReader(_logFilePath);
+            SarifLog log = serializer.Deserialize<SarifLog>(reader);
+            return log.Runs[0].Results.Count(r => r.Level == FailureLevel.Error);
+        }
+
+        [Benchmark]
+        public long Serialize()
+        {
+            var serializer = new JsonSerializer { ContractResolver = SarifContractResolver.Instance };
+
+            using var stream = new MemoryStream(_logBytes.Length);
+            using (var writer = new JsonTextWriter(new StreamWriter(stream, Encoding.UTF8, 1024, leaveOpen: true)))
+            {
+                serializer.Serialize(writer, _log);
+            }
+
+            return stream.Length;
+        }
+
+        [Benchmark]
+        public SarifLog DeserializeBinary()
+        {
+            return SarifLog.LoadBinary(new MemoryStream(_binaryLogBytes));
+        }
+
+        [Benchmark]
+        public int DeserializeBinaryLevelColumn()
+        {
+            using var reader = new SarifBinaryReader(new MemoryStream(_binaryLogBytes));
+            return reader.ReadLevels(0).Count(level => level == FailureLevel.Error);
+        }
+
+        [Benchmark]
+        public long SerializeBinary()
+        {
+            using var stream = new MemoryStream(_binaryLogBytes.Length);
+            _log.SaveBinary(stream);
+
+            return stream.Length;
+        }
+    }
+}
@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+namespace Test.Benchmarks.Sarif
+{
+    /// <summary>
+    ///  The dimensions of a log built by SyntheticSarifLogGenerator.
+    /// </summary>
+    public class SyntheticLogShape
+    {
+        public const int DefaultSeed = 20191203;
+
+        public int ResultCount { get; set; } = 1000;
+
+        public int LocationsPerResult { get; set; } = 1;
+
+        public int CodeFlowsPerResult { get; set; }
+
+        public int ThreadFlowLocationsPerCodeFlow { get; set; } = 5;
+
+        public int PropertiesPerResult { get; set; }
+
+        public int RuleCount { get; set; } = 50;
+
+        public int ArtifactCount { get; set; } = 200;
+
+        public int Seed { get; set; } = DefaultSeed;
+
+        public override string ToString()
+        {
+            return $"{ResultCount}r x {LocationsPerResult}l x {CodeFlowsPerResult}cf x {PropertiesPerResult}p";
+        }
+    }
+}
@@ -0,0 +1,247 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.Linq;
+using System.Text;
+
+using Microsoft.CodeAnalysis.Sarif;
+
+namespace Test.Benchmarks.Sarif
+{
+    /// <summary>
+    ///  SyntheticSarifLogGenerator builds logs of a given shape for benchmarking. The same shape
+    ///  (including its seed) always produces the same log, so measurements are comparable
+    ///  across runs and SDK versions.
+    /// </summary>
+    public static class SyntheticSarifLogGenerator
+    {
+        private const string ToolName = "SyntheticTool";
+        private const string BaseDirectory = "src/";
+
+        private static readonly string[] s_words = new[]
+        {
+            "buffer", "overrun", "unchecked", "return", "value", "in", "call", "to", "null", "pointer",
+            "dereference", "of", "variable", "tainted", "data", "flows", "into", "sink", "parameter", "leaks"
+        };
+
+        public static SarifLog Generate(SyntheticLogShape shape)
+        {
+            return new SarifLog
+            {
+                Version = SarifVersion.Current,
+                SchemaUri = new Uri(SarifUtilities.SarifSchemaUri),
+                Runs = new[] { GenerateRun(shape) },
+            };
+        }
+
+        public static Run GenerateRun(SyntheticLogShape shape)
+        {
+            var random = new Random(shape.Seed);
+
+            var rules = new List<ReportingDescriptor>(shape.RuleCount);
+            for (int i = 0; i < shape.RuleCount; i++)
+            {
+                rules.Add(new ReportingDescriptor
+                {
+                    Id = RuleId(i),
+                    Name = "Rule" + i.ToString(CultureInfo.InvariantCulture),
+                    FullDescription = new MultiformatMessageString { Text = Sentence(random, 12) },
+                    MessageStrings = new Dictionary<string, MultiformatMessageString>
+                    {
+                        ["Default"] = new MultiformatMessageString { Text = "'{0}' " + Sentence(random, 6) + " '{1}'." },
+                    },
+                });
+            }
+
+            var artifacts = new List<Artifact>(shape.ArtifactCount);
+            for (int i = 0; i < shape.ArtifactCount; i++)
+            {
+                artifacts.Add(new Artifact { Location = new ArtifactLocation { Uri = ArtifactUri(i), UriBaseId = "SRCROOT" } });
+            }
+
+            var results = new List<Result>(shape.ResultCount);
+            for (int i = 0; i < shape.ResultCount; i++)
+            {
+                results.Add(GenerateResult(random, shape, i));
+            }
+
+            return new Run
+            {
+                Tool = new Tool
+                {
+                    Driver = new ToolComponent
+                    {
+                        Name = ToolName,
+                        Version = "1.0.0",
+                        Rules = rules,
+                    },
+                },
+                OriginalUriBaseIds = new Dictionary<string, ArtifactLocation>
+                {
+                    ["SRCROOT"] = new ArtifactLocation { Uri = new Uri("file:///c:/code/") },
+                },
+                Artifacts = artifacts,
+                Results = results,
+            };
+        }
+
+        /// <summary>
+        ///  Build the 'next' log in a series, as a later scan of the same code would: most Results
+        ///  are unchanged, some have moved a few lines, some are gone and some are new.
+        /// </summary>
+        public static SarifLog GenerateNextVersion(SarifLog log, int seed, double changedFraction = 0.1)
+        {
+            var random = new Random(seed);
+            SarifLog next = log.DeepClone();
+            Run run = next.Runs[0];
+            var shape = new SyntheticLogShape { Seed = seed, RuleCount = run.Tool.Driver.Rules.Count, ArtifactCount = run.Artifacts.Count };
+
+            var results = new List<Result>(run.Results.Count);
+            foreach (Result result in run.Results)
+            {
+                double roll = random.NextDouble();
+                if (roll < changedFraction / 2)
+                {
+                    // Removed.
+                    continue;
+                }
+
+                if (roll < changedFraction)
+                {
+                    // Moved.
+                    foreach (Location location in result.Locations ?? Array.Empty<Location>())
+                    {
+                        location.PhysicalLocation.Region.StartLine += random.Next(1, 20);
+                    }
+                }
+
+                results.Add(result);
+            }
+
+            int addedCount = (int)(run.Results.Count * changedFraction / 2);
+            for (int i = 0; i < addedCount; i++)
+            {
+                results.Add(GenerateResult(random, shape, run.Results.Count + i));
+            }
+
+            run.Results = results;
+            return next;
+        }
+
+        /// <summary>
+        ///  Build the text of a source file with the given number of lines.
+        /// </summary>
+        public static string GenerateFileText(int lineCount, int seed = SyntheticLogShape.DefaultSeed)
+        {
+            var random = new Random(seed);
+            var sb = new StringBuilder(lineCount * 48);
+
+            for (int i = 0; i < lineCount; i++)
+            {
+                sb.Append(' ', 4 * random.Next(4));
+                sb.Append(Sentence(random, random.Next(1, 10)));
+                sb.Append(i % 7 == 0 ? "\r\n" : "\n");
+            }
+
+            return sb.ToString();
+        }
+
+        private static Result GenerateResult(Random random, SyntheticLogShape shape, int resultIndex)
+        {
+            int ruleIndex = random.Next(shape.RuleCount);
+
+            var result = new Result
+            {
+                RuleId = RuleId(ruleIndex),
+                RuleIndex = ruleIndex,
+                Level = (FailureLevel)random.Next((int)FailureLevel.Note, (int)FailureLevel.Error + 1),
+                Message = new Message
+                {
+                    Id = "Default",
+                    Arguments = new[] { "symbol" + random.Next(1000).ToString(CultureInfo.InvariantCulture), Sentence(random, 2) },
+                },
+                Locations = GenerateLocations(random, shape, shape.LocationsPerResult),
+                PartialFingerprints = new Dictionary<string, string>
+                {
+                    ["primaryLocationLineHash"] = random.Next().ToString("x8", CultureInfo.InvariantCulture) + ":1",
+                },
+            };
+
+            if (shape.CodeFlowsPerResult > 0)
+            {
+                var codeFlows = new List<CodeFlow>(shape.CodeFlowsPerResult);
+                for (int i = 0; i < shape.CodeFlowsPerResult; i++)
+                {
+                    var threadFlowLocations = GenerateLocations(random, shape, shape.ThreadFlowLocationsPerCodeFlow)
+                        .Select(l => new ThreadFlowLocation { Location = l, NestingLevel = random.Next(3) })
+                        .ToList();
+
+                    codeFlows.Add(new CodeFlow
+                    {
+                        ThreadFlows = new[] { new ThreadFlow { Locations = threadFlowLocations } },
+                    });
+                }
+
+                result.CodeFlows = codeFlows;
+            }
+
+            for (int i = 0; i < shape.PropertiesPerResult; i++)
+            {
+                result.SetProperty("property" + i.ToString(CultureInfo.InvariantCulture), Sentence(random, 3));
+            }
+
+            result.SetProperty("resultIndex", resultIndex);
+            return result;
+        }
+
+        private static IList<Location> GenerateLocations(Random random, SyntheticLogShape shape, int count)
+        {
+            var locations = new List<Location>(count);
+            for (int i = 0; i < count; i++)
+            {
+                int artifactIndex = random.Next(shape.ArtifactCount);
+                int startLine = random.Next(1, 2000);
+                int startColumn = random.Next(1, 80);
+
+                locations.Add(new Location
+                {
+                    PhysicalLocation = new PhysicalLocation
+                    {
+                        ArtifactLocation = new ArtifactLocation { Uri = ArtifactUri(artifactIndex), UriBaseId = "SRCROOT", Index = artifactIndex },
+                        Region = new Region
+                        {
+                            StartLine = startLine,
+                            StartColumn = startColumn,
+                            EndLine = startLine + random.Next(3),
+                            EndColumn = startColumn + random.Next(1, 40),
+                        },
+                    },
+                });
+            }
+
+            return locations;
+        }
+
+        private static string RuleId(int ruleIndex) => "SYN" + ruleIndex.ToString("0000", CultureInfo.InvariantCulture);
+
+        private static Uri ArtifactUri(int artifactIndex)
+        {
+            return new Uri(BaseDirectory + "dir" + (artifactIndex % 17).ToString(CultureInfo.InvariantCulture) + "/file" + artifactIndex.ToString(CultureInfo.InvariantCulture) + ".cpp", UriKind.Relative);
+        }
+
+        private static string Sentence(Random random, int wordCount)
+        {
+            var sb = new StringBuilder();
+            for (int i = 0; i < wordCount; i++)
+            {
+                if (i > 0) { sb.Append(' '); }
+                sb.Append(s_words[random.Next(s_words.Length)]);
+            }
+
+            return sb.ToString();
+        }
+    }
+}
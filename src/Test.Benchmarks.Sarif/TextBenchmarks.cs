@@ -0,0 +1,82 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+
+using BenchmarkDotNet.Attributes;
+
+using Microsoft.CodeAnalysis.Sarif;
+
+namespace Test.Benchmarks.Sarif
+{
+    /// <summary>
+    ///  Measures the per-file text work done when enriching logs: computing rolling line hashes
+    ///  and populating region properties through FileRegionsCache.
+    /// </summary>
+    public class TextBenchmarks
+    {
+        private const int FileCount = 20;
+        private const int RegionsPerFile = 500;
+
+        private string _fileText;
+        private string _directory;
+        private List<(Uri Uri, Region Region)> _regions;
+
+        [Params(1000, 20000)]
+        public int LineCount { get; set; }
+
+        [GlobalSetup]
+        public void GlobalSetup()
+        {
+            _fileText = SyntheticSarifLogGenerator.GenerateFileText(LineCount);
+
+            _directory = Path.Combine(Path.GetTempPath(), "Test.Benchmarks.Sarif", Path.GetRandomFileName());
+            Directory.CreateDirectory(_directory);
+
+            var random = new Random(SyntheticLogShape.DefaultSeed);
+            _regions = new List<(Uri, Region)>(FileCount * RegionsPerFile);
+
+            for (int i = 0; i < FileCount; i++)
+            {
+                string path = Path.Combine(_directory, "file" + i.ToString(CultureInfo.InvariantCulture) + ".cpp");
+                File.WriteAllText(path, SyntheticSarifLogGenerator.GenerateFileText(LineCount, seed: i));
+
+                var uri = new Uri(path, UriKind.Absolute);
+                for (int j = 0; j < RegionsPerFile; j++)
+                {
+                    _regions.Add((uri, new Region { StartLine = random.Next(1, LineCount) }));
+                }
+            }
+        }
+
+        [GlobalCleanup]
+        public void GlobalCleanup()
+        {
+            Directory.Delete(_directory, recursive: true);
+        }
+
+        [Benchmark]
+        public int RollingHash()
+        {
+            return HashUtilities.RollingHash(_fileText).Count;
+        }
+
+        [Benchmark]
+        public int FileRegionsCachePopulateRegions()
+        {
+            var cache = new FileRegionsCache();
+            int populated = 0;
+
+            foreach ((Uri uri, Region region) in _regions)
+            {
+                Region result = cache.PopulateTextRegionProperties(region, uri, populateSnippet: true);
+                if (result.CharLength > 0) { populated++; }
+            }
+
+            return populated;
+        }
+    }
+}
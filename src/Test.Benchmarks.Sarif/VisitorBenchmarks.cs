@@ -0,0 +1,66 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System.Collections.Generic;
+
+using BenchmarkDotNet.Attributes;
+
+using Microsoft.CodeAnalysis.Sarif;
+using Microsoft.CodeAnalysis.Sarif.Visitors;
+
+namespace Test.Benchmarks.Sarif
+{
+    /// <summary>
+    ///  Measures a full SarifRewritingVisitor walk and partitioning a log by rule.
+    /// </summary>
+    public class VisitorBenchmarks
+    {
+        private SarifLog _log;
+
+        [Params(1000, 10000)]
+        public int ResultCount { get; set; }
+
+        [Params(0, 2)]
+        public int CodeFlowsPerResult { get; set; }
+
+        [GlobalSetup]
+        public void GlobalSetup()
+        {
+            _log = SyntheticSarifLogGenerator.Generate(new SyntheticLogShape
+            {
+                ResultCount = ResultCount,
+                LocationsPerResult = 2,
+                CodeFlowsPerResult = CodeFlowsPerResult,
+            });
+        }
+
+        [Benchmark]
+        public int RewritingVisitorWalk()
+        {
+            var visitor = new RegionCountingVisitor();
+            visitor.VisitSarifLog(_log);
+            return visitor.RegionCount;
+        }
+
+        [Benchmark]
+        public int PartitionByRuleId()
+        {
+            var visitor = new PartitioningVisitor<string>(result => result.RuleId, deepClone: false);
+            visitor.VisitSarifLog(_log);
+
+            Dictionary<string, SarifLog> partitions = visitor.GetPartitionLogs();
+            return partitions.Count;
+        }
+
+        private sealed class RegionCountingVisitor : SarifRewritingVisitor
+        {
+            public int RegionCount { get; private set; }
+
+            public override Region VisitRegion(Region node)
+            {
+                RegionCount++;
+                return base.VisitRegion(node);
+            }
+        }
+    }
+}
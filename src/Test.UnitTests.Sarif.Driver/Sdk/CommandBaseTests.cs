@@ -0,0 +1,79 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+
+using FluentAssertions;
+
+using Newtonsoft.Json;
+
+using Xunit;
+
+namespace Microsoft.CodeAnalysis.Sarif.Driver
+{
+    public class CommandBaseTests
+    {
+        [Fact]
+        public void CommandBase_WritesAndReadsBinaryLogsForSarifbOutput()
+        {
+            SarifLog log = CreateLog();
+
+            using var binaryFile = new TempFile(".sarifb");
+            CommandBase.WriteSarifFile(FileSystem.Instance, log, binaryFile.Name, minify: true);
+
+            Encoding.ASCII.GetString(File.ReadAllBytes(binaryFile.Name), 0, 4).Should().Be("SARB");
+
+            SarifLog roundTripped = CommandBase.ReadSarifFile<SarifLog>(FileSystem.Instance, binaryFile.Name);
+            JsonConvert.SerializeObject(roundTripped).Should().Be(JsonConvert.SerializeObject(log));
+        }
+
+        [Fact]
+        public void CommandBase_WritesJsonForSarifOutput()
+        {
+            SarifLog log = CreateLog();
+
+            using var jsonFile = new TempFile(".sarif");
+            CommandBase.WriteSarifFile(FileSystem.Instance, log, jsonFile.Name, minify: true);
+
+            File.ReadAllText(jsonFile.Name).Should().Be(JsonConvert.SerializeObject(log));
+            JsonConvert.SerializeObject(CommandBase.ReadSarifFile<SarifLog>(FileSystem.Instance, jsonFile.Name))
+                .Should().Be(JsonConvert.SerializeObject(log));
+        }
+
+        private static SarifLog CreateLog()
+        {
+            var result = new Result
+            {
+                RuleId = "TEST1001",
+                Message = new Message { Text = "Found a problem." },
+                Locations = new List<Location>
+                {
+                    new Location
+                    {
+                        PhysicalLocation = new PhysicalLocation
+                        {
+                            ArtifactLocation = new ArtifactLocation { Uri = new Uri("src/file.c", UriKind.Relative), UriBaseId = "SRCROOT" },
+                            Region = new Region { StartLine = 3 }
+                        }
+                    }
+                }
+            };
+            result.SetProperty("count", 2);
+
+            return new SarifLog
+            {
+                Runs = new List<Run>
+                {
+                    new Run
+                    {
+                        Tool = new Tool { Driver = new ToolComponent { Name = "TestTool" } },
+                        Results = new List<Result> { result }
+                    }
+                }
+            };
+        }
+    }
+}
@@ -1,14 +1,19 @@
 // Copyright (c) Microsoft. All rights reserved.
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
+using System;
 using System.Collections.Generic;
 using System.IO;
+using System.Linq;
 using System.Reflection;
+using System.Text;
 using System.Threading;
 using System.Threading.Tasks;
 
 using FluentAssertions;
 
+using Microsoft.CodeAnalysis.Sarif.Writers;
+
 using Xunit;
 
 namespace Microsoft.CodeAnalysis.Sarif.Driver
@@ -44,6 +49,146 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
                 "every merge into RuntimeErrors must be serialized, or a runtime condition is silently dropped");
         }
 
+        [Fact]
+        public void Run_BoundsTargetsBufferedBehindASlowTarget()
+        {
+            const int maxBufferedTargets = 2;
+
+            var logger = new BufferProbingLogger();
+            var context = new TestAnalysisContext { Logger = logger, MaxBufferedTargets = maxBufferedTargets };
+            var command = new SlowFirstTargetCommand(logger);
+
+            command.Run(CreateOptions(), ref context);
+
+            logger.TargetsLogged.Should().BeGreaterThan(maxBufferedTargets,
+                "the limit is only exercised when there are more targets than it allows");
+            logger.MaxTargetsBuffered.Should().BeLessOrEqualTo(maxBufferedTargets,
+                "targets completed behind the slow first target must not accumulate without bound");
+        }
+
+        [Fact]
+        public void Run_CacheResultsByHash_AnalyzesEachDistinctTargetOnceAndReplaysItsResults()
+        {
+            using var tempDirectory = new TempDirectory();
+            var targets = new List<string>();
+            for (int i = 0; i < 6; i++)
+            {
+                targets.Add(tempDirectory.Write($"File{i}.txt", $"Contents {i % 2}"));
+            }
+
+            var logger = new ResultRecordingLogger();
+            var context = new TestAnalysisContext { Logger = logger, CacheResultsByHash = true };
+            var command = new AnalysisCountingCommand();
+
+            TestAnalyzeOptions options = CreateOptions();
+            options.TargetFileSpecifiers = new[] { Path.Combine(tempDirectory.Name, "*.txt") };
+
+            int result = command.Run(options, ref context);
+
+            result.Should().Be(CommandBase.SUCCESS);
+            command.TargetsAnalyzed.Should().Be(2, "only two of the targets have distinct contents");
+
+            logger.ResultUris.Should().NotBeEmpty();
+            logger.ResultUris.Distinct().Select(uri => uri.GetFilePath()).Should().BeEquivalentTo(targets,
+                "results replayed for a duplicate target must refer to it rather than to the target analyzed");
+            logger.ResultUris.GroupBy(uri => uri).Select(group => group.Count()).Distinct().Should().ContainSingle(
+                "every target with the same contents must receive the same results");
+        }
+
+        [Fact]
+        public void Run_AnalysisCacheDirectory_AnalyzesOnlyTargetsChangedSinceThePreviousRun()
+        {
+            using var targetsDirectory = new TempDirectory();
+            using var cacheDirectory = new TempDirectory();
+
+            for (int i = 0; i < 4; i++)
+            {
+                targetsDirectory.Write($"File{i}.txt", $"Contents {i}");
+            }
+
+            TestAnalyzeOptions options = CreateOptions();
+            options.TargetFileSpecifiers = new[] { Path.Combine(targetsDirectory.Name, "*.txt") };
+            options.AnalysisCacheDirectory = cacheDirectory.Name;
+
+            (int targetsAnalyzed, List<Uri> resultUris) Scan()
+            {
+                var logger = new ResultRecordingLogger();
+                var context = new TestAnalysisContext { Logger = logger };
+                var command = new AnalysisCountingCommand();
+
+                command.Run(options, ref context).Should().Be(CommandBase.SUCCESS);
+                return (command.TargetsAnalyzed, logger.ResultUris);
+            }
+
+            (int targetsAnalyzed, List<Uri> firstResultUris) = Scan();
+            targetsAnalyzed.Should().Be(4);
+
+            (targetsAnalyzed, List<Uri> resultUris) = Scan();
+            targetsAnalyzed.Should().Be(0, "no target has changed since the previous run");
+            resultUris.Should().Equal(firstResultUris);
+
+            targetsDirectory.Write("File2.txt", "Changed contents");
+
+            (targetsAnalyzed, resultUris) = Scan();
+            targetsAnalyzed.Should().Be(1, "only one target has changed since the previous run");
+            resultUris.Should().Equal(firstResultUris);
+        }
+
+        [Fact]
+        public void Run_RuleParallelismThreshold_ProducesTheSameResultsAsSerialAnalysis()
+        {
+            using var targetsDirectory = new TempDirectory();
+            targetsDirectory.Write("Small.txt", "Small");
+            targetsDirectory.Write("Large.txt", new string('a', 4096));
+
+            TestAnalyzeOptions options = CreateOptions();
+            options.TargetFileSpecifiers = new[] { Path.Combine(targetsDirectory.Name, "*.txt") };
+
+            List<Uri> Scan(long ruleParallelismThresholdInKilobytes)
+            {
+                var logger = new ResultRecordingLogger();
+                var context = new TestAnalysisContext { Logger = logger };
+                var command = new AnalysisCountingCommand();
+
+                options.RuleParallelismThresholdInKilobytes = ruleParallelismThresholdInKilobytes;
+                command.Run(options, ref context).Should().Be(CommandBase.SUCCESS);
+                return logger.ResultUris;
+            }
+
+            List<Uri> serialResultUris = Scan(ruleParallelismThresholdInKilobytes: 0);
+            List<Uri> parallelResultUris = Scan(ruleParallelismThresholdInKilobytes: 1);
+
+            serialResultUris.Should().NotBeEmpty();
+            parallelResultUris.Should().Equal(serialResultUris);
+        }
+
+        [Fact]
+        public void AnalyzeTargetInParallel_RulesReadTheTargetsContentsConcurrently()
+        {
+            string contents = new string('a', 4096);
+
+            for (int i = 0; i < 50; i++)
+            {
+                // A caller-provided stream can only be consumed once, by whichever rule reads the contents first.
+                var target = new EnumeratedArtifact(Sarif.FileSystem.Instance)
+                {
+                    Uri = new Uri(Path.Combine(Path.GetTempPath(), $"{Guid.NewGuid():N}.txt")),
+                    Stream = new MemoryStream(Encoding.UTF8.GetBytes(contents)),
+                };
+
+                var context = new TestAnalysisContext { CurrentTarget = target, Threads = 4 };
+                context.Logger = new CachingLogger(context.FailureLevels, context.ResultKinds);
+
+                var skimmers = Enumerable.Range(0, 4).Select(id => new ContentsReadingSkimmer($"TEST{id}")).ToList();
+
+                MultithreadedAnalyzeCommandBase<TestAnalysisContext, TestAnalyzeOptions>.AnalyzeTargetInParallel(
+                    context, skimmers, new HashSet<string>());
+
+                context.RuntimeExceptions.Should().BeNull();
+                skimmers.Select(skimmer => skimmer.ContentsRead).Should().OnlyContain(read => read == contents);
+            }
+        }
+
         private static TestAnalyzeOptions CreateOptions()
         {
             return new TestAnalyzeOptions
@@ -67,6 +212,151 @@ namespace Microsoft.CodeAnalysis.Sarif.Driver
         private static Assembly[] TestPluginAssemblies
             => new[] { typeof(MultithreadedAnalyzeCommandBaseConcurrencyTests).Assembly };
 
+        /// <summary>
+        /// Stalls analysis of the first target enumerated, so that every other worker races
+        /// ahead of the (ordered) logging of results.
+        /// </summary>
+        private sealed class SlowFirstTargetCommand : TestMultithreadedAnalyzeCommand
+        {
+            private readonly BufferProbingLogger logger;
+
+            internal SlowFirstTargetCommand(BufferProbingLogger logger)
+                : base(Sarif.FileSystem.Instance)
+            {
+                this.logger = logger;
+                DefaultPluginAssemblies = TestPluginAssemblies;
+            }
+
+            protected override TestAnalysisContext DetermineApplicabilityAndAnalyze(
+                TestAnalysisContext context,
+                IEnumerable<Skimmer<TestAnalysisContext>> skimmers,
+                ISet<string> disabledSkimmers)
+            {
+                if (context.CurrentTarget.Uri == this.logger.FirstTargetUri)
+                {
+                    Thread.Sleep(250);
+                }
+
+                return base.DetermineApplicabilityAndAnalyze(context, skimmers, disabledSkimmers);
+            }
+        }
+
+        private sealed class ContentsReadingSkimmer : TestSkimmerBase
+        {
+            private readonly string id;
+
+            internal ContentsReadingSkimmer(string id)
+            {
+                this.id = id;
+            }
+
+            public override string Id => this.id;
+
+            internal string ContentsRead { get; private set; }
+
+            public override void Analyze(TestAnalysisContext context)
+            {
+                ContentsRead = context.CurrentTarget.Contents;
+            }
+        }
+
+        private sealed class AnalysisCountingCommand : TestMultithreadedAnalyzeCommand
+        {
+            private int targetsAnalyzed;
+
+            internal AnalysisCountingCommand()
+                : base(Sarif.FileSystem.Instance)
+            {
+                DefaultPluginAssemblies = TestPluginAssemblies;
+            }
+
+            internal int TargetsAnalyzed => this.targetsAnalyzed;
+
+            protected override TestAnalysisContext DetermineApplicabilityAndAnalyze(
+                TestAnalysisContext context,
+                IEnumerable<Skimmer<TestAnalysisContext>> skimmers,
+                ISet<string> disabledSkimmers)
+            {
+                Interlocked.Increment(ref this.targetsAnalyzed);
+                return base.DetermineApplicabilityAndAnalyze(context, skimmers, disabledSkimmers);
+            }
+        }
+
+        /// <summary>
+        /// Records the artifact location of every result logged (which is single-threaded).
+        /// </summary>
+        private sealed class ResultRecordingLogger : IAnalysisLogger
+        {
+            public FileRegionsCache FileRegionsCache { get; set; }
+
+            public List<Uri> ResultUris { get; } = new List<Uri>();
+
+            public void AnalyzingTarget(IAnalysisContext context) { }
+
+            public void TargetAnalyzed(IAnalysisContext context) { }
+
+            public void AnalysisStarted() { }
+
+            public void AnalysisStopped(RuntimeConditions runtimeConditions) { }
+
+            public void Log(ReportingDescriptor rule, Result result, int? extensionIndex = null)
+            {
+                ResultUris.Add(result.Locations[0].PhysicalLocation.ArtifactLocation.Uri);
+            }
+
+            public void LogToolNotification(Notification notification, ReportingDescriptor associatedRule = null) { }
+
+            public void LogConfigurationNotification(Notification notification) { }
+        }
+
+        /// <summary>
+        /// Tracks how many targets have been enumerated (AnalyzingTarget) but not yet logged
+        /// (TargetAnalyzed).
+        /// </summary>
+        private sealed class BufferProbingLogger : IAnalysisLogger
+        {
+            private int targetsBuffered;
+            private int maxTargetsBuffered;
+            private int targetsLogged;
+
+            public FileRegionsCache FileRegionsCache { get; set; }
+
+            public Uri FirstTargetUri { get; private set; }
+
+            public int MaxTargetsBuffered => this.maxTargetsBuffered;
+
+            public int TargetsLogged => this.targetsLogged;
+
+            public void AnalyzingTarget(IAnalysisContext context)
+            {
+                FirstTargetUri ??= context.CurrentTarget.Uri;
+
+                int buffered = Interlocked.Increment(ref this.targetsBuffered);
+
+                int max;
+                while (buffered > (max = this.maxTargetsBuffered) &&
+                       Interlocked.CompareExchange(ref this.maxTargetsBuffered, buffered, max) != max)
+                {
+                }
+            }
+
+            public void TargetAnalyzed(IAnalysisContext context)
+            {
+                Interlocked.Decrement(ref this.targetsBuffered);
+                Interlocked.Increment(ref this.targetsLogged);
+            }
+
+            public void AnalysisStarted() { }
+
+            public void AnalysisStopped(RuntimeConditions runtimeConditions) { }
+
+            public void Log(ReportingDescriptor rule, Result result, int? extensionIndex = null) { }
+
+            public void LogToolNotification(Notification notification, ReportingDescriptor associatedRule = null) { }
+
+            public void LogConfigurationNotification(Notification notification) { }
+        }
+
         /// <summary>
         /// Tags every scan target with a distinct non-fatal runtime condition, so that a merge
         /// which overwrites another is observable as a dropped flag rather than an idempotent
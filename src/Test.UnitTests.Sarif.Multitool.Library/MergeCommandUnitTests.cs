@@ -230,7 +230,41 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             mergedLog.Runs[0].Results.Count.Should().Be(15);
         }
 
+        [Fact]
+        public void MergeCommand_Streaming_ProducesSameRunsAsInMemoryMerge()
+        {
+            var sarifLog1 = new SarifLog { Runs = new[] { CreateTestRun(5, ruleIdPrefix: "ALPHA"), CreateTestRun(3, toolName: "OtherTool") } };
+            var sarifLog2 = new SarifLog { Runs = new[] { CreateTestRun(6, ruleIdPrefix: "BETA"), CreateTestRun(5, ruleIdPrefix: "ALPHA") } };
+            var sarifLog3 = new SarifLog { Runs = new[] { CreateEnrichedSubIdRun(tag: "x") } };
+
+            // Value-identical results whose property bags list their properties in a different order.
+            var sarifLog4 = new SarifLog { Runs = new[] { CreatePropertyBagRun(reversePropertyOrder: false) } };
+            var sarifLog5 = new SarifLog { Runs = new[] { CreatePropertyBagRun(reversePropertyOrder: true) } };
+
+            SarifLog inMemoryLog = RunMerge(streaming: false, sarifLog1, sarifLog2, sarifLog3, sarifLog4, sarifLog5);
+            SarifLog streamedLog = RunMerge(streaming: true, sarifLog1, sarifLog2, sarifLog3, sarifLog4, sarifLog5);
+
+            inMemoryLog.Runs.Single(run => run.Tool.Driver.Name == "PropertyBagTool").Results.Count.Should().Be(2);
+            streamedLog.Runs.Count.Should().Be(inMemoryLog.Runs.Count);
+
+            for (int i = 0; i < inMemoryLog.Runs.Count; i++)
+            {
+                Run expected = inMemoryLog.Runs[i];
+                Run actual = streamedLog.Runs[i];
+
+                actual.Tool.Driver.Name.Should().Be(expected.Tool.Driver.Name);
+                actual.Tool.Driver.Rules.Count.Should().Be(expected.Tool.Driver.Rules.Count);
+                actual.Results.Count.Should().Be(expected.Results.Count);
+                JsonConvert.SerializeObject(actual.Results).Should().Be(JsonConvert.SerializeObject(expected.Results));
+            }
+        }
+
         private SarifLog RunMerge(params SarifLog[] inputLogs)
+        {
+            return RunMerge(streaming: false, inputLogs);
+        }
+
+        private SarifLog RunMerge(bool streaming, params SarifLog[] inputLogs)
         {
             var mockFileSystem = new Mock<IFileSystem>();
             var inputFilePaths = new List<string>();
@@ -248,6 +282,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
 
             ArrangeMockFileSystemCreate(mockFileSystem, outputFilePath, outputStringBuilder);
             ArrangeMockFileSystemEnumerate(mockFileSystem, testDirectory, inputFilePaths);
+            ArrangeMockFileSystemSpill(mockFileSystem);
 
             IFileSystem fileSystem = mockFileSystem.Object;
 
@@ -257,6 +292,7 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
                 OutputFileName = "merged.sarif",
                 TargetFileSpecifiers = new[] { "*.sarif" },
                 OutputFileOptions = new[] { FilePersistenceOptions.ForceOverwrite, FilePersistenceOptions.PrettyPrint },
+                Streaming = streaming,
             };
 
             var mergeCommand = new MergeCommand(fileSystem);
@@ -335,6 +371,30 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             };
         }
 
+        private static Run CreatePropertyBagRun(bool reversePropertyOrder)
+        {
+            var results = new List<Result>();
+
+            for (int i = 0; i < 2; i++)
+            {
+                var result = new Result { RuleId = "TESTRULE001", Message = new Message { Text = $"Result {i}" } };
+                string[] names = reversePropertyOrder ? new[] { "beta", "alpha" } : new[] { "alpha", "beta" };
+
+                foreach (string name in names)
+                {
+                    result.SetProperty(name, name.Length + i);
+                }
+
+                results.Add(result);
+            }
+
+            return new Run
+            {
+                Tool = new Tool { Driver = new ToolComponent { Name = "PropertyBagTool", Version = "1.0.0" } },
+                Results = results,
+            };
+        }
+
         private static void ArrangeMockFileSystemRead(Mock<IFileSystem> mockFileSystem, string sarifLogJson, string sariflogFilePath)
         {
             mockFileSystem.Setup(x => x.DirectoryExists(Path.GetDirectoryName(sariflogFilePath))).Returns(true);
@@ -348,6 +408,21 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             mockFileSystem.Setup(x => x.FileCreate(sariflogFilePath)).Returns(() => new MemoryStreamToStringBuilder(outputStream));
         }
 
+        private static void ArrangeMockFileSystemSpill(Mock<IFileSystem> mockFileSystem)
+        {
+            // Streaming merges spill results to temporary '.jsonl' files, which are held in memory here.
+            var spills = new Dictionary<string, StringBuilder>();
+
+            mockFileSystem.Setup(x => x.FileCreate(It.Is<string>(path => path.EndsWith(".jsonl"))))
+                .Returns((string path) => new MemoryStreamToStringBuilder(spills[path] = new StringBuilder()));
+            mockFileSystem.Setup(x => x.FileOpenRead(It.Is<string>(path => path.EndsWith(".jsonl"))))
+                .Returns((string path) => new MemoryStream(Encoding.UTF8.GetBytes(spills[path].ToString())));
+            mockFileSystem.Setup(x => x.FileExists(It.Is<string>(path => path.EndsWith(".jsonl"))))
+                .Returns((string path) => spills.ContainsKey(path));
+            mockFileSystem.Setup(x => x.FileDelete(It.Is<string>(path => path.EndsWith(".jsonl"))))
+                .Callback((string path) => spills.Remove(path));
+        }
+
         private static void ArrangeMockFileSystemEnumerate(Mock<IFileSystem> mockFileSystem, string targetDirectory, IEnumerable<string> files)
         {
             mockFileSystem.Setup(x => x.DirectoryExists(Path.GetDirectoryName(targetDirectory))).Returns(true);
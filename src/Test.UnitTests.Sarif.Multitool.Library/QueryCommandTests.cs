@@ -58,6 +58,44 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             Assert.Equal(expected, actual);
         }
 
+        [Fact]
+        public void QueryCommand_UseIndex()
+        {
+            string filePath = "elfie-arriba.indexed.sarif";
+            string indexPath = "elfie-arriba.indexed.index.json";
+            File.WriteAllText(filePath, s_extractor.GetResourceText("elfie-arriba.sarif"));
+            File.Delete(indexPath);
+
+            // First query builds and saves the index
+            RunAndVerifyCount(5, new QueryOptions() { Expression = "", InputFilePath = filePath, UseIndex = true });
+            Assert.True(File.Exists(indexPath));
+
+            // Later queries are answered from the saved index
+            RunAndVerifyCount(2, new QueryOptions() { Expression = "Uri >| test_key.pem || Uri >| test_rsa_privkey.pem", InputFilePath = filePath, UseIndex = true });
+            RunAndVerifyCount(1, new QueryOptions() { Expression = "RuleId = 'CSCAN0020/0'", InputFilePath = filePath, UseIndex = true });
+            RunAndVerifyCount(4, new QueryOptions() { Expression = "RuleId = 'CSCAN0060/0'", InputFilePath = filePath, UseIndex = true });
+            RunAndVerifyCount(1, new QueryOptions() { Expression = "Level != Error && RuleId = CSCAN0060/0", InputFilePath = filePath, UseIndex = true });
+            RunAndVerifyCount(1, new QueryOptions() { Expression = "IsSuppressed == True && RuleId = CSCAN0060/0", InputFilePath = filePath, UseIndex = true });
+            RunAndVerifyCount(0, new QueryOptions() { Expression = "Level != Error && RuleId != CSCAN0060/0", InputFilePath = filePath, UseIndex = true });
+
+            // Properties not in the index fall back to reading the log, and match as without the index
+            // (Results in this log have no message, so message.text reads as empty.)
+            RunAndVerifyCount(5, new QueryOptions() { Expression = "message.text = ''", InputFilePath = filePath });
+            RunAndVerifyCount(5, new QueryOptions() { Expression = "message.text = ''", InputFilePath = filePath, UseIndex = true });
+            RunAndVerifyCount(3, new QueryOptions() { Expression = "message.text = '' && Level = Error && RuleId = CSCAN0060/0", InputFilePath = filePath });
+            RunAndVerifyCount(3, new QueryOptions() { Expression = "message.text = '' && Level = Error && RuleId = CSCAN0060/0", InputFilePath = filePath, UseIndex = true });
+            RunAndVerifyCount(0, new QueryOptions() { Expression = "message.text : PEM", InputFilePath = filePath, UseIndex = true });
+            Assert.Throws<QueryParseException>(() => RunAndVerifyCount(0, new QueryOptions() { Expression = "Leveler != Error", InputFilePath = filePath, UseIndex = true }));
+
+            // Matching Results read via the index are written exactly as when the whole log is read
+            string outputFilePath = "elfie-arriba.CSCAN0020.indexed.actual.sarif";
+            RunAndVerifyCount(1, new QueryOptions() { Expression = "RuleId = 'CSCAN0020/0'", InputFilePath = filePath, OutputFilePath = outputFilePath, Minify = false, Force = true, UseIndex = true });
+
+            string expected = s_extractor.GetResourceText("elfie-arriba.CSCAN0020.sarif");
+            string actual = File.ReadAllText(outputFilePath);
+            Assert.Equal(expected, actual);
+        }
+
         [Fact]
         public void QueryCommand_Properties()
         {
@@ -2,12 +2,17 @@
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
 using System;
+using System.Collections.Generic;
+using System.Linq;
 using System.Text;
+using System.Threading;
 
 using FluentAssertions;
 
 using Microsoft.CodeAnalysis.Sarif.Multitool.Rules;
 
+using Newtonsoft.Json;
+
 using Xunit;
 
 namespace Microsoft.CodeAnalysis.Sarif.Multitool
@@ -201,5 +206,117 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             run.SetProperty("ai/origin", " ");
             SarifValidationSkimmerBase.IsAIOriginRun(run).Should().BeFalse();
         }
+
+        [Fact]
+        public void SarifValidationSkimmerBase_AnalyzeInSinglePass_LogsSameResultsAsAnalyzingEachRuleInTurn()
+        {
+            // Each result violates both rules, so a single walk that logged results in node order
+            // would interleave them; the expected order is all of one rule's results, then the other's.
+            string logContents = CreateLogViolatingBothRules();
+
+            var expectedLogger = new TestMessageLogger();
+            SarifValidationContext context = CreateValidationContext(logContents, expectedLogger);
+            foreach (SarifValidationSkimmerBase skimmer in CreateSkimmers())
+            {
+                context.Rule = skimmer;
+                skimmer.Analyze(context);
+            }
+
+            var actualLogger = new TestMessageLogger();
+            context = CreateValidationContext(logContents, actualLogger);
+            SarifValidationSkimmerBase.AnalyzeInSinglePass(context, CreateSkimmers(), new HashSet<string>());
+
+            actualLogger.Results.Should().HaveCount(6);
+            actualLogger.Results.Select(DescribeResult).Should().Equal(expectedLogger.Results.Select(DescribeResult));
+            context.Logger.Should().BeSameAs(actualLogger);
+        }
+
+        [Fact]
+        public void SarifValidationSkimmerBase_AnalyzeInSinglePass_MeasuresRuleScanTimesOnlyWhenRequested()
+        {
+            string logContents = CreateLogViolatingBothRules();
+
+            SarifValidationContext context = CreateValidationContext(logContents, new TestMessageLogger());
+            SarifValidationSkimmerBase.AnalyzeInSinglePass(context, CreateSkimmers(), new HashSet<string>()).Should().BeNull();
+
+            context = CreateValidationContext(logContents, new TestMessageLogger());
+            TimeSpan[] ruleScanTimes = SarifValidationSkimmerBase.AnalyzeInSinglePass(context,
+                                                                                      CreateSkimmers(),
+                                                                                      new HashSet<string>(),
+                                                                                      measureRuleScanTimes: true);
+
+            ruleScanTimes.Should().HaveCount(2);
+            ruleScanTimes.Should().OnlyContain(elapsed => elapsed >= TimeSpan.Zero);
+        }
+
+        [Fact]
+        public void SarifValidationSkimmerBase_AnalyzeInSinglePass_ObservesCancellation()
+        {
+            var logger = new TestMessageLogger();
+            SarifValidationContext context = CreateValidationContext(CreateLogViolatingBothRules(), logger);
+            context.CancellationToken = new CancellationToken(canceled: true);
+
+            Action action = () => SarifValidationSkimmerBase.AnalyzeInSinglePass(context, CreateSkimmers(), new HashSet<string>());
+
+            action.Should().Throw<OperationCanceledException>();
+            logger.Results.Should().BeNullOrEmpty();
+        }
+
+        private static string CreateLogViolatingBothRules()
+        {
+            var results = new List<Result>();
+            for (int i = 0; i < 3; i++)
+            {
+                results.Add(new Result
+                {
+                    Message = new Message { Text = "Message." },
+                    Locations = new[]
+                    {
+                        new Location
+                        {
+                            PhysicalLocation = new PhysicalLocation
+                            {
+                                ArtifactLocation = new ArtifactLocation { Uri = new Uri("src/file.c", UriKind.Relative) },
+                                Region = new Region { StartLine = 10 + i, EndLine = 1 }
+                            }
+                        }
+                    }
+                });
+            }
+
+            var log = new SarifLog
+            {
+                Runs = new[]
+                {
+                    new Run
+                    {
+                        Tool = new Tool { Driver = new ToolComponent { Name = "TestTool" } },
+                        Results = results
+                    }
+                }
+            };
+
+            return JsonConvert.SerializeObject(log, Formatting.Indented);
+        }
+
+        private static IList<SarifValidationSkimmerBase> CreateSkimmers()
+            => new SarifValidationSkimmerBase[] { new RuleIdMustBeConsistent(), new RegionPropertiesMustBeConsistent() };
+
+        private static SarifValidationContext CreateValidationContext(string logContents, IAnalysisLogger logger)
+        {
+            return new SarifValidationContext
+            {
+                CurrentTarget = new EnumeratedArtifact(FileSystem.Instance) { Uri = new Uri(@"c:\logs\test.sarif") },
+                InputLogContents = logContents,
+                InputLog = JsonConvert.DeserializeObject<SarifLog>(logContents),
+                Logger = logger
+            };
+        }
+
+        private static string DescribeResult(Tuple<ReportingDescriptor, Result> tuple)
+        {
+            Result result = tuple.Item2;
+            return $"{result.RuleId}:{result.Message.Id}:{string.Join(",", result.Message.Arguments)}";
+        }
     }
 }
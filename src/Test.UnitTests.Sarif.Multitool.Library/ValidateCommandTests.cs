@@ -3,6 +3,7 @@
 
 using System.Collections.Generic;
 using System.IO;
+using System.Linq;
 using System.Text;
 
 using FluentAssertions;
@@ -138,6 +139,106 @@ namespace Microsoft.CodeAnalysis.Sarif.Multitool
             sarifLog.Runs[0].Results.Count.Should().Be(1);
         }
 
+        [Fact]
+        public void ValidateCommand_Streaming_ProducesSameResultsAsInMemoryValidation()
+        {
+            string path = "ValidateStreaming.sarif";
+            File.WriteAllText(path, LogWithInvalidResultsText);
+
+            SarifLog inMemoryLog = ExecuteValidation(path, "ValidateInMemoryOutput.sarif", streaming: false);
+            SarifLog streamingLog = ExecuteValidation(path, "ValidateStreamingOutput.sarif", streaming: true);
+
+            List<string> inMemoryResults = inMemoryLog.Runs[0].Results.Select(DescribeResult).ToList();
+            List<string> streamingResults = streamingLog.Runs[0].Results.Select(DescribeResult).ToList();
+
+            // One schema violation (in the first result) and one rule violation (in the second).
+            inMemoryResults.Should().Contain(r => r.StartsWith("JSON"));
+            inMemoryResults.Should().Contain(r => r.StartsWith("SARIF1007"));
+            streamingResults.Should().BeEquivalentTo(inMemoryResults);
+        }
+
+        private const string LogWithInvalidResultsText =
+@"{
+  ""$schema"": ""https://schemastore.azurewebsites.net/schemas/json/sarif-2.1.0-rtm.6.json"",
+  ""version"": ""2.1.0"",
+  ""runs"": [
+    {
+      ""tool"": {
+        ""driver"": {
+          ""name"": ""TestTool""
+        }
+      },
+      ""results"": [
+        {
+          ""ruleId"": ""TEST0001"",
+          ""message"": {
+            ""text"": ""A result whose region violates the schema.""
+          },
+          ""locations"": [
+            {
+              ""physicalLocation"": {
+                ""artifactLocation"": {
+                  ""uri"": ""file:///c:/src/a.cs""
+                },
+                ""region"": {
+                  ""startLine"": 0
+                }
+              }
+            }
+          ]
+        },
+        {
+          ""ruleId"": ""TEST0001"",
+          ""message"": {
+            ""text"": ""A result whose region is inconsistent.""
+          },
+          ""locations"": [
+            {
+              ""physicalLocation"": {
+                ""artifactLocation"": {
+                  ""uri"": ""file:///c:/src/b.cs""
+                },
+                ""region"": {
+                  ""startLine"": 5,
+                  ""endLine"": 2
+                }
+              }
+            }
+          ]
+        }
+      ]
+    }
+  ]
+}";
+
+        private static SarifLog ExecuteValidation(string path, string outputPath, bool streaming)
+        {
+            var options = new ValidateOptions
+            {
+                TargetFileSpecifiers = new string[] { path },
+                OutputFilePath = outputPath,
+                OutputFileOptions = new[] { FilePersistenceOptions.ForceOverwrite },
+                Streaming = streaming,
+                Kind = new List<ResultKind> { ResultKind.Fail },
+                Level = new List<FailureLevel> { FailureLevel.Warning, FailureLevel.Error }
+            };
+
+            var context = new SarifValidationContext { FileSystem = FileSystem.Instance };
+            new ValidateCommand().Run(options, ref context);
+            (context.RuntimeErrors & ~RuntimeConditions.Nonfatal).Should().Be(0);
+
+            return SarifLog.Load(outputPath);
+        }
+
+        private static string DescribeResult(Result result)
+        {
+            Region region = result.Locations?.FirstOrDefault()?.PhysicalLocation?.Region;
+
+            return $"{result.RuleId} " +
+                   $"[{string.Join(", ", result.Message.Arguments ?? new List<string>())}] " +
+                   $"({region?.StartLine},{region?.StartColumn})";
+        }
+
         private static SarifLog ExecuteTest(string path, string outputPath, string configuration = null)
         {
             var options = new ValidateOptions
@@ -0,0 +1,184 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Text;
+
+using FluentAssertions;
+
+using Moq;
+
+using Xunit;
+
+namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching.ExactMatchers
+{
+    public class BaselineCacheResultMatcherTests
+    {
+        private const string UnchangedUri = "file:///src/unchanged.cs";
+        private const string ChangedUri = "file:///src/changed.cs";
+
+        [Fact]
+        public void BaselineCacheResultMatcher_MatchesResultsInUnchangedArtifactsOnly()
+        {
+            Run previousRun = CreateRun(changedFileHash: "BBBB", (UnchangedUri, 10), (UnchangedUri, 20), (ChangedUri, 30));
+            Run currentRun = CreateRun(changedFileHash: "CCCC", (UnchangedUri, 20), (UnchangedUri, 10), (ChangedUri, 30));
+
+            BaselineCache cache = BaselineCache.Create(new SarifLog { Runs = new[] { previousRun } });
+            var matcher = new BaselineCacheResultMatcher(cache);
+
+            IList<MatchedResults> matchedResults = matcher.Match(Extract(previousRun), Extract(currentRun));
+
+            // Only the Results in the unchanged file are carried forward, each to the Result at the same line.
+            matchedResults.Should().HaveCount(2);
+            foreach (MatchedResults match in matchedResults)
+            {
+                match.PreviousResult.Result.Locations[0].PhysicalLocation.Region.StartLine
+                    .Should().Be(match.CurrentResult.Result.Locations[0].PhysicalLocation.Region.StartLine);
+                match.CurrentResult.Result.Locations[0].PhysicalLocation.ArtifactLocation.Uri.OriginalString.Should().Be(UnchangedUri);
+            }
+        }
+
+        [Fact]
+        public void BaselineCacheResultMatcher_DoesNotMatchWhenResultCountChanged()
+        {
+            Run previousRun = CreateRun(changedFileHash: "BBBB", (UnchangedUri, 10), (UnchangedUri, 20));
+            Run currentRun = CreateRun(changedFileHash: "BBBB", (UnchangedUri, 10));
+
+            BaselineCache cache = BaselineCache.Create(new SarifLog { Runs = new[] { previousRun } });
+            var matcher = new BaselineCacheResultMatcher(cache);
+
+            matcher.Match(Extract(previousRun), Extract(currentRun)).Should().BeEmpty();
+        }
+
+        [Fact]
+        public void BaselineCache_RoundTripsThroughAFile()
+        {
+            Run previousRun = CreateRun(changedFileHash: "BBBB", (UnchangedUri, 10), (ChangedUri, 30));
+            BaselineCache cache = BaselineCache.Create(new SarifLog { Runs = new[] { previousRun } });
+
+            var files = new Dictionary<string, string>();
+            IFileSystem fileSystem = CreateFileSystem(files);
+            string path = Path.Combine(Path.GetTempPath(), "previous.baselinecache.json");
+
+            cache.Save(path, fileSystem);
+            files.Should().ContainKey(path);
+
+            BaselineCache loaded = BaselineCache.Load(path, fileSystem);
+
+            loaded.Count.Should().Be(2);
+            new BaselineCacheResultMatcher(loaded).Match(Extract(previousRun), Extract(previousRun)).Should().HaveCount(2);
+        }
+
+        [Fact]
+        public void BaselineCacheResultMatcher_HashesRelativeUrisThroughOriginalUriBaseIds()
+        {
+            string root = Path.Combine(Path.GetTempPath(), "BaselineCacheRoot");
+            string unchangedPath = Path.Combine(root, "src", "unchanged.cs");
+            string changedPath = Path.Combine(root, "src", "changed.cs");
+
+            var files = new Dictionary<string, string>
+            {
+                [unchangedPath] = "class Unchanged { }",
+                [changedPath] = "class Changed { }",
+            };
+            IFileSystem fileSystem = CreateFileSystem(files);
+
+            Run previousRun = CreateRelativeRun(root, ("src/unchanged.cs", 10), ("src/changed.cs", 30));
+            BaselineCache cache = BaselineCache.Create(new SarifLog { Runs = new[] { previousRun } }, fileSystem);
+            cache.Count.Should().Be(2, "both relative Uris resolve under SRCROOT to files that can be hashed");
+
+            files[changedPath] = "class Changed { int i; }";
+
+            Run currentRun = CreateRelativeRun(root, ("src/unchanged.cs", 10), ("src/changed.cs", 30));
+            IList<MatchedResults> matchedResults = new BaselineCacheResultMatcher(cache, fileSystem).Match(Extract(previousRun), Extract(currentRun));
+
+            matchedResults.Should().ContainSingle();
+            matchedResults[0].CurrentResult.Result.Locations[0].PhysicalLocation.ArtifactLocation.Uri.OriginalString.Should().Be("src/unchanged.cs");
+        }
+
+        private static IFileSystem CreateFileSystem(Dictionary<string, string> files)
+        {
+            var fileSystem = new Mock<IFileSystem>();
+            fileSystem.Setup(fs => fs.FileExists(It.IsAny<string>())).Returns<string>(path => files.ContainsKey(path));
+            fileSystem.Setup(fs => fs.FileReadAllText(It.IsAny<string>())).Returns<string>(path => files[path]);
+            fileSystem.Setup(fs => fs.FileWriteAllText(It.IsAny<string>(), It.IsAny<string>())).Callback<string, string>((path, text) => files[path] = text);
+            fileSystem.Setup(fs => fs.FileOpenRead(It.IsAny<string>())).Returns<string>(path => new MemoryStream(Encoding.UTF8.GetBytes(files[path])));
+            return fileSystem.Object;
+        }
+
+        private static List<ExtractedResult> Extract(Run run)
+        {
+            return run.Results.Select(result => new ExtractedResult(result, run)).ToList();
+        }
+
+        private static Run CreateRelativeRun(string root, params (string uri, int line)[] results)
+        {
+            return new Run
+            {
+                Tool = new Tool { Driver = new ToolComponent { Name = "Test" } },
+                OriginalUriBaseIds = new Dictionary<string, ArtifactLocation>
+                {
+                    ["SRCROOT"] = new ArtifactLocation { Uri = new Uri(new Uri(root + Path.DirectorySeparatorChar).AbsoluteUri) }
+                },
+                Results = results.Select(r => new Result
+                {
+                    RuleId = "TEST001",
+                    CorrelationGuid = Guid.NewGuid(),
+                    Message = new Message { Text = "Issue" },
+                    Locations = new[]
+                    {
+                        new Location
+                        {
+                            PhysicalLocation = new PhysicalLocation
+                            {
+                                ArtifactLocation = new ArtifactLocation { Uri = new Uri(r.uri, UriKind.Relative), UriBaseId = "SRCROOT" },
+                                Region = new Region { StartLine = r.line }
+                            }
+                        }
+                    }
+                }).ToList()
+            };
+        }
+
+        private static Run CreateRun(string changedFileHash, params (string uri, int line)[] results)
+        {
+            return new Run
+            {
+                Tool = new Tool { Driver = new ToolComponent { Name = "Test" } },
+                Artifacts = new List<Artifact>
+                {
+                    new Artifact
+                    {
+                        Location = new ArtifactLocation { Uri = new Uri(UnchangedUri) },
+                        Hashes = new Dictionary<string, string> { ["sha-256"] = "AAAA" }
+                    },
+                    new Artifact
+                    {
+                        Location = new ArtifactLocation { Uri = new Uri(ChangedUri) },
+                        Hashes = new Dictionary<string, string> { ["sha-256"] = changedFileHash }
+                    },
+                },
+                Results = results.Select(r => new Result
+                {
+                    RuleId = "TEST001",
+                    CorrelationGuid = Guid.NewGuid(),
+                    Message = new Message { Text = "Issue" },
+                    Locations = new[]
+                    {
+                        new Location
+                        {
+                            PhysicalLocation = new PhysicalLocation
+                            {
+                                ArtifactLocation = new ArtifactLocation { Uri = new Uri(r.uri) },
+                                Region = new Region { StartLine = r.line }
+                            }
+                        }
+                    }
+                }).ToList()
+            };
+        }
+    }
+}
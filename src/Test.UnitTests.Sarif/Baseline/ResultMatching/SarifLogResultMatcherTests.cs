@@ -3,10 +3,18 @@
 
 using System;
 using System.Collections.Generic;
+using System.IO;
 using System.Linq;
+using System.Text;
 
 using FluentAssertions;
 
+using Microsoft.CodeAnalysis.Sarif.Readers;
+
+using Moq;
+
+using Newtonsoft.Json;
+
 using Xunit;
 using Xunit.Abstractions;
 
@@ -438,6 +446,109 @@ namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching
             versionControlList.Contains(versionControl3, VersionControlDetails.ValueComparer).Should().BeTrue();
         }
 
+        [Fact]
+        public void SarifLogResultMatcher_StreamingMatch_MatchesLikeNonStreaming()
+        {
+            Random random = RandomSarifLogGenerator.GenerateRandomAndLog(this.output);
+            SarifLog baselineLog = RandomSarifLogGenerator.GenerateSarifLogWithRuns(random, 1);
+            SarifLog currentLog = baselineLog.DeepClone();
+
+            foreach (Result result in baselineLog.Runs[0].Results)
+            {
+                result.CorrelationGuid = Guid.NewGuid();
+            }
+
+            // Drop one Result and change another, so the log has Absent and New Results too.
+            if (currentLog.Runs[0].Results.Count > 1)
+            {
+                currentLog.Runs[0].Results.RemoveAt(0);
+                currentLog.Runs[0].Results[0].Guid = Guid.NewGuid();
+                currentLog.Runs[0].Results[0].Message = new Message { Text = "Changed" };
+            }
+
+            string baselineFilePath = Path.Combine(Path.GetTempPath(), "baseline.sarif");
+            string currentFilePath = Path.Combine(Path.GetTempPath(), "current.sarif");
+
+            var mockFileSystem = new Mock<IFileSystem>();
+            mockFileSystem.Setup(x => x.FileOpenRead(baselineFilePath)).Returns(() => new MemoryStream(Encoding.UTF8.GetBytes(JsonConvert.SerializeObject(baselineLog)), writable: false));
+            mockFileSystem.Setup(x => x.FileOpenRead(currentFilePath)).Returns(() => new MemoryStream(Encoding.UTF8.GetBytes(JsonConvert.SerializeObject(currentLog)), writable: false));
+
+            // The streaming matcher reads both logs back through deferred collections, as ResultMatchingCommand does.
+            using (var baselineFile = new MemoryMappedStreamProvider(baselineFilePath, mockFileSystem.Object))
+            using (var currentFile = new MemoryMappedStreamProvider(currentFilePath, mockFileSystem.Object))
+            {
+                ISarifLogMatcher matcher = ResultMatchingBaselinerFactory.GetDefaultResultMatchingBaseliner();
+                SarifLog expected = matcher.Match(new[] { baselineLog }, new[] { currentLog }).First();
+
+                IStreamingSarifLogMatcher streamingMatcher = ResultMatchingBaselinerFactory.GetStreamingResultMatchingBaseliner();
+
+                var text = new StringWriter();
+                using (var writer = new JsonTextWriter(text))
+                {
+                    streamingMatcher.Match(SarifLog.LoadDeferred(baselineFile), SarifLog.LoadDeferred(currentFile), writer);
+                }
+
+                SarifLog actual = JsonConvert.DeserializeObject<SarifLog>(text.ToString());
+
+                IList<Result> expectedResults = expected.Runs[0].Results;
+                IList<Result> actualResults = actual.Runs[0].Results ?? new List<Result>();
+
+                actualResults.Select(r => r.BaselineState).Should().Equal(expectedResults.Select(r => r.BaselineState));
+                actualResults.Select(r => r.ResolvedRuleId(actual.Runs[0])).Should().Equal(expectedResults.Select(r => r.ResolvedRuleId(expected.Runs[0])));
+
+                // New Results get fresh correlation Guids; every other Result carries its baseline's forward.
+                actualResults.Where(r => r.BaselineState != BaselineState.New).Select(r => r.CorrelationGuid)
+                    .Should().Equal(expectedResults.Where(r => r.BaselineState != BaselineState.New).Select(r => r.CorrelationGuid));
+
+                (actual.Runs[0].Artifacts?.Count ?? 0).Should().Be(expected.Runs[0].Artifacts?.Count ?? 0);
+            }
+        }
+
+        [Fact]
+        public void SarifLogResultMatcher_ParallelizeByTool_MatchesLikeSequential()
+        {
+            Random random = RandomSarifLogGenerator.GenerateRandomAndLog(this.output);
+            SarifLog baselineLog = RandomSarifLogGenerator.GenerateSarifLogWithRuns(random, 6);
+
+            for (int i = 0; i < baselineLog.Runs.Count; i++)
+            {
+                baselineLog.Runs[i].Tool.Driver.Name = "Tool" + (i % 4);
+            }
+
+            foreach (Result result in baselineLog.Runs.SelectMany(run => run.Results))
+            {
+                result.CorrelationGuid = Guid.NewGuid();
+            }
+
+            SarifLog currentLog = baselineLog.DeepClone();
+            foreach (Run run in currentLog.Runs.Where(run => run.Results.Count > 1))
+            {
+                run.Results.RemoveAt(0);
+                run.Results[0].Guid = Guid.NewGuid();
+                run.Results[0].Message = new Message { Text = "Changed" };
+            }
+
+            var sequentialMatcher = new SarifLogResultMatcher(
+                new[] { new V2ResultMatcher() }, null, DictionaryMergeBehavior.None, parallelizeByTool: false, maxDegreeOfParallelism: 0);
+            var parallelMatcher = new SarifLogResultMatcher(
+                new[] { new V2ResultMatcher() }, null, DictionaryMergeBehavior.None, parallelizeByTool: true, maxDegreeOfParallelism: 0);
+
+            SarifLog expected = sequentialMatcher.Match(new[] { baselineLog.DeepClone() }, new[] { currentLog.DeepClone() }).First();
+            SarifLog actual = parallelMatcher.Match(new[] { baselineLog.DeepClone() }, new[] { currentLog.DeepClone() }).First();
+
+            actual.Runs.Select(run => run.Tool.Driver.Name).Should().Equal(expected.Runs.Select(run => run.Tool.Driver.Name));
+
+            for (int i = 0; i < expected.Runs.Count; i++)
+            {
+                IList<Result> expectedResults = expected.Runs[i].Results;
+                IList<Result> actualResults = actual.Runs[i].Results;
+
+                actualResults.Select(r => r.BaselineState).Should().Equal(expectedResults.Select(r => r.BaselineState));
+                actualResults.Where(r => r.BaselineState != BaselineState.New).Select(r => r.CorrelationGuid)
+                    .Should().Equal(expectedResults.Where(r => r.BaselineState != BaselineState.New).Select(r => r.CorrelationGuid));
+            }
+        }
+
         private void SetPropertyOnAllResultObjects(SarifLog sarifLog, string propertyKey, string propertyValue)
         {
             foreach (Run run in sarifLog.Runs)
@@ -0,0 +1,56 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System.Collections.Generic;
+using System.Linq;
+
+using FluentAssertions;
+
+using Xunit;
+
+namespace Microsoft.CodeAnalysis.Sarif.Baseline.ResultMatching
+{
+    public class UnmatchedResultsTests
+    {
+        [Fact]
+        public void UnmatchedResults_ReturnsRemainingResultsInOrder()
+        {
+            var run = new Run();
+            List<ExtractedResult> baseline = CreateResults(run, 5);
+            List<ExtractedResult> current = CreateResults(run, 4);
+
+            var unmatched = new UnmatchedResults(baseline, current);
+            unmatched.Baseline.Should().Equal(baseline);
+            unmatched.Current.Should().Equal(current);
+
+            unmatched.MarkMatched(new MatchedResults(baseline[1], current[0]));
+            unmatched.MarkMatched(new MatchedResults(baseline[3], null));
+            unmatched.MarkMatched(new MatchedResults(null, current[2]));
+
+            unmatched.Baseline.Should().Equal(baseline[0], baseline[2], baseline[4]);
+            unmatched.Current.Should().Equal(current[1], current[3]);
+        }
+
+        [Fact]
+        public void UnmatchedResults_IgnoresRepeatedAndUnknownResults()
+        {
+            var run = new Run();
+            List<ExtractedResult> baseline = CreateResults(run, 3);
+            List<ExtractedResult> current = CreateResults(run, 3);
+
+            var unmatched = new UnmatchedResults(baseline, current);
+            unmatched.MarkMatched(new MatchedResults(baseline[0], current[0]));
+            unmatched.MarkMatched(new MatchedResults(baseline[0], CreateResults(run, 1)[0]));
+
+            unmatched.Baseline.Should().Equal(baseline[1], baseline[2]);
+            unmatched.Current.Should().Equal(current[1], current[2]);
+        }
+
+        private static List<ExtractedResult> CreateResults(Run run, int count)
+        {
+            return Enumerable.Range(0, count)
+                .Select(i => new ExtractedResult(new Result { RuleId = "TEST" + i }, run))
+                .ToList();
+        }
+    }
+}
@@ -88,6 +88,35 @@ namespace Microsoft.CodeAnalysis.Test.UnitTests.Sarif.Baseline
             matches.Where(m => m.PreviousResult == null || m.CurrentResult == null).Should().BeEmpty();
         }
 
+        [Fact]
+        public void V2ResultMatcher_PartitionByArtifact_MatchesLikeDefault()
+        {
+            Run newRun = SampleRun.DeepClone();
+            newRun.Results[2].Locations[0].PhysicalLocation.Region.StartLine += 1;
+            newRun.Results[4].Locations[0].PhysicalLocation.ArtifactLocation.Index = -1;
+            newRun.Results[4].Locations[0].PhysicalLocation.ArtifactLocation.Uri = new Uri("file:///C:/Code/elfie-arriba/XForm/XForm.Web/node_modules/RENAMED.pem");
+            newRun.Results = newRun.Results.Where((result, index) => index != 7).ToList();
+
+            var partitioningMatcher = new V2ResultMatcher(partitionByArtifact: true, maxDegreeOfParallelism: 4);
+
+            IList<string> expected = MatchedIndices(s_matcher, SampleRun, newRun);
+            IList<string> actual = MatchedIndices(partitioningMatcher, SampleRun, newRun);
+
+            actual.Should().BeEquivalentTo(expected);
+            actual.Count(match => match.StartsWith("-1") || match.EndsWith("-1")).Should().Be(1);
+        }
+
+        private static IList<string> MatchedIndices(IResultMatcher matcher, Run previous, Run current)
+        {
+            IList<MatchedResults> matches = matcher.Match(
+                previous.Results.Select(r => new ExtractedResult(r, previous)).ToList(),
+                current.Results.Select(r => new ExtractedResult(r, current)).ToList());
+
+            return matches
+                .Select(m => $"{previous.Results.IndexOf(m.PreviousResult?.Result)} -> {current.Results.IndexOf(m.CurrentResult?.Result)}")
+                .ToList();
+        }
+
         [Fact]
         public void V2ResultMatcher_MessageContainsLineNumbers()
         {
@@ -1,6 +1,9 @@
 ﻿// Copyright (c) Microsoft. All rights reserved.
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
+using System.Linq;
+using System.Threading.Tasks;
+
 using FluentAssertions;
 
 using Xunit;
@@ -57,6 +60,78 @@ namespace Microsoft.CodeAnalysis.Sarif.UnitTests
 
             cache.Clear();
             cache.Keys.Should().BeEmpty();
+
+            cache.Hits.Should().Be(1);
+            cache.Misses.Should().Be(3);
+            cache.Evictions.Should().Be(1);
+        }
+
+        [Fact]
+        public void Cache_MaxSizeInBytes_EvictsBySizeRatherThanCount()
+        {
+            // A count bound too small to shard keeps one CLOCK, so the eviction order is exact.
+            var cache = new Cache<int, string>(
+                (key) => new string('x', key),
+                capacity: 10,
+                maxSizeInBytes: 100,
+                sizeOf: (value) => value.Length);
+
+            cache[40].Length.Should().Be(40);
+            cache[50].Length.Should().Be(50);
+            cache.SizeInBytes.Should().Be(90);
+
+            // 90 + 30 exceeds the bound, so the unreferenced 40 goes first.
+            cache[30].Length.Should().Be(30);
+            cache.ContainsKey(40).Should().BeFalse();
+            cache.ContainsKey(50).Should().BeTrue();
+            cache.SizeInBytes.Should().Be(80);
+            cache.Evictions.Should().Be(1);
+
+            // A value larger than the whole bound is still cached, displacing everything else...
+            cache[500].Length.Should().Be(500);
+            cache.ContainsKey(500).Should().BeTrue();
+            cache.Count.Should().Be(1);
+            cache.SizeInBytes.Should().Be(500);
+
+            // ...until the next value is stored.
+            cache[10].Length.Should().Be(10);
+            cache.ContainsKey(500).Should().BeFalse();
+            cache.SizeInBytes.Should().Be(10);
+        }
+
+        [Fact]
+        public void Cache_MaxSizeInBytes_AppliesToTheWholeCache()
+        {
+            // With no count bound, there's a shard per processor; each value is larger than a shard's share of the bound.
+            var cache = new Cache<int, string>(
+                (key) => new string('x', key),
+                capacity: 0,
+                maxSizeInBytes: 100,
+                sizeOf: (value) => value.Length);
+
+            cache[60] = new string('y', 60);
+            cache[30].Length.Should().Be(30);
+
+            cache.ContainsKey(60).Should().BeTrue();
+            cache.ContainsKey(30).Should().BeTrue();
+            cache.SizeInBytes.Should().Be(90);
+            cache.Evictions.Should().Be(0);
+        }
+
+        [Fact]
+        public void Cache_ConcurrentAccess_StaysWithinCapacity()
+        {
+            var cache = new Cache<int, int>((key) => 10 * key, capacity: 64);
+
+            Parallel.For(0, 10000, (i) =>
+            {
+                int key = i % 200;
+                cache[key].Should().Be(10 * key);
+            });
+
+            cache.Count.Should().BeLessOrEqualTo(64);
+            cache.Keys.Count().Should().Be(cache.Count);
+            (cache.Hits + cache.Misses).Should().Be(10000);
         }
     }
 }
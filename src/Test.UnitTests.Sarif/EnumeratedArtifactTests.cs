@@ -4,6 +4,7 @@
 using System;
 using System.IO;
 using System.IO.Compression;
+using System.Linq;
 using System.Text;
 
 using FluentAssertions;
@@ -191,6 +192,105 @@ namespace Test.UnitTests.Sarif
             enumeratedArtifact.Stream.Should().BeNull();
         }
 
+        [Fact]
+        public void EnumeratedArtifact_IsBinaryShouldNotFaultInContentsFromDisk()
+        {
+            var binaryArtifact = new EnumeratedArtifact(FileSystem.Instance)
+            {
+                Uri = new Uri(this.GetType().Assembly.Location)
+            };
+
+            binaryArtifact.IsBinary.Should().BeTrue();
+            binaryArtifact.bytes.Should().BeNull();
+            binaryArtifact.contents.Should().BeNull();
+
+            using var tempFile = new TempFile();
+            File.WriteAllText(tempFile.Name, $"{Guid.NewGuid()}");
+
+            var textArtifact = new EnumeratedArtifact(FileSystem.Instance)
+            {
+                Uri = new Uri(tempFile.Name)
+            };
+
+            textArtifact.IsBinary.Should().BeFalse();
+            textArtifact.bytes.Should().BeNull();
+            textArtifact.contents.Should().BeNull();
+        }
+
+        [Fact]
+        public void EnumeratedArtifact_OpenReadShouldNotFaultInContentsFromDisk()
+        {
+            string filePath = this.GetType().Assembly.Location;
+            var enumeratedArtifact = new EnumeratedArtifact(FileSystem.Instance)
+            {
+                Uri = new Uri(filePath)
+            };
+
+            byte[] header = new byte[2];
+            using (Stream stream = enumeratedArtifact.OpenRead())
+            {
+                stream.Read(header, 0, header.Length).Should().Be(header.Length);
+            }
+
+            // Managed assemblies are PE files, which begin with the 'MZ' signature.
+            header.Should().Equal((byte)'M', (byte)'Z');
+            enumeratedArtifact.bytes.Should().BeNull();
+            enumeratedArtifact.contents.Should().BeNull();
+        }
+
+        [Fact]
+        public void EnumeratedArtifact_OpenReadReturnsInMemoryContents()
+        {
+            string contents = "Test content.";
+
+            var enumeratedArtifact = new EnumeratedArtifact(FileSystem.Instance)
+            {
+                Uri = new Uri(this.GetType().Assembly.Location),
+                Contents = contents,
+            };
+
+            using Stream stream = enumeratedArtifact.OpenRead();
+            using var reader = new StreamReader(stream);
+            reader.ReadToEnd().Should().Be(contents);
+        }
+
+        [Fact]
+        public void EnumeratedArtifact_OpenReadReturnsTheFileBytesWhetherOrNotContentsWereRetrieved()
+        {
+            byte[] fileBytes = Encoding.UTF8.GetPreamble().Concat(Encoding.UTF8.GetBytes("Test content.")).ToArray();
+
+            using var tempFile = new TempFile();
+            File.WriteAllBytes(tempFile.Name, fileBytes);
+
+            var enumeratedArtifact = new EnumeratedArtifact(FileSystem.Instance)
+            {
+                Uri = new Uri(tempFile.Name)
+            };
+
+            ReadAllBytes(enumeratedArtifact.OpenRead()).Should().Equal(fileBytes);
+
+            enumeratedArtifact.Contents.Should().Be("Test content.");
+            ReadAllBytes(enumeratedArtifact.OpenRead()).Should().Equal(fileBytes);
+        }
+
+        [Fact]
+        public void EnumeratedArtifact_OpenReadReencodesInMemoryStreamAsItWasDecoded()
+        {
+            foreach (Encoding encoding in new[] { Encoding.Unicode, Encoding.UTF8, new UTF8Encoding(encoderShouldEmitUTF8Identifier: false) })
+            {
+                byte[] streamBytes = encoding.GetPreamble().Concat(encoding.GetBytes("Test content.")).ToArray();
+
+                var enumeratedArtifact = new EnumeratedArtifact(FileSystem.Instance)
+                {
+                    Uri = new Uri(this.GetType().Assembly.Location),
+                    Stream = new MemoryStream(streamBytes),
+                };
+
+                enumeratedArtifact.Contents.Should().Be("Test content.");
+                ReadAllBytes(enumeratedArtifact.OpenRead()).Should().Equal(streamBytes);
+            }
+        }
+
         [Fact]
         public void EnumeratedArtifact_FileSizeReturnedForInMemoryContents()
         {
@@ -281,6 +381,36 @@ namespace Test.UnitTests.Sarif
             hostile.SeekCallCount.Should().Be(0);
         }
 
+        [Fact]
+        public void EnumeratedArtifact_IsBinaryOnStream_DoesNotCallSeekOnCallerStream()
+        {
+            string payload = new string('a', 4096);
+            var hostile = new HostileSeekStream(new MemoryStream(Encoding.UTF8.GetBytes(payload)));
+
+            var artifact = new EnumeratedArtifact(FileSystem.Instance)
+            {
+                Uri = new Uri("test://textual-artifact", UriKind.Absolute),
+                Stream = hostile,
+            };
+
+            artifact.IsBinary.Should().BeFalse();
+            artifact.contents.Should().BeNull();
+
+            // The sniffed header must still be available to a subsequent full read.
+            artifact.Contents.Should().Be(payload);
+            hostile.SeekCallCount.Should().Be(0);
+        }
+
+        private static byte[] ReadAllBytes(Stream stream)
+        {
+            using (stream)
+            using (var memoryStream = new MemoryStream())
+            {
+                stream.CopyTo(memoryStream);
+                return memoryStream.ToArray();
+            }
+        }
+
         // CanSeek lies (like WebAPI's SeekableBufferedRequestStream); Seek throws to mirror the production AV.
         private sealed class HostileSeekStream : Stream
         {
@@ -445,6 +445,108 @@ namespace Microsoft.CodeAnalysis.Sarif.UnitTests
             actual.ValueEquals(expected).Should().BeTrue();
         }
 
+        [Fact]
+        public void FileRegionsCache_GetRollingHashes_HashesEachDistinctFileOnce()
+        {
+            var fileRegionsCache = new FileRegionsCache();
+            var cachedUri = new Uri(@"c:\temp\DoesNotExist\" + Guid.NewGuid().ToString() + ".cpp");
+            var missingUri = new Uri(@"c:\temp\DoesNotExist\" + Guid.NewGuid().ToString() + ".cpp");
+            string fileText = "int a;\nint b;\n";
+
+            fileRegionsCache.GetText(cachedUri, fileText);
+
+            IDictionary<string, Dictionary<int, string>> rollingHashes =
+                fileRegionsCache.GetRollingHashes(new[] { cachedUri, missingUri, cachedUri, missingUri });
+
+            rollingHashes.Should().HaveCount(2);
+            rollingHashes[cachedUri.GetFilePath()].Should().Equal(HashUtilities.RollingHash(fileText));
+            rollingHashes[missingUri.GetFilePath()].Should().BeNull();
+        }
+
+        [Fact]
+        public void FileRegionsCache_GetText_KeepsSuppliedTextLargerThanAShardOfTheSizeBound()
+        {
+            // The cache has at most four shards at the default capacity; this text is larger than any one shard's share.
+            var fileRegionsCache = new FileRegionsCache();
+            var missingUri = new Uri(Path.Combine(Path.GetTempPath(), $"{Guid.NewGuid():N}.cs"));
+            string fileText = new string('x', (int)(FileRegionsCache.DefaultCacheSizeInBytes / 4 / sizeof(char)) + 1);
+
+            fileRegionsCache.GetText(missingUri, fileText).Should().BeSameAs(fileText);
+            fileRegionsCache._fileTextCache.ContainsKey(missingUri.GetFilePath()).Should().BeTrue();
+            fileRegionsCache.GetText(missingUri).Should().BeSameAs(fileText);
+        }
+
+        [Fact]
+        public void FileRegionsCache_ReindexesFileChangedAfterItsTextWasEvicted()
+        {
+            string path = Path.Combine(Path.GetTempPath(), $"{Guid.NewGuid():N}.cs");
+            var uri = new Uri(path);
+
+            try
+            {
+                File.WriteAllText(path, "int a;\nint b;\n");
+
+                var fileRegionsCache = new FileRegionsCache();
+                fileRegionsCache.PopulateTextRegionProperties(new Region { StartLine = 2 }, uri, populateSnippet: true)
+                    .Snippet.Text.Should().Be("int b;");
+
+                // Evict the text (and let it be collected), leaving only the file's newline index cached.
+                File.WriteAllText(path, "int first;\nint second;\n");
+                fileRegionsCache._fileTextCache.Clear();
+                GC.Collect();
+                GC.WaitForPendingFinalizers();
+
+                Region region = fileRegionsCache.PopulateTextRegionProperties(new Region { StartLine = 2 }, uri, populateSnippet: true);
+                region.Snippet.Text.Should().Be("int second;");
+                region.CharOffset.Should().Be(11);
+
+                fileRegionsCache.PopulateTextRegionPropertiesForArtifact(new[] { new Region { StartLine = 1 } }, uri, populateSnippet: true)[0]
+                    .Snippet.Text.Should().Be("int first;");
+            }
+            finally
+            {
+                File.Delete(path);
+            }
+        }
+
+        [Fact]
+        public void FileRegionsCache_PopulateTextRegionPropertiesForArtifact_MatchesSingleRegionCalls()
+        {
+            var uri = new Uri(@"c:\temp\DoesNotExist\" + Guid.NewGuid().ToString() + ".cpp");
+            string fileText = "int a;\nint b;\r\n\n    return a + b;\n}\n";
+
+            var regions = new List<Region>
+            {
+                new Region { StartLine = 4, StartColumn = 5, EndColumn = 11 },
+                null,
+                new Region { CharOffset = 0, CharLength = 3 },
+                new Region { ByteOffset = 2, ByteLength = 4 },
+                new Region { StartLine = 1, EndLine = 2 },
+                new Region { StartLine = 3 },
+            };
+
+            var fileRegionsCache = new FileRegionsCache();
+            fileRegionsCache.GetText(uri, fileText);
+
+            IList<Region> populated = fileRegionsCache.PopulateTextRegionPropertiesForArtifact(regions, uri, populateSnippet: true);
+            IList<Region> contextRegions = fileRegionsCache.ConstructMultilineContextSnippetsForArtifact(populated, uri);
+
+            populated.Should().HaveCount(regions.Count);
+            contextRegions.Should().HaveCount(regions.Count);
+
+            for (int i = 0; i < regions.Count; i++)
+            {
+                Region expected = fileRegionsCache.PopulateTextRegionProperties(regions[i], uri, populateSnippet: true);
+                Region expectedContext = fileRegionsCache.ConstructMultilineContextSnippet(expected, uri);
+
+                Region.ValueComparer.Equals(populated[i], expected).Should().BeTrue($"region {i} should be populated as it is on its own");
+                Region.ValueComparer.Equals(contextRegions[i], expectedContext).Should().BeTrue($"region {i} should get the same context region");
+            }
+
+            populated[3].Should().BeSameAs(regions[3]);
+            populated[0].Snippet.Text.Should().Be("return");
+        }
+
         [Fact]
         public void FileRegionsCache_DivergentAuthoredCoordinate_ThrowsWhenNotOverwriting()
         {
@@ -8,6 +8,7 @@ using System.IO;
 using FluentAssertions;
 
 using Microsoft.CodeAnalysis.Sarif;
+using Microsoft.CodeAnalysis.Sarif.Numeric;
 using Microsoft.CodeAnalysis.Test.Utilities.Sarif;
 
 using Xunit;
@@ -539,5 +540,98 @@ namespace Microsoft.CodeAnalysis.Test.UnitTests.Sarif
             dict.Should().NotBeNull();
             dict.Should().BeEmpty();
         }
+
+        [Fact]
+        public void RollingHash_MatchesLongArithmeticReference()
+        {
+            // RollingHash was ported from JavaScript using the 'Long' class; this checks the native
+            // 64-bit version against that port on text with every kind of whitespace and line break.
+            var random = new Random(1237);
+            const string alphabet = "ab;{} \t\t\r\n\n\n";
+
+            foreach (int length in new[] { 0, 1, 2, 99, 100, 101, 1000, 20000 })
+            {
+                var text = new char[length];
+                for (int i = 0; i < length; i++)
+                {
+                    text[i] = alphabet[random.Next(alphabet.Length)];
+                }
+
+                string fileText = new string(text);
+
+                HashUtilities.RollingHash(fileText).Should().Equal(ReferenceRollingHash(fileText));
+            }
+        }
+
+        private static Dictionary<int, string> ReferenceRollingHash(string fileText)
+        {
+            const int blockSize = 100;
+            var rollingHashes = new Dictionary<int, string>();
+            var hashCounts = new Dictionary<string, int>();
+
+            int[] window = new int[blockSize];
+            int[] lineNumbers = new int[blockSize];
+            for (int i = 0; i < lineNumbers.Length; i++) { lineNumbers[i] = -1; }
+
+            var mod = new Long(37, 0, false);
+            var firstMod = new Long(1, 0, false);
+            for (int i = 0; i < blockSize; i++) { firstMod = firstMod.Multiply(mod); }
+
+            var hashRaw = new Long(0, 0, false);
+            int index = 0, lineNumber = 0;
+            bool lineStart = true, prevCR = false;
+
+            void OutputHash()
+            {
+                string hashValue = hashRaw.ToUnsigned().ToString(16);
+                hashCounts.TryGetValue(hashValue, out int count);
+                hashCounts[hashValue] = ++count;
+                rollingHashes[lineNumbers[index]] = $"{hashValue}:{count}";
+                lineNumbers[index] = -1;
+            }
+
+            void UpdateHash(int current)
+            {
+                int begin = window[index];
+                window[index] = current;
+                hashRaw = mod.Multiply(hashRaw).Add(Long.FromInt(current)).Subtract(firstMod.Multiply(Long.FromInt(begin)));
+                index = (index + 1) % blockSize;
+            }
+
+            void ProcessCharacter(int current)
+            {
+                if (current == ' ' || current == '\t' || (prevCR && current == '\n'))
+                {
+                    prevCR = false;
+                    return;
+                }
+
+                prevCR = current == '\r';
+                if (prevCR) { current = '\n'; }
+
+                if (lineNumbers[index] != -1) { OutputHash(); }
+
+                if (lineStart)
+                {
+                    lineStart = false;
+                    lineNumbers[index] = ++lineNumber;
+                }
+
+                if (current == '\n') { lineStart = true; }
+
+                UpdateHash(current);
+            }
+
+            foreach (char c in fileText) { ProcessCharacter(c); }
+            ProcessCharacter(65535);
+
+            for (int i = 0; i < blockSize; i++)
+            {
+                if (lineNumbers[index] != -1) { OutputHash(); }
+                UpdateHash(0);
+            }
+
+            return rollingHashes;
+        }
     }
 }
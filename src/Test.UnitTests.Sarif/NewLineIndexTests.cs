@@ -0,0 +1,145 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+using System.Text;
+
+using FluentAssertions;
+
+using Xunit;
+
+namespace Microsoft.CodeAnalysis.Sarif.UnitTests
+{
+    public class NewLineIndexTests
+    {
+        [Fact]
+        public void NewLineIndex_MatchesLineStartsOfText()
+        {
+            var random = new Random(2021);
+            var texts = new List<string>
+            {
+                string.Empty,
+                "\r",
+                "\n",
+                "\r\n",
+                "\n\r",
+                "no newline",
+                "a\r\nb\rc\nd\r\n",
+                new string('x', 1000) + "\n" + new string('y', 100000) + "\r\nz",
+            };
+
+            // Enough lines, of varying length, to span many blocks of the compact index.
+            const string alphabet = "ab\r\n  xyz\r\n";
+            for (int i = 0; i < 20; i++)
+            {
+                var sb = new StringBuilder();
+                int length = random.Next(0, 5000);
+                for (int j = 0; j < length; j++)
+                {
+                    sb.Append(random.Next(40) == 0 ? new string('q', random.Next(300)) : alphabet[random.Next(alphabet.Length)].ToString());
+                }
+
+                texts.Add(sb.ToString());
+            }
+
+            foreach (string text in texts)
+            {
+                List<int> lineStarts = GetLineStarts(text);
+                var index = new NewLineIndex(text);
+
+                index.MaximumLineNumber.Should().Be(lineStarts.Count);
+                index.Text.Should().BeSameAs(text);
+
+                for (int line = 1; line <= lineStarts.Count; line++)
+                {
+                    index.GetLineInfoForLine(line).Should().Be(new LineInfo(lineStarts[line - 1], line));
+                }
+
+                index.GetLineInfoForLine(lineStarts.Count + 1).Should().Be(new LineInfo(text.Length, lineStarts.Count + 1));
+
+                int line = 0;
+                for (int offset = 0; offset <= text.Length; offset++)
+                {
+                    while (line + 1 < lineStarts.Count && lineStarts[line + 1] <= offset) { line++; }
+                    index.GetLineInfoForOffset(offset).Should().Be(new LineInfo(lineStarts[line], line + 1));
+                }
+            }
+        }
+
+        [Fact]
+        public void NewLineIndex_WithTextProvider_DoesNotHoldText()
+        {
+            int retrievals = 0;
+
+            // The index is built from text that nothing else references, so it can be collected.
+            NewLineIndex index = CreateIndexWithTextProvider(() => { retrievals++; return CreateText(); });
+
+            index.MaximumLineNumber.Should().Be(3);
+            index.GetOffsetInfoForOffset(9).Should().Be(new OffsetInfo(3, 2));
+            retrievals.Should().Be(0);
+
+            index.SizeInBytes.Should().BeLessThan(CreateText().Length * sizeof(char));
+
+            GC.Collect();
+            GC.WaitForPendingFinalizers();
+
+            index.Text.Should().Be(CreateText());
+            retrievals.Should().Be(1);
+        }
+
+        [Fact]
+        public void NewLineIndex_WithTextProvider_DoesNotRetrieveTextStillInMemory()
+        {
+            string text = CreateText();
+            int retrievals = 0;
+
+            var index = new NewLineIndex(text, () => { retrievals++; return CreateText(); });
+
+            GC.Collect();
+            GC.WaitForPendingFinalizers();
+
+            index.Text.Should().BeSameAs(text);
+            retrievals.Should().Be(0);
+        }
+
+        [Fact]
+        public void NewLineIndex_WithTextProvider_ReturnsNullForChangedText()
+        {
+            NewLineIndex index = CreateIndexWithTextProvider(() => string.Concat("line 1\n", "line 2\r\n", "line 4"));
+
+            GC.Collect();
+            GC.WaitForPendingFinalizers();
+
+            index.Text.Should().BeNull();
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        private static NewLineIndex CreateIndexWithTextProvider(Func<string> textProvider)
+        {
+            return new NewLineIndex(CreateText(), textProvider);
+        }
+
+        // Built at runtime, unlike a literal, which is interned and so never collected.
+        private static string CreateText()
+        {
+            return string.Concat("line 1\n", "line 2\r\n", "line 3");
+        }
+
+        private static List<int> GetLineStarts(string text)
+        {
+            var lineStarts = new List<int> { 0 };
+            for (int i = 0; i < text.Length; i++)
+            {
+                char c = text[i];
+                if (c == '\n' || (c == '\r' && (i + 1 >= text.Length || text[i + 1] != '\n')))
+                {
+                    lineStarts.Add(i + 1);
+                }
+            }
+
+            return lineStarts;
+        }
+    }
+}
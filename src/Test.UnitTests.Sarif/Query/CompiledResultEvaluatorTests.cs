@@ -0,0 +1,169 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections;
+using System.Collections.Generic;
+
+using FluentAssertions;
+
+using Microsoft.CodeAnalysis.Sarif.Query.Evaluators;
+
+using Xunit;
+
+namespace Microsoft.CodeAnalysis.Sarif.Query
+{
+    public class CompiledResultEvaluatorTests
+    {
+        [Fact]
+        public void CompiledResultEvaluator_MatchesPerTermEvaluators()
+        {
+            Run run = CreateRun();
+
+            string[] queries = new[]
+            {
+                "",
+                "RuleId = TEST0001",
+                "RuleId = test0002",
+                "RuleId |> TEST && Level != Error",
+                "RuleId : 0003 || Uri >| .cs",
+                "Uri : /src/",
+                "Uri = https://example.com/lib/util.js",
+                "NOT Uri : /src/ && Kind = Fail",
+                "BaselineState = New || Rank > 50",
+                "IsSuppressed == true",
+                "Level = Warning && properties.category = 'Style'",
+            };
+
+            foreach (string query in queries)
+            {
+                IExpression expression = ExpressionParser.ParseExpression(query);
+
+                var expected = new BitArray(run.Results.Count);
+                expression.ToEvaluator<Result>(SarifEvaluators.ResultEvaluator).Evaluate(run.Results, expected);
+
+                var actual = new BitArray(run.Results.Count);
+                new CompiledResultEvaluator(expression).Evaluate(run.Results, actual);
+
+                for (int i = 0; i < run.Results.Count; ++i)
+                {
+                    actual[i].Should().Be(expected[i], $"result {i} should match the same way for query \"{query}\"");
+                }
+            }
+        }
+
+        [Fact]
+        public void CompiledResultEvaluator_MatchesTheSameInParallelChunks()
+        {
+            Run run = CreateRun();
+
+            string[] queries = new[]
+            {
+                "RuleId = TEST0001 || Uri >| .js",
+                "Level = Warning && properties.category = 'Style'",
+                "NOT properties.category = 'Style' && Uri : /src/",
+            };
+
+            foreach (string query in queries)
+            {
+                var evaluator = new CompiledResultEvaluator(ExpressionParser.ParseExpression(query));
+
+                var expected = new BitArray(run.Results.Count);
+                evaluator.Evaluate(run.Results, expected);
+
+                // Chunks of the same Run share one bound predicate; per-term matches must still line up by position.
+                var actual = new BitArray(run.Results.Count);
+                new ParallelEvaluator<Result>(evaluator, maxDegreeOfParallelism: 4, chunkSize: 2).Evaluate(run.Results, actual);
+
+                for (int i = 0; i < run.Results.Count; ++i)
+                {
+                    actual[i].Should().Be(expected[i], $"result {i} should match the same way for query \"{query}\"");
+                }
+            }
+        }
+
+        [Fact]
+        public void CompiledResultEvaluator_ReportsInvalidTermsWhenBuilt()
+        {
+            Assert.Throws<QueryParseException>(() => new CompiledResultEvaluator(ExpressionParser.ParseExpression("Level != UnknownValue")));
+            Assert.Throws<QueryParseException>(() => new CompiledResultEvaluator(ExpressionParser.ParseExpression("Rank > High")));
+            Assert.Throws<QueryParseException>(() => new CompiledResultEvaluator(ExpressionParser.ParseExpression("Leveler != Error")));
+        }
+
+        private static Run CreateRun()
+        {
+            var run = new Run
+            {
+                Tool = new Tool
+                {
+                    Driver = new ToolComponent
+                    {
+                        Name = "TestTool",
+                        Rules = new List<ReportingDescriptor>
+                        {
+                            new ReportingDescriptor { Id = "TEST0001" },
+                            new ReportingDescriptor { Id = "TEST0002" },
+                            new ReportingDescriptor { Id = "TEST0003" },
+                        }
+                    }
+                },
+                Artifacts = new List<Artifact>
+                {
+                    new Artifact { Location = new ArtifactLocation { Uri = new Uri("https://example.com/src/Program.cs") } },
+                    new Artifact { Location = new ArtifactLocation { Uri = new Uri("https://example.com/lib/util.js") } },
+                },
+                Results = new List<Result>
+                {
+                    // Rule and artifact by index
+                    CreateResult(ruleId: null, ruleIndex: 0, FailureLevel.Error, Location(artifactIndex: 0)),
+                    CreateResult(ruleId: "TEST0002", ruleIndex: 1, FailureLevel.Warning, Location(artifactIndex: 1)),
+
+                    // Rule by id only, artifact by URI only
+                    CreateResult(ruleId: "TEST0003", ruleIndex: -1, FailureLevel.Note, Location(uri: "https://example.com/src/Other.cs")),
+
+                    // Rule not in the run, several locations
+                    CreateResult(ruleId: "OTHER0001", ruleIndex: -1, FailureLevel.Warning, Location(artifactIndex: 1), Location(uri: "https://example.com/src/Third.cs")),
+
+                    // No locations
+                    CreateResult(ruleId: "TEST0001", ruleIndex: 0, FailureLevel.None),
+                }
+            };
+
+            run.Results[1].BaselineState = BaselineState.New;
+            run.Results[2].Rank = 75;
+            run.Results[3].Kind = ResultKind.Review;
+            run.Results[3].Suppressions = new List<Suppression> { new Suppression { Status = SuppressionStatus.Accepted } };
+            run.Results[1].SetProperty("category", "Style");
+
+            run.SetRunOnResults();
+            return run;
+        }
+
+        private static Result CreateResult(string ruleId, int ruleIndex, FailureLevel level, params Location[] locations)
+        {
+            return new Result
+            {
+                RuleId = ruleId,
+                RuleIndex = ruleIndex,
+                Level = level,
+                Message = new Message { Text = "Message" },
+                Locations = locations,
+            };
+        }
+
+        private static Location Location(int artifactIndex = -1, string uri = null)
+        {
+            return new Location
+            {
+                PhysicalLocation = new PhysicalLocation
+                {
+                    ArtifactLocation = new ArtifactLocation
+                    {
+                        Index = artifactIndex,
+                        Uri = uri == null ? null : new Uri(uri)
+                    }
+                }
+            };
+        }
+    }
+}
@@ -125,6 +125,43 @@ namespace Microsoft.CodeAnalysis.Sarif.Query
             Assert.Throws<QueryParseException>(() => Run(0, "Value > Bill", values));
         }
 
+        [Fact]
+        public void ParallelEvaluator_MatchesSequentialEvaluation()
+        {
+            var set = new List<SampleItem>();
+            for (int i = 0; i < 1000; ++i)
+            {
+                set.Add(new SampleItem() { ID = i, State = (State)(i % 4), Uri = i.ToString() });
+            }
+
+            string[] queries = new[]
+            {
+                "ID < 10",
+                "ID >= 100 && ID < 300 && State == Active",
+                "ID > 990 || Uri |> 5",
+                "NOT State = Blocked && Uri >| 7",
+                "ID > 5000 && State != Completed",
+                ""
+            };
+
+            foreach (string query in queries)
+            {
+                IExpressionEvaluator<SampleItem> evaluator = ExpressionParser.ParseExpression(query).ToEvaluator<SampleItem>(SampleItem.Evaluator);
+
+                var expected = new BitArray(set.Count);
+                evaluator.Evaluate(set, expected);
+
+                // Chunk size deliberately not a multiple of 32, so chunks don't align with BitArray words
+                var actual = new BitArray(set.Count);
+                new ParallelEvaluator<SampleItem>(evaluator, maxDegreeOfParallelism: 4, chunkSize: 37).Evaluate(set, actual);
+
+                for (int i = 0; i < set.Count; ++i)
+                {
+                    Assert.True(expected[i] == actual[i], $"Item {i} differs for query \"{query}\".");
+                }
+            }
+        }
+
         private static void Run(int expectedCount, string query, long[] values)
         {
             Run(expectedCount, query, values, LongArrayEvaluator);
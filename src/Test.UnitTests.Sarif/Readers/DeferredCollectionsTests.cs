@@ -7,6 +7,8 @@ using System.Linq;
 
 using Microsoft.CodeAnalysis.Sarif.Readers.SampleModel;
 
+using Moq;
+
 using Newtonsoft.Json;
 
 using Xunit;
@@ -63,6 +65,90 @@ namespace Microsoft.CodeAnalysis.Sarif.Readers
             CompareReadNormalToReadDeferredWithStreams(LogModelSampleBuilder.SampleOneLinePath);
         }
 
+        [Fact]
+        public void EndToEnd_NormalLog_WithFileSystemThatDoesNotOpenFiles()
+        {
+            LogModelSampleBuilder.EnsureSamplesBuilt();
+            string filePath = LogModelSampleBuilder.SampleLogPath;
+            byte[] contents = File.ReadAllBytes(filePath);
+
+            var mockFileSystem = new Mock<IFileSystem>();
+            mockFileSystem.Setup(x => x.FileOpenRead(filePath)).Returns(() => new MemoryStream(contents, writable: false));
+
+            Log expected;
+            using (var reader = new JsonTextReader(new StreamReader(new MemoryStream(contents))))
+            {
+                expected = new JsonSerializer().Deserialize<Log>(reader);
+            }
+
+            var serializer = new JsonSerializer { ContractResolver = new LogModelDeferredContractResolver() };
+
+            // Nothing can be mapped, so every stream is opened through the file system instead.
+            using (var mappedFile = new MemoryMappedStreamProvider(filePath, mockFileSystem.Object))
+            {
+                Assert.Equal(contents.Length, mappedFile.Length);
+
+                Log actual;
+                using (var reader = new JsonPositionedTextReader(mappedFile.OpenStream))
+                {
+                    actual = serializer.Deserialize<Log>(reader);
+                }
+
+                CompareReadNormalToReadDeferredLogs(expected, actual);
+            }
+
+            mockFileSystem.Verify(x => x.FileOpenRead(filePath), Times.AtLeast(2));
+        }
+
+        [Fact]
+        public void EndToEnd_NormalLog_MemoryMapped()
+        {
+            CompareReadNormalToReadDeferredMemoryMapped(LogModelSampleBuilder.SampleLogPath);
+        }
+
+        [Fact]
+        public void EndToEnd_EmptyLog_MemoryMapped()
+        {
+            CompareReadNormalToReadDeferredMemoryMapped(LogModelSampleBuilder.SampleEmptyPath);
+        }
+
+        [Fact]
+        public void EndToEnd_SingleLineJson_MemoryMapped()
+        {
+            CompareReadNormalToReadDeferredMemoryMapped(LogModelSampleBuilder.SampleOneLinePath);
+        }
+
+        private static void CompareReadNormalToReadDeferredMemoryMapped(string filePath)
+        {
+            LogModelSampleBuilder.EnsureSamplesBuilt();
+            var serializer = new JsonSerializer();
+
+            Log expected;
+            Log actual;
+
+            // Read normally (JsonSerializer -> JsonTextReader -> StreamReader)
+            using (var reader = new JsonTextReader(new StreamReader(filePath)))
+            {
+                expected = serializer.Deserialize<Log>(reader);
+            }
+
+            // Read with Deferred collections over a single mapping of the file
+            serializer.ContractResolver = new LogModelDeferredContractResolver();
+
+            using (var mappedFile = new MemoryMappedStreamProvider(filePath))
+            {
+                using (var reader = new JsonPositionedTextReader(mappedFile.OpenStream))
+                {
+                    actual = serializer.Deserialize<Log>(reader);
+                    Assert.IsType<DeferredDictionary<CodeContext>>(actual.CodeContexts);
+                    Assert.IsType<DeferredList<LogMessage>>(actual.Messages);
+                }
+
+                CompareReadNormalToReadDeferredLogs(expected, actual);
+                CompareParallelEnumeration(expected, actual);
+            }
+        }
+
         private static void CompareReadNormalToReadDeferredWithStreams(string filePath)
         {
             LogModelSampleBuilder.EnsureSamplesBuilt();
@@ -156,6 +242,39 @@ namespace Microsoft.CodeAnalysis.Sarif.Readers
             Assert.Equal(contextsCopy.Count, valueCount);
         }
 
+        private static void CompareParallelEnumeration(Log expected, Log actual)
+        {
+            // Small batches, so that there are several per worker
+            var deferredMessages = (DeferredList<LogMessage>)actual.Messages;
+            Assert.Equal(expected.Messages, deferredMessages.EnumerateInParallel(maxDegreeOfParallelism: 4, batchSize: 3).ToList());
+
+            List<LogMessage> unordered = deferredMessages.EnumerateInParallel(maxDegreeOfParallelism: 4, preserveOrder: false, batchSize: 3).ToList();
+            Assert.Equal(expected.Messages.Count, unordered.Count);
+            Assert.True(new HashSet<LogMessage>(expected.Messages).SetEquals(unordered));
+        }
+
+        private static void CompareReadItems(Log expected, Log actual)
+        {
+            var deferredMessages = (DeferredList<LogMessage>)actual.Messages;
+            int count = expected.Messages.Count;
+
+            // Every item, every third item, and the first and last items (a gap that may require a seek)
+            var allIndices = Enumerable.Range(0, count).ToList();
+            var everyThirdIndex = allIndices.Where(i => i % 3 == 0).ToList();
+            var firstAndLastIndices = count > 1 ? new List<int> { 0, count - 1 } : allIndices;
+
+            foreach (List<int> indices in new[] { allIndices, everyThirdIndex, firstAndLastIndices })
+            {
+                Assert.Equal(indices.Select(i => expected.Messages[i]), deferredMessages.ReadItems(indices).ToList());
+            }
+
+            // A repeated index is read again
+            if (count > 0)
+            {
+                Assert.Equal(new[] { expected.Messages[0], expected.Messages[0] }, deferredMessages.ReadItems(new[] { 0, 0 }).ToList());
+            }
+        }
+
         private static void CompareReadNormalToReadDeferred(string filePath)
         {
             LogModelSampleBuilder.EnsureSamplesBuilt();
@@ -178,6 +297,8 @@ namespace Microsoft.CodeAnalysis.Sarif.Readers
             Assert.IsType<DeferredList<LogMessage>>(actual.Messages);
 
             CompareReadNormalToReadDeferredLogs(expected, actual);
+            CompareParallelEnumeration(expected, actual);
+            CompareReadItems(expected, actual);
         }
 
         private static void AssertEqual(Log expected, Log actual)
@@ -2,6 +2,9 @@
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
 using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading.Tasks;
 
 using FluentAssertions;
 
@@ -94,6 +97,71 @@ namespace Microsoft.CodeAnalysis.Sarif.Writers
             logger.Results[rule01].Should().HaveCount(2);
         }
 
+        [Fact]
+        public void CachingLogger_LogsConcurrentlyWithoutLosingData()
+        {
+            const int threads = 8;
+            const int iterations = 500;
+
+            var rule = new ReportingDescriptor { Id = "TEST0001" };
+            var testAnalyzeOptions = new TestAnalyzeOptions();
+            var logger = new CachingLogger(testAnalyzeOptions.FailureLevels, testAnalyzeOptions.ResultKinds);
+
+            Parallel.For(0, threads, new ParallelOptions { MaxDegreeOfParallelism = threads }, _ =>
+            {
+                for (int i = 0; i < iterations; i++)
+                {
+                    Result result = GenerateResult();
+                    result.RuleId = rule.Id;
+
+                    logger.Log(rule, result, null);
+                    logger.LogToolNotification(new Notification { Message = new Message { Text = "tool" } }, rule);
+                    logger.LogConfigurationNotification(new Notification { Message = new Message { Text = "configuration" } });
+                }
+            });
+
+            logger.Results.Values.Sum(results => results.Count).Should().Be(threads * iterations);
+            logger.ToolNotifications.Should().HaveCount(threads * iterations);
+            logger.ConfigurationNotifications.Should().HaveCount(threads * iterations);
+        }
+
+        [Fact]
+        public void CachingLogger_AppendPreservesOrder()
+        {
+            var rule01 = new ReportingDescriptor { Id = "TEST0001" };
+            var rule02 = new ReportingDescriptor { Id = "TEST0002" };
+            var testAnalyzeOptions = new TestAnalyzeOptions();
+
+            var logger = new CachingLogger(testAnalyzeOptions.FailureLevels, testAnalyzeOptions.ResultKinds);
+            var other = new CachingLogger(testAnalyzeOptions.FailureLevels, testAnalyzeOptions.ResultKinds);
+
+            Result result01 = GenerateResult();
+            result01.RuleId = rule01.Id;
+            Result result02 = GenerateResult();
+            result02.RuleId = rule01.Id;
+            Result result03 = GenerateResult();
+            result03.RuleId = rule02.Id;
+
+            logger.Results = new Dictionary<ReportingDescriptor, IList<Tuple<Result, int?>>>
+            {
+                [rule01] = new List<Tuple<Result, int?>> { Tuple.Create(result01, (int?)null) },
+            };
+            other.Results = new Dictionary<ReportingDescriptor, IList<Tuple<Result, int?>>>
+            {
+                [rule01] = new List<Tuple<Result, int?>> { Tuple.Create(result02, (int?)null) },
+                [rule02] = new List<Tuple<Result, int?>> { Tuple.Create(result03, (int?)1) },
+            };
+            other.LogToolNotification(new Notification { Message = new Message { Text = "tool" } }, rule02);
+
+            logger.Append(other);
+
+            logger.Results.Keys.Should().Equal(rule01, rule02);
+            logger.Results[rule01].Select(tuple => tuple.Item1).Should().Equal(result01, result02);
+            logger.Results[rule02].Should().ContainSingle().Which.Item2.Should().Be(1);
+            logger.ToolNotifications.Should().ContainSingle().Which.Item2.Should().BeSameAs(rule02);
+            logger.ConfigurationNotifications.Should().BeNull();
+        }
+
         private static ReportingDescriptor GenerateRule()
         {
             return new ReportingDescriptor { Id = $"TEST00{Random.Next(100)}" };
@@ -392,6 +392,44 @@ namespace Microsoft.CodeAnalysis.Sarif.Writers
             actual.Should().BeCrossPlatformEquivalent<SarifLog>(expected);
         }
 
+        [Fact]
+        public void ResultLogJsonWriter_InitializeNextRun_WritesMultipleRuns()
+        {
+            var secondTool = new Tool { Driver = new ToolComponent { Name = "SecondTool" } };
+
+            string actual = GetJson(uut =>
+            {
+                uut.Initialize(new Run { Tool = DefaultTool });
+                uut.WriteResult(DefaultResult);
+
+                uut.InitializeNextRun(new Run { Tool = secondTool, Invocations = new[] { s_invocation } });
+                uut.WriteTool(secondTool);
+                uut.WriteResults(new[] { DefaultResult, DefaultResult });
+            });
+
+            SarifLog log = JsonConvert.DeserializeObject<SarifLog>(actual);
+            log.Runs.Count.Should().Be(2);
+            log.Runs[0].Tool.Driver.Name.Should().Be("DefaultTool");
+            log.Runs[0].Results.Count.Should().Be(1);
+            log.Runs[0].Invocations.Should().BeNull();
+            log.Runs[1].Tool.Driver.Name.Should().Be("SecondTool");
+            log.Runs[1].Results.Count.Should().Be(2);
+            log.Runs[1].Invocations.Count.Should().Be(1);
+        }
+
+        [Fact]
+        public void ResultLogJsonWriter_CannotInitializeNextRunAfterRunCompleted()
+        {
+            using (var str = new StringWriter())
+            using (var json = new JsonTextWriter(str))
+            using (var uut = new ResultLogJsonWriter(json))
+            {
+                uut.Initialize(new Run { Tool = DefaultTool });
+                uut.CompleteRun();
+                Assert.Throws<InvalidOperationException>(() => uut.InitializeNextRun(new Run { Tool = DefaultTool }));
+            }
+        }
+
         [Fact]
         public void ResultLogJsonWriter_CannotWriteToolTwice()
         {
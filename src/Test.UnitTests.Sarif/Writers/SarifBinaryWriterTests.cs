@@ -0,0 +1,166 @@
+﻿// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Numerics;
+using System.Text;
+
+using FluentAssertions;
+
+using Microsoft.CodeAnalysis.Sarif.Readers;
+
+using Newtonsoft.Json;
+using Newtonsoft.Json.Linq;
+
+using Xunit;
+using Xunit.Abstractions;
+
+namespace Microsoft.CodeAnalysis.Sarif.Writers
+{
+    public class SarifBinaryWriterTests
+    {
+        private readonly ITestOutputHelper _output;
+
+        public SarifBinaryWriterTests(ITestOutputHelper output)
+        {
+            _output = output;
+        }
+
+        [Fact]
+        public void SarifBinaryWriter_RoundTripsLog()
+        {
+            Random random = RandomSarifLogGenerator.GenerateRandomAndLog(_output);
+            SarifLog log = RandomSarifLogGenerator.GenerateSarifLogWithRuns(random, runCount: 3, resultCount: 50, RandomDataFields.CodeFlow | RandomDataFields.LogicalLocation);
+            log.Runs[1].Results = null;
+            log.Runs[2].Results[7] = null;
+            log.Runs[2].Results[8].Message = null;
+            log.Runs[2].Results[9].Locations = null;
+
+            using var stream = new MemoryStream();
+            log.SaveBinary(stream);
+
+            SarifLog roundTripped = SarifLog.LoadBinary(stream);
+
+            JsonConvert.SerializeObject(roundTripped).Should().Be(JsonConvert.SerializeObject(log));
+        }
+
+        [Fact]
+        public void SarifBinaryWriter_RoundTripsPropertyBagsAndNonStringValues()
+        {
+            var result = new Result
+            {
+                RuleId = "TEST1001",
+                Guid = Guid.NewGuid(),
+                Message = new Message { Text = "Message.", Arguments = new List<string> { "a", null } },
+                Provenance = new ResultProvenance { FirstDetectionTimeUtc = new DateTime(2020, 1, 2, 3, 4, 5, DateTimeKind.Utc) },
+                Locations = new List<Location>
+                {
+                    new Location
+                    {
+                        Id = new BigInteger(long.MaxValue) * 2,
+                        PhysicalLocation = new PhysicalLocation
+                        {
+                            ArtifactLocation = new ArtifactLocation { Uri = new Uri("src/file.c", UriKind.Relative), UriBaseId = "SRCROOT" },
+                            Region = new Region { StartLine = 3, Snippet = new ArtifactContent { Text = "code" } },
+                        },
+                    },
+                },
+                CodeFlows = new List<CodeFlow>
+                {
+                    new CodeFlow
+                    {
+                        ThreadFlows = new List<ThreadFlow>
+                        {
+                            new ThreadFlow
+                            {
+                                InitialState = JObject.Parse("{ \"x\": { \"text\": \"1\" } }"),
+                                Locations = new List<ThreadFlowLocation> { new ThreadFlowLocation { NestingLevel = 2 } },
+                            },
+                        },
+                    },
+                },
+            };
+            result.SetProperty("number", 42);
+            result.SetProperty("text", "value");
+            result.SetProperty("array", new[] { 1, 2 });
+            result.Message.SetProperty("nested", true);
+
+            var log = new SarifLog { Runs = new List<Run> { new Run { Tool = new Tool { Driver = new ToolComponent { Name = "Tool" } }, Results = new List<Result> { result } } } };
+
+            using var stream = new MemoryStream();
+            log.SaveBinary(stream);
+
+            SarifLog roundTripped = SarifLog.LoadBinary(stream);
+
+            JsonConvert.SerializeObject(roundTripped).Should().Be(JsonConvert.SerializeObject(log));
+            roundTripped.Runs[0].Results[0].GetProperty<int>("number").Should().Be(42);
+        }
+
+        [Fact]
+        public void SarifBinaryReader_ReadsSingleColumns()
+        {
+            Random random = RandomSarifLogGenerator.GenerateRandomAndLog(_output);
+            SarifLog log = RandomSarifLogGenerator.GenerateSarifLogWithRuns(random, runCount: 1, resultCount: 20);
+            Run run = log.Runs[0];
+
+            using var stream = new MemoryStream();
+            log.SaveBinary(stream);
+
+            using var reader = new SarifBinaryReader(stream, leaveOpen: true);
+            reader.RunCount.Should().Be(1);
+            reader.GetResultCount(0).Should().Be(20);
+            reader.ReadRuleIds(0).Should().Equal(run.Results.Select(r => r.RuleId));
+            reader.ReadLevels(0).Should().Equal(run.Results.Select(r => r.Level));
+            reader.ReadMessageTexts(0).Should().Equal(run.Results.Select(r => r.Message?.Text));
+            reader.ReadLocationUris(0).Select(uris => uris?.FirstOrDefault())
+                .Should().Equal(run.Results.Select(r => (string)JObject.FromObject(r).SelectToken("locations[0].physicalLocation.artifactLocation.uri")));
+            reader.ReadLogWithoutResults().Runs[0].Results.Should().BeNull();
+        }
+
+        [Fact]
+        public void SarifBinaryWriter_StoresEachLocationUriOnce()
+        {
+            const string uri = "file:///src/stored-once.cs";
+
+            var log = new SarifLog
+            {
+                Runs = new[]
+                {
+                    new Run
+                    {
+                        Tool = new Tool { Driver = new ToolComponent { Name = "Test" } },
+                        Results = Enumerable.Range(0, 3).Select(i => new Result
+                        {
+                            RuleId = "TEST0001",
+                            Message = new Message { Text = "Message" },
+                            Locations = new[] { new Location { PhysicalLocation = new PhysicalLocation { ArtifactLocation = new ArtifactLocation { Uri = new Uri(uri) } } } }
+                        }).ToList()
+                    }
+                }
+            };
+
+            using var stream = new MemoryStream();
+            log.SaveBinary(stream);
+
+            // The Result records and the 'locations.uri' column share one copy of the string.
+            string contents = Encoding.UTF8.GetString(stream.ToArray());
+            (contents.Length - contents.Replace(uri, string.Empty).Length).Should().Be(uri.Length);
+
+            using var reader = new SarifBinaryReader(stream, leaveOpen: true);
+            reader.ReadLocationUris(0).Select(uris => uris.Single()).Should().Equal(uri, uri, uri);
+            reader.ReadLog().Runs[0].Results.Select(r => r.Locations[0].PhysicalLocation.ArtifactLocation.Uri.OriginalString).Should().Equal(uri, uri, uri);
+        }
+
+        [Fact]
+        public void SarifBinaryReader_RejectsOtherFormats()
+        {
+            using var stream = new MemoryStream();
+            new SarifLog { Runs = new[] { new Run() } }.Save(stream);
+
+            Assert.Throws<InvalidDataException>(() => new SarifBinaryReader(stream));
+        }
+    }
+}